@@ -523,7 +523,7 @@ int main_process(int argc, char *argv[])
 				else fprintf(outfile, ", 0x%02x", (*MapIt).second->UL->GetValue()[i]);
 			}
 			fprintf(outfile, " };\n");
-			fprintf(outfile, "\t\tconst UL %s_UL(%s_UL_Data);\n\n", (*MapIt).first.c_str(), (*MapIt).first.c_str());
+			fprintf(outfile, "\t\tconst ULConst %s_UL = { %s_UL_Data };\n\n", (*MapIt).first.c_str(), (*MapIt).first.c_str());
 
 			MapIt++;
 		}
@@ -17,7 +17,7 @@ namespace mxflib
 	const UL OPAtomUL(OPAtom_Data);
 
 	const UInt8 OPAtom_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x02, 0x01, 0x10, 0x00, 0x00, 0x00 };
-	const UL OPAtom_UL(OPAtom_UL_Data);
+	const ULConst OPAtom_UL = { OPAtom_UL_Data };
 
 	// OP1a - #### DRAGONS: Qualifiers may need work!
 	const UInt8 OP1a_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00 };
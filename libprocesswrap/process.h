@@ -204,6 +204,10 @@ public:
 
 	bool IncludeSubstreams;					//!< Should sub-streams also be wrapped
 
+	int PrefetchDepth;						//!< Number of edit units to read ahead from each input on a worker thread, 0 to read directly
+
+	int OpenAhead;							//!< Number of files to open ahead of time when wrapping a list of files, 0 to open each when required
+
 	bool PutTCTrack;						//!< If false suppresses the output or Timecode tracks
 
 	bool ExtractTimecode;					//!< Should we attempt to set FP timecodes from extracted timecode?
@@ -309,6 +313,10 @@ public:
 
 		IncludeSubstreams = true;
 
+		PrefetchDepth = 0;
+
+		OpenAhead = 0;
+
 		PutTCTrack=true;
 
 		// DRAGONS: Force extraction of timecode to FP tracks if possible
@@ -162,8 +162,109 @@ printf("\n");
 
 
 
+namespace
+{
+	//! Run a whole number of AES blocks through an EVP cipher context
+	/*! In and Out may be the same buffer, but must not otherwise overlap.
+	 *  \return true if all OK
+	 */
+	bool AESUpdate(EVP_CIPHER_CTX *Context, UInt8 *Out, const UInt8 *In, size_t Size)
+	{
+		// EVP takes an int length, so very large buffers are done in sections
+		const size_t MaxSection = 0x40000000;
+
+		while(Size)
+		{
+			int ThisSize = static_cast<int>(Size > MaxSection ? MaxSection : Size);
+
+			int OutSize;
+			if(!EVP_CipherUpdate(Context, Out, &OutSize, In, ThisSize) || (OutSize != ThisSize)) return false;
+
+			In += ThisSize;
+			Out += ThisSize;
+			Size -= ThisSize;
+		}
+
+		return true;
+	}
+}
+
+
+//! Set an encryption key
+/*! \return True if key is accepted
+ */
+bool AESEncrypt::SetKey(size_t KeySize, const UInt8 *Key)
+{
+	if(KeySize != 16)
+	{
+		error("Key for AES encryption must by 16 bytes, tried to use key of size %u\n", static_cast<unsigned int>(KeySize));
+		return false;
+	}
+
+	KeySet = false;
+	if(!EVP_EncryptInit_ex(Context, EVP_aes_128_cbc(), NULL, Key, CurrentIV)) return false;
+
+	// AS-DCP padding is added by the caller, so we only ever process whole blocks
+	EVP_CIPHER_CTX_set_padding(Context, 0);
+
+	KeySet = true;
+	return true;
+}
+
+
+//! Set an encryption Initialization Vector
+/*! \return False if Initialization Vector is rejected
+ */
+bool AESEncrypt::SetIV(size_t IVSize, const UInt8 *IV, bool Force /*=false*/)
+{
+	if(!Force) return false;
+
+	if(IVSize != 16)
+	{
+		error("IV for AES encryption must by 16 bytes, tried to use IV of size %u\n", static_cast<unsigned int>(IVSize));
+		return false;
+	}
+
+	memcpy(CurrentIV, IV, 16);
+
+	// Restart the chain with the new IV, keeping the existing key schedule
+	if(KeySet) return EVP_EncryptInit_ex(Context, NULL, NULL, NULL, CurrentIV) ? true : false;
+
+	return true;
+}
+
+
+//! Encrypt data bytes in place
+/*! \return true if the encryption is successful
+ */
+bool AESEncrypt::EncryptInPlace(size_t Size, UInt8 *Data)
+{
+	if(!KeySet)
+	{
+		error("AESEncrypt::EncryptInPlace() called before a key was set\n");
+		return false;
+	}
+
+	if((Size % 16) != 0)
+	{
+		error("AESEncrypt::EncryptInPlace() can only encrypt whole 16-byte blocks, tried to encrypt %s bytes\n", UInt64toString(Size).c_str());
+		return false;
+	}
+
+	if(Size == 0) return true;
+
+	if(!AESUpdate(Context, Data, Data, Size)) return false;
+
+	// Track the chained IV, which is the last encrypted block
+	memcpy(CurrentIV, &Data[Size - 16], 16);
+
+	return true;
+}
+
+
 //! Encrypt data and return in a new buffer
 /*! \return NULL pointer if the encryption is unsuccessful
+ *  \note Any partial block at the end is zero-padded before encryption
  */
 DataChunkPtr AESEncrypt::Encrypt(size_t Size, const UInt8 *Data)
 {
@@ -173,7 +274,29 @@ DataChunkPtr AESEncrypt::Encrypt(size_t Size, const UInt8 *Data)
 
 	DataChunkPtr Ret = new DataChunk(RetSize);
 
-	AES_cbc_encrypt(Data, Ret->Data, static_cast<unsigned long>(Size), &CurrentKey, CurrentIV, AES_ENCRYPT);
+	// Encrypt directly into the new buffer if we have whole blocks, otherwise pad a copy and encrypt that in place
+	if(RetSize == Size)
+	{
+		if(!KeySet)
+		{
+			error("AESEncrypt::Encrypt() called before a key was set\n");
+			return NULL;
+		}
+
+		if(Size == 0) return Ret;
+
+		if(!AESUpdate(Context, Ret->Data, Data, Size)) return NULL;
+
+		// Track the chained IV, which is the last encrypted block
+		memcpy(CurrentIV, &Ret->Data[Size - 16], 16);
+	}
+	else
+	{
+		memcpy(Ret->Data, Data, Size);
+		memset(&Ret->Data[Size], 0, RetSize - Size);
+
+		if(!EncryptInPlace(RetSize, Ret->Data)) return NULL;
+	}
 
 	return Ret;
 }
@@ -294,6 +417,17 @@ bool Encrypt_GCReadHandler::HandleData(GCReaderPtr Caller, KLVObjectPtr Object)
 	int i; for(i=0; i<16; i++) IV[i] = (UInt8) rand();
 	KLVE->SetEncryptIV(16, IV, true);
 
+	// If we have a pipeline hand the encryption to a worker thread
+	if(Pipeline)
+	{
+		Pipeline->Submit(KLVE, Writer, Index, IndexPos);
+
+		// Update the index position count (even if not yet indexing)
+		IndexPos++;
+
+		return true;
+	}
+
 	// Update the index table to the new position
 	if(Index)
 	{
@@ -310,20 +444,469 @@ bool Encrypt_GCReadHandler::HandleData(GCReaderPtr Caller, KLVObjectPtr Object)
 }
 
 
+//! Start a pipeline with a given number of worker threads
+Crypto_Pipeline::Crypto_Pipeline(int ThreadCount)
+{
+	if(ThreadCount < 1) ThreadCount = 1;
+
+	// Allow enough jobs to keep all workers busy while the oldest is being finished
+	MaxPending = static_cast<size_t>(ThreadCount) * 4;
+	StopRequested = false;
+	Finishing = false;
+
+	int i;
+	for(i = 0; i < ThreadCount; i++)
+	{
+		Thread Worker;
+		if(!Worker.Start(ThreadEntry, this)) break;
+		Threads.push_back(Worker);
+	}
+
+	if(Threads.empty()) error("Unable to start any crypto worker threads\n");
+}
+
+
+//! Release the thread resources
+Crypto_Pipeline::~Crypto_Pipeline()
+{
+	// DRAGONS: The derived class should already have called Stop() - this is a safety net that only joins the threads
+	if(!Threads.empty())
+	{
+		Lock();
+		StopRequested = true;
+		Signal();
+		Unlock();
+
+		size_t i;
+		for(i = 0; i < Threads.size(); i++) Threads[i].Join();
+	}
+}
+
+
+//! Finish all outstanding jobs and stop the workers
+void Crypto_Pipeline::Stop(void)
+{
+	Flush();
+
+	Lock();
+	StopRequested = true;
+	Signal();
+	Unlock();
+
+	size_t i;
+	for(i = 0; i < Threads.size(); i++) Threads[i].Join();
+
+	Threads.clear();
+}
+
+
+//! Add a job to the end of the list
+void Crypto_Pipeline::AddJob(Job *NewJob)
+{
+	Lock();
+	Jobs.push_back(NewJob);
+	Signal();
+	Unlock();
+
+	// Finish anything that is already done, then wait if we are too far ahead
+	FinishCompleted(false);
+	for(;;)
+	{
+		Lock();
+		size_t Pending = Jobs.size();
+		Unlock();
+
+		if(Pending <= MaxPending) break;
+
+		FinishCompleted(true);
+	}
+}
+
+
+//! Wait for all outstanding jobs and finish them
+void Crypto_Pipeline::Flush(void)
+{
+	for(;;)
+	{
+		Lock();
+		bool Empty = Jobs.empty();
+		Unlock();
+
+		if(Empty) break;
+
+		FinishCompleted(true);
+	}
+}
+
+
+//! Finish all completed jobs at the head of the list, optionally waiting for the first to complete
+bool Crypto_Pipeline::FinishCompleted(bool Wait)
+{
+	bool Ret = false;
+
+	for(;;)
+	{
+		Lock();
+		if(Wait && !Ret)
+		{
+			while(!Jobs.empty() && !Jobs.front()->Done) this->Wait();
+		}
+
+		if(Jobs.empty() || !Jobs.front()->Done)
+		{
+			Unlock();
+			break;
+		}
+
+		Job *ThisJob = Jobs.front();
+		Jobs.pop_front();
+
+		// Wake anyone waiting for space in the list
+		Signal();
+		Unlock();
+
+		Finishing = true;
+		FinishJob(ThisJob);
+		Finishing = false;
+
+		delete ThisJob;
+
+		Ret = true;
+	}
+
+	return Ret;
+}
+
+
+//! The body of each worker thread
+void Crypto_Pipeline::Worker(void)
+{
+	Lock();
+	for(;;)
+	{
+		// Find the oldest job not yet started
+		Job *ThisJob = NULL;
+		JobList::iterator it = Jobs.begin();
+		while(it != Jobs.end())
+		{
+			if(!(*it)->Started)
+			{
+				ThisJob = *it;
+				break;
+			}
+			it++;
+		}
+
+		if(!ThisJob)
+		{
+			if(StopRequested) break;
+
+			Wait();
+			continue;
+		}
+
+		ThisJob->Started = true;
+		Unlock();
+
+		ProcessJob(ThisJob);
+
+		Lock();
+		ThisJob->Done = true;
+		Signal();
+	}
+	Unlock();
+}
+
+
+//! Lock the mutex
+void Crypto_Pipeline::Lock(void) { JobMutex.Lock(); }
+
+//! Unlock the mutex
+void Crypto_Pipeline::Unlock(void) { JobMutex.Unlock(); }
+
+//! Wait for the job list to change
+void Crypto_Pipeline::Wait(void) { JobsChanged.Wait(JobMutex); }
+
+//! Signal that the job list has changed
+void Crypto_Pipeline::Signal(void) { JobsChanged.Broadcast(); }
+
+//! Thread entry point
+void Crypto_Pipeline::ThreadEntry(void *Param)
+{
+	static_cast<Crypto_Pipeline *>(Param)->Worker();
+}
+
+
+//! Add a KLVE to be encrypted and written to a given writer
+void Encrypt_Pipeline::Submit(KLVEObjectPtr &KLVE, GCWriterPtr &Writer, IndexTablePtr &Index, Position IndexPos)
+{
+	// Encrypt synchronously if we failed to start any workers
+	if(Threads.empty())
+	{
+		if(Index) Index->Update(IndexPos, (UInt64)Writer->GetStreamOffset());
+		Writer->WriteRaw(SmartPtr_Cast(KLVE, KLVObject));
+		return;
+	}
+
+	EncryptJob *ThisJob = new EncryptJob;
+	ThisJob->KLVE = KLVE;
+	ThisJob->Writer = Writer;
+	ThisJob->Index = Index;
+	ThisJob->IndexPos = IndexPos;
+
+	// Load the plaintext value while we are on the reading thread
+	KLVE->ReadData();
+
+	// Write the KL and AS-DCP header to a memory file to receive the encrypted value
+	// DRAGONS: This is done here rather than in the worker as it replaces smart pointers shared with the source object
+	ThisJob->Result = new MXFFile;
+	ThisJob->Result->OpenMemory();
+	KLVE->SetDestination(ThisJob->Result, 0);
+	KLVE->WriteKL();
+
+	AddJob(ThisJob);
+}
+
+
+//! Encrypt the value into the job's memory file
+void Encrypt_Pipeline::ProcessJob(Job *ThisJob)
+{
+	// DRAGONS: Nothing touched here is shared with any other job or the reading thread
+	static_cast<EncryptJob *>(ThisJob)->KLVE->WriteData();
+}
+
+
+//! Write the encrypted KLV from a completed job
+void Encrypt_Pipeline::FinishJob(Job *ThisJob)
+{
+	EncryptJob *Completed = static_cast<EncryptJob *>(ThisJob);
+
+	// Read back the encrypted KLV from the memory file
+	KLVObjectPtr Encrypted = new KLVObject();
+	Encrypted->SetSource(Completed->Result, 0);
+	Encrypted->ReadKL();
+
+	// Update the index table to the new position
+	if(Completed->Index)
+	{
+		Completed->Index->Update(Completed->IndexPos, (UInt64)Completed->Writer->GetStreamOffset());
+	}
+
+	// Write the encrypted data
+	Completed->Writer->WriteRaw(Encrypted);
+}
+
+
+namespace
+{
+	//! KLVObject read handler that supplies a value already held in memory
+	class Memory_KLVReadHandler : public KLVReadHandler_Base
+	{
+	protected:
+		DataChunkPtr Value;							//!< The value to supply
+
+	public:
+		//! Construct a handler to supply a given value
+		Memory_KLVReadHandler(DataChunkPtr &Value) : Value(Value) {}
+
+		//! Read data from the value into the KLVObject
+		virtual size_t ReadData(DataChunk &Buffer, KLVObjectPtr Object, Position Start = 0, size_t Size = static_cast<size_t>(-1))
+		{
+			// Work out how many bytes are available from Start
+			size_t Bytes = 0;
+			if(Start < static_cast<Position>(Value->Size)) Bytes = Value->Size - static_cast<size_t>(Start);
+			if(Size < Bytes) Bytes = Size;
+
+			// Replace the contents of the buffer without copying the old data
+			Buffer.Size = 0;
+			Buffer.Resize(Bytes);
+			if(Bytes) memcpy(Buffer.Data, &Value->Data[Start], Bytes);
+
+			return Bytes;
+		}
+	};
+}
+
+
+//! Switch a KLVObject read by a GCReader to read from a memory copy of its value
+void Decrypt_Pipeline::LoadToMemory(KLVObjectPtr &Object)
+{
+	// Read the value, then take over its buffer rather than copying it
+	Object->ReadData();
+	DataChunkPtr Value = new DataChunk;
+	Value->TakeBuffer(Object->GetData(), true);
+
+	// Place the value in a memory file at the same position as in the source file, so the location and KLSize remain valid
+	// DRAGONS: The key and length are not in the memory file, but they have already been read so are not needed
+	Position Location = Object->GetLocation();
+	MXFFilePtr Mem = new MXFFile;
+	Mem->OpenMemory(Value, Location + Object->GetKLSize());
+
+	Object->SetSource(Mem, Location);
+}
+
+
+//! Add a KLVE to be decrypted and handed back to a given GCReader
+void Decrypt_Pipeline::Submit(KLVEObjectPtr &KLVE, GCReaderPtr &Caller)
+{
+	// Hand back for decryption as it is written if we failed to start any workers
+	if(Threads.empty())
+	{
+		Caller->HandleData(SmartPtr_Cast(KLVE, KLVObject));
+		return;
+	}
+
+	DecryptJob *ThisJob = new DecryptJob;
+	ThisJob->KLVE = KLVE;
+	ThisJob->Caller = Caller;
+	ThisJob->Failed = false;
+
+	// Load the AS-DCP header while we are on the reading thread
+	// DRAGONS: This is done here rather than in the worker as it replaces smart pointers shared with the source object
+	KLVE->GetUL();
+
+	AddJob(ThisJob);
+}
+
+
+//! Decrypt the whole value into memory
+void Decrypt_Pipeline::ProcessJob(Job *ThisJob)
+{
+	DecryptJob *Current = static_cast<DecryptJob *>(ThisJob);
+
+	// DRAGONS: Nothing touched here is shared with any other job or the reading thread
+	size_t Bytes = Current->KLVE->ReadDataFrom(0);
+	if(static_cast<Length>(Bytes) != Current->KLVE->GetLength())
+	{
+		Current->Failed = true;
+		return;
+	}
+
+	Current->Plaintext = new DataChunk;
+	Current->Plaintext->TakeBuffer(Current->KLVE->GetData(), true);
+}
+
+
+//! Hand the decrypted KLV from a completed job back to its GCReader
+void Decrypt_Pipeline::FinishJob(Job *ThisJob)
+{
+	DecryptJob *Completed = static_cast<DecryptJob *>(ThisJob);
+
+	if(Completed->Failed)
+	{
+		error("Failed to decrypt KLV value - this KLV will be omitted\n");
+		return;
+	}
+
+	// Stop further decryption and have reads return the decrypted value
+	// The KLVE still writes the plaintext key and length as it would when decrypting as it is written
+	Completed->KLVE->SetDecrypt(NULL);
+	Completed->KLVE->SetReadHandler(new Memory_KLVReadHandler(Completed->Plaintext));
+
+	Completed->Caller->HandleData(SmartPtr_Cast(Completed->KLVE, KLVObject));
+}
+
+
+//! Set a decryption key
+/*! \return True if key is accepted
+ */
+bool AESDecrypt::SetKey(size_t KeySize, const UInt8 *Key)
+{
+	if(KeySize != 16)
+	{
+		error("Key for AES decryption must by 16 bytes, tried to use key of size %u\n", static_cast<unsigned int>(KeySize));
+		return false;
+	}
+
+	KeySet = false;
+	if(!EVP_DecryptInit_ex(Context, EVP_aes_128_cbc(), NULL, Key, CurrentIV)) return false;
+
+	// AS-DCP padding is removed by the caller, so we only ever process whole blocks
+	EVP_CIPHER_CTX_set_padding(Context, 0);
+
+	KeySet = true;
+	return true;
+}
+
+
+//! Set a decryption Initialization Vector
+/*! \return False if Initialization Vector is rejected
+ */
+bool AESDecrypt::SetIV(size_t IVSize, const UInt8 *IV, bool Force /*=false*/)
+{
+	if(!Force) return false;
+
+	if(IVSize != 16)
+	{
+		error("IV for AES encryption must by 16 bytes, tried to use IV of size %u\n", static_cast<unsigned int>(IVSize));
+		return false;
+	}
+
+	memcpy(CurrentIV, IV, 16);
+
+	// Restart the chain with the new IV, keeping the existing key schedule
+	if(KeySet) return EVP_DecryptInit_ex(Context, NULL, NULL, NULL, CurrentIV) ? true : false;
+
+	return true;
+}
+
+
+//! Decrypt data bytes in place
+/*! \return true if the decryption <i>appears to be</i> successful
+ */
+bool AESDecrypt::DecryptInPlace(size_t Size, UInt8 *Data)
+{
+	if(!KeySet)
+	{
+		error("AESDecrypt::DecryptInPlace() called before a key was set\n");
+		return false;
+	}
+
+	if((Size % 16) != 0)
+	{
+		error("AESDecrypt::DecryptInPlace() can only decrypt whole 16-byte blocks, tried to decrypt %s bytes\n", UInt64toString(Size).c_str());
+		return false;
+	}
+
+	if(Size == 0) return true;
+
+	// Track the chained IV, which is the last encrypted block (taken before it is overwritten)
+	UInt8 NextIV[16];
+	memcpy(NextIV, &Data[Size - 16], 16);
+
+	if(!AESUpdate(Context, Data, Data, Size)) return false;
+
+	memcpy(CurrentIV, NextIV, 16);
+
+	return true;
+}
+
+
 //! Decrypt data and return in a new buffer
 /*! \return NULL pointer if the encryption is unsuccessful
  */
 DataChunkPtr AESDecrypt::Decrypt(size_t Size, const UInt8 *Data)
 {
-	if((sizeof(size_t) > 4) &&(Size > 0xffffffff))
+	if(!KeySet)
 	{
-		error("Maximum chunk size in AESDecrypt::Decrypt() is 4GBytes\n");
+		error("AESDecrypt::Decrypt() called before a key was set\n");
+		return NULL;
+	}
+
+	if((Size % 16) != 0)
+	{
+		error("AESDecrypt::Decrypt() can only decrypt whole 16-byte blocks, tried to decrypt %s bytes\n", UInt64toString(Size).c_str());
 		return NULL;
 	}
 
 	DataChunkPtr Ret = new DataChunk(Size);
 
-	AES_cbc_encrypt(Data, Ret->Data, static_cast<unsigned long>(Size), &CurrentKey, CurrentIV, AES_DECRYPT);
+	if(Size == 0) return Ret;
+
+	if(!AESUpdate(Context, Ret->Data, Data, Size)) return NULL;
+
+	// Track the chained IV, which is the last encrypted block
+	memcpy(CurrentIV, &Data[Size - 16], 16);
 
 	return Ret;
 }
@@ -410,6 +993,9 @@ bool Decrypt_GCEncryptionHandler::HandleData(GCReaderPtr Caller, KLVObjectPtr Ob
 //	printf("0x%08x -> %02x:0x%08x Encrypted data, ", (int)Object->GetLocation(), OurSID, (int)Caller->GetStreamOffset());
 //	printf("Size = 0x%08x\n", (int)Object->GetLength());
 
+	// When decrypting on worker threads load the encrypted value into memory so the workers don't need the source file
+	if(Pipeline) Decrypt_Pipeline::LoadToMemory(Object);
+
 	KLVEObjectPtr KLVE = new KLVEObject(Object);
 
 	// Set a decryption wrapper
@@ -428,6 +1014,13 @@ bool Decrypt_GCEncryptionHandler::HandleData(GCReaderPtr Caller, KLVObjectPtr Ob
 		Hasher->SetKey(HashKey);
 	}
 
+	// Decrypt on the pipeline, which passes the decrypted data back for handling in order
+	if(Pipeline)
+	{
+		Pipeline->Submit(KLVE, Caller);
+		return true;
+	}
+
 	// Pass decryption wrapped data back for handling
 	Caller->HandleData(SmartPtr_Cast(KLVE, KLVObject));
 
@@ -33,7 +33,8 @@ using namespace mxflib;
 #include <stdlib.h>
 
 // Include AES encryption from OpenSSL
-#include "openssl/aes.h"
+// DRAGONS: The EVP interface is used so that hardware acceleration, such as AES-NI, is used where available
+#include "openssl/evp.h"
 #include "openssl/sha.h"
 
 
@@ -109,20 +110,24 @@ public:
 class AESEncrypt : public Encrypt_Base
 {
 protected:
-	AES_KEY CurrentKey;
-	UInt8 CurrentIV[16];
+	EVP_CIPHER_CTX *Context;				//!< OpenSSL cipher context, holding the key schedule and the current chained IV
+	bool KeySet;							//!< True once a key has been set
+	UInt8 CurrentIV[16];					//!< The IV that will be used for the next encryption
+
+private:
+	AESEncrypt(const AESEncrypt &);			//!< Don't allow copy construction
 
 public:
+	//! Construct an AES encryptor with no key set
+	AESEncrypt() : KeySet(false) { Context = EVP_CIPHER_CTX_new(); memset(CurrentIV, 0, 16); }
+
+	//! Free the cipher context
+	~AESEncrypt() { EVP_CIPHER_CTX_free(Context); }
+
 	//! Set an encryption key
 	/*! \return True if key is accepted
 	 */
-	bool SetKey(size_t KeySize, const UInt8 *Key) 
-	{
-		int Ret = AES_set_encrypt_key(Key, 128, &CurrentKey);
-
-		// Return true only if key setting was OK
-		return Ret ? false : true; 
-	};
+	bool SetKey(size_t KeySize, const UInt8 *Key);
 
 	//! Set an encryption Initialization Vector
 	/*! \return False if Initialization Vector is rejected
@@ -132,20 +137,7 @@ public:
 	 *        and false for any other calls.  This allows different schemes to be
 	 *        used with minimal changes in the calling code.
 	 */
-	bool SetIV(size_t IVSize, const UInt8 *IV, bool Force = false) 
-	{ 
-		if(!Force) return false;
-
-		if(IVSize != 16)
-		{
-			error("IV for AES encryption must by 16 bytes, tried to use IV of size %d\n", IVSize);
-			return false;
-		}
-
-		memcpy(CurrentIV, IV, 16);
-
-		return true; 
-	};
+	bool SetIV(size_t IVSize, const UInt8 *IV, bool Force = false);
 
 	//! Get the Initialization Vector that will be used for the next encryption
 	/*! If called immediately after SetIV() with Force=true or SetIV() for a crypto
@@ -160,13 +152,14 @@ public:
 	//! Can this encryption system safely encrypt in place?
 	/*! If BlockSize is 0 this function will return true if encryption of all block sizes can be "in place".
 	 *  Otherwise the result will indicate whether the given blocksize can be encrypted "in place".
+	 *  \note AES can encrypt any whole number of 16-byte blocks in place
 	 */
-	bool CanEncryptInPlace(size_t BlockSize = 0) { return false; }
+	bool CanEncryptInPlace(size_t BlockSize = 0) { return (BlockSize != 0) && ((BlockSize % 16) == 0); }
 
 	//! Encrypt data bytes in place
 	/*! \return true if the encryption is successful
 	 */
-	bool EncryptInPlace(size_t Size, UInt8 *Data) { return false; }
+	bool EncryptInPlace(size_t Size, UInt8 *Data);
 
 	//! Encrypt data and return in a new buffer
 	/*! \return NULL pointer if the encryption is unsuccessful
@@ -175,6 +168,147 @@ public:
 };
 
 
+// ============================================================================
+//! Base class for parallel encryption and decryption pipelines
+/*! Processes jobs on a pool of worker threads and finishes them, in the order
+ *  they were added, on the thread that added them. Only the finishing step may
+ *  touch anything shared with the rest of the application.
+ *  \note Derived classes must call Stop() in their destructors so that no
+ *        virtual functions are called once the derived part has been destroyed
+ */
+// ============================================================================
+class Crypto_Pipeline
+{
+protected:
+	//! A single job - derived classes add the details of the work
+	struct Job
+	{
+		bool Started;								//!< Set true once a worker has taken this job
+		bool Done;									//!< Set true once the worker has finished with this job
+
+		Job() : Started(false), Done(false) {}
+		virtual ~Job() {}
+	};
+
+	typedef std::list<Job *> JobList;
+
+	JobList Jobs;									//!< Jobs not yet finished, in the order they were added
+	size_t MaxPending;								//!< The maximum number of jobs to hold before waiting for the oldest to finish
+	bool StopRequested;								//!< Set true to ask the workers to stop
+	bool Finishing;									//!< Set true while a job is being finished
+
+	std::vector<Thread> Threads;					//!< The worker threads
+	Mutex JobMutex;									//!< Mutex protecting the job list and flags
+	CondVar JobsChanged;							//!< Signalled when a job is added or completed, or a stop requested
+
+private:
+	Crypto_Pipeline();								//!< Don't allow standard construction
+	Crypto_Pipeline(const Crypto_Pipeline &);		//!< Don't allow copy construction
+
+public:
+	//! Start a pipeline with a given number of worker threads
+	Crypto_Pipeline(int ThreadCount);
+
+	//! Release the thread resources
+	virtual ~Crypto_Pipeline();
+
+	//! Wait for all outstanding jobs and finish them
+	/*! This must be called before anything else is written to the output file, such as a partition pack */
+	void Flush(void);
+
+	//! Is a job currently being finished?
+	/*! Allows code called while finishing a job to avoid flushing (which would finish later jobs out of order) */
+	bool IsFinishing(void) const { return Finishing; }
+
+protected:
+	//! Add a job to the end of the list
+	/*! Completed jobs are finished before returning, and if too many jobs are pending this will
+	 *  wait for the oldest to complete.
+	 */
+	void AddJob(Job *NewJob);
+
+	//! Finish all outstanding jobs and stop the workers
+	void Stop(void);
+
+	//! Do the work for a job
+	/*! DRAGONS: Called on a worker thread, so must not touch anything shared with other jobs or the submitting thread */
+	virtual void ProcessJob(Job *ThisJob) = 0;
+
+	//! Finish a processed job
+	/*! Called on the submitting thread, in the order the jobs were added */
+	virtual void FinishJob(Job *ThisJob) = 0;
+
+	//! Finish all completed jobs at the head of the list, optionally waiting for the first to complete
+	/*! \return true if a job was finished */
+	bool FinishCompleted(bool Wait);
+
+	//! The body of each worker thread
+	void Worker(void);
+
+	//! Lock the mutex
+	void Lock(void);
+
+	//! Unlock the mutex
+	void Unlock(void);
+
+	//! Wait for the job list to change
+	/*! DRAGONS: Must be called with the mutex held */
+	void Wait(void);
+
+	//! Signal that the job list has changed
+	void Signal(void);
+
+	//! Thread entry point
+	static void ThreadEntry(void *Param);
+};
+
+
+// ============================================================================
+//! Parallel encryption pipeline
+/*! Encrypts KLVEObjects on a pool of worker threads and writes them to their
+ *  GCWriters, in the order they were submitted, on the submitting thread.
+ *  Each KLVE has its own IV so no state is shared between jobs.
+ */
+// ============================================================================
+class Encrypt_Pipeline : public Crypto_Pipeline, public RefCount<Encrypt_Pipeline>
+{
+protected:
+	//! A single KLV being encrypted
+	struct EncryptJob : public Job
+	{
+		KLVEObjectPtr KLVE;							//!< The object to encrypt, with its plaintext value already loaded
+		GCWriterPtr Writer;							//!< GCWriter to receive the encrypted data
+		IndexTablePtr Index;						//!< Index table to update (or NULL if none)
+		Position IndexPos;							//!< Edit unit to index this KLV as
+		MXFFilePtr Result;							//!< Memory file holding the encrypted KLV once done
+	};
+
+public:
+	//! Start a pipeline with a given number of worker threads
+	Encrypt_Pipeline(int ThreadCount) : Crypto_Pipeline(ThreadCount) {}
+
+	//! Write any outstanding jobs and stop the workers
+	~Encrypt_Pipeline() { Stop(); }
+
+	//! Add a KLVE to be encrypted and written to a given writer
+	/*! The plaintext value must already be loaded into the KLVE, and the IV and any hasher set.
+	 *  Completed jobs are written before returning, and if too many jobs are pending this will
+	 *  wait for the oldest to complete.
+	 */
+	void Submit(KLVEObjectPtr &KLVE, GCWriterPtr &Writer, IndexTablePtr &Index, Position IndexPos);
+
+protected:
+	//! Encrypt the value into the job's memory file
+	virtual void ProcessJob(Job *ThisJob);
+
+	//! Write the encrypted KLV from a completed job
+	virtual void FinishJob(Job *ThisJob);
+};
+
+//! Smart pointer to an encryption pipeline
+typedef SmartPtr<Encrypt_Pipeline> Encrypt_PipelinePtr;
+
+
 // ============================================================================
 //! Encrypting GCReader handler
 // ============================================================================
@@ -192,6 +326,8 @@ protected:
 	IndexTablePtr Index;							//!< Index table to update (or NULL if none)
 	Position IndexPos;								//!< Current edit unit for indexing
 
+	Encrypt_PipelinePtr Pipeline;					//!< Pipeline to encrypt on, or NULL to encrypt as each KLV is handled
+
 private:
 	Encrypt_GCReadHandler();						//!< Don't allow standard construction
 
@@ -209,6 +345,10 @@ public:
 
 	//! Set an index table to update with new byte offsets
 	void SetIndex(IndexTablePtr Index) { this->Index = Index; }
+
+	//! Set a pipeline to perform the encryption on worker threads
+	/*! \note The pipeline must be flushed before anything else is written to the output file */
+	void SetPipeline(Encrypt_PipelinePtr &Pipeline) { this->Pipeline = Pipeline; }
 };
 
 
@@ -245,20 +385,24 @@ public:
 class AESDecrypt : public Decrypt_Base
 {
 protected:
-	AES_KEY CurrentKey;
-	UInt8 CurrentIV[16];
+	EVP_CIPHER_CTX *Context;				//!< OpenSSL cipher context, holding the key schedule and the current chained IV
+	bool KeySet;							//!< True once a key has been set
+	UInt8 CurrentIV[16];					//!< The IV that will be used for the next decryption
+
+private:
+	AESDecrypt(const AESDecrypt &);			//!< Don't allow copy construction
 
 public:
+	//! Construct an AES decryptor with no key set
+	AESDecrypt() : KeySet(false) { Context = EVP_CIPHER_CTX_new(); memset(CurrentIV, 0, 16); }
+
+	//! Free the cipher context
+	~AESDecrypt() { EVP_CIPHER_CTX_free(Context); }
+
 	//! Set an encryption key
 	/*! \return True if key is accepted
 	 */
-	virtual bool SetKey(size_t KeySize, const UInt8 *Key) 
-	{
-		int Ret = AES_set_decrypt_key(Key, 128, &CurrentKey);
-
-		// Return true only if key setting was OK
-		return Ret ? false : true; 
-	};
+	virtual bool SetKey(size_t KeySize, const UInt8 *Key);
 
 	//! Set a decryption Initialization Vector
 	/*! \return False if Initialization Vector is rejected
@@ -268,20 +412,7 @@ public:
 	 *        and false for any other calls.  This allows different schemes to be
 	 *        used with minimal changes in the calling code.
 	 */
-	bool SetIV(size_t IVSize, const UInt8 *IV, bool Force = false)
-	{ 
-		if(!Force) return false;
-
-		if(IVSize != 16)
-		{
-			error("IV for AES encryption must by 16 bytes, tried to use IV of size %d\n", IVSize);
-			return false;
-		}
-
-		memcpy(CurrentIV, IV, 16);
-
-		return true; 
-	};
+	bool SetIV(size_t IVSize, const UInt8 *IV, bool Force = false);
 
 	//! Get the Initialization Vector that will be used for the next decryption
 	/*! If called immediately after SetIV() with Force=true or SetIV() for a crypto
@@ -296,13 +427,14 @@ public:
 	//! Can this decryption system safely decrypt in place?
 	/*! If BlockSize is 0 this function will return true if decryption of all block sizes can be "in place".
 	 *  Otherwise the result will indicate whether the given blocksize can be decrypted "in place".
+	 *  \note AES can decrypt any whole number of 16-byte blocks in place
 	 */
-	bool CanDecryptInPlace(size_t BlockSize = 0) { return false; }
+	bool CanDecryptInPlace(size_t BlockSize = 0) { return (BlockSize != 0) && ((BlockSize % 16) == 0); }
 
 	//! Decrypt data bytes in place
 	/*! \return true if the decryption <i>appears to be</i> successful
 	 */
-	bool DecryptInPlace(size_t Size, UInt8 *Data) { return false; }
+	bool DecryptInPlace(size_t Size, UInt8 *Data);
 
 	//! Decrypt data and return in a new buffer
 	/*! \return true if the decryption <i>appears to be</i> successful
@@ -312,6 +444,56 @@ public:
 
 
 
+// ============================================================================
+//! Parallel decryption pipeline
+/*! Decrypts KLVEObjects on a pool of worker threads and passes the plaintext
+ *  back to the GCReader that read them, in the order they were submitted, on
+ *  the submitting thread. Each KLVE starts from its own IV so no state is
+ *  shared between jobs.
+ */
+// ============================================================================
+class Decrypt_Pipeline : public Crypto_Pipeline, public RefCount<Decrypt_Pipeline>
+{
+protected:
+	//! A single KLV being decrypted
+	struct DecryptJob : public Job
+	{
+		KLVEObjectPtr KLVE;							//!< The object to decrypt, reading from a memory copy of the encrypted KLV
+		GCReaderPtr Caller;							//!< GCReader to receive the decrypted data
+		DataChunkPtr Plaintext;						//!< The decrypted value once done
+		bool Failed;								//!< Set true if the value did not decrypt
+	};
+
+public:
+	//! Start a pipeline with a given number of worker threads
+	Decrypt_Pipeline(int ThreadCount) : Crypto_Pipeline(ThreadCount) {}
+
+	//! Hand back any outstanding jobs and stop the workers
+	~Decrypt_Pipeline() { Stop(); }
+
+	//! Switch a KLVObject read by a GCReader to read from a memory copy of its value
+	/*! The object can then be wrapped in a KLVEObject and submitted without the workers needing the source file */
+	static void LoadToMemory(KLVObjectPtr &Object);
+
+	//! Add a KLVE to be decrypted and handed back to a given GCReader
+	/*! The KLVE must read from memory, as set up by LoadToMemory(), and have its decryption wrapper and any hasher set.
+	 *  Completed jobs are handed back before returning, and if too many jobs are pending this will
+	 *  wait for the oldest to complete.
+	 */
+	void Submit(KLVEObjectPtr &KLVE, GCReaderPtr &Caller);
+
+protected:
+	//! Decrypt the whole value into memory
+	virtual void ProcessJob(Job *ThisJob);
+
+	//! Hand the decrypted KLV from a completed job back to its GCReader
+	virtual void FinishJob(Job *ThisJob);
+};
+
+//! Smart pointer to a decryption pipeline
+typedef SmartPtr<Decrypt_Pipeline> Decrypt_PipelinePtr;
+
+
 // ============================================================================
 //! Decrypting GCReader encryption handler
 // ============================================================================
@@ -322,6 +504,8 @@ protected:
 
 	DataChunk DecKey;									//!< The decryption key we will use
 
+	Decrypt_PipelinePtr Pipeline;						//!< Pipeline to decrypt on, or NULL to decrypt as each KLV is written
+
 private:
 	Decrypt_GCEncryptionHandler();						//!< Don't allow standard construction
 
@@ -336,6 +520,10 @@ public:
 
 	//! Determin if a valid key has been set
 	bool KeyValid(void) { return (DecKey.Size == 16); }
+
+	//! Set a pipeline to perform the decryption on worker threads
+	/*! \note The pipeline must be flushed before anything else is written to the output file */
+	void SetPipeline(Decrypt_PipelinePtr &Pipeline) { this->Pipeline = Pipeline; }
 };
 
 
@@ -354,6 +542,8 @@ protected:
 	IndexTablePtr Index;								//!< Index table to update (or NULL if none)
 	Position IndexPos;									//!< Current edit unit for indexing
 
+	Decrypt_PipelinePtr Pipeline;						//!< Pipeline decrypting the encrypted KLVs of this stream (or NULL if none)
+
 private:
 	Decrypt_GCReadHandler();							//!< Don't allow standard construction
 
@@ -366,6 +556,9 @@ public:
 	 */
 	virtual bool HandleData(GCReaderPtr Caller, KLVObjectPtr Object) 
 	{
+		// Write anything still being decrypted first to keep the KLVs in order (unless this is one of them being handed back)
+		if(Pipeline && !Pipeline->IsFinishing()) Pipeline->Flush();
+
 		// Update the index table to the new position
 		if(Index)
 		{
@@ -383,5 +576,8 @@ public:
 
 	//! Set an index table to update with new byte offsets
 	void SetIndex(IndexTablePtr Index) { this->Index = Index; }
+
+	//! Set the pipeline decrypting the encrypted KLVs of this stream
+	void SetPipeline(Decrypt_PipelinePtr &Pipeline) { this->Pipeline = Pipeline; }
 };
 
@@ -67,6 +67,9 @@ bool ProcessPackageForEncrypt(BodyReaderPtr BodyParser, GCWriterPtr Writer, UInt
 //! Process the metadata for a given package on a decryption pass
 bool ProcessPackageForDecrypt(BodyReaderPtr BodyParser, GCWriterPtr Writer, UInt32 BodySID, PackagePtr ThisPackage, bool LoadInfo = false);
 
+//! Measure encryption and decryption throughput
+int RunBenchmark(int MBytes);
+
 
 
 //! MXFLib debug flag
@@ -96,6 +99,21 @@ IndexTablePtr Index;
 //! Original index data (if preserving the index unchanged)
 DataChunkPtr OriginalIndexData;
 
+//! Number of encryption or decryption worker threads, or zero to work on the reading thread
+int WorkerThreads = 0;
+
+//! Pipeline used to encrypt on worker threads (or NULL if not used)
+Encrypt_PipelinePtr EncryptPipeline;
+
+//! Pipeline used to decrypt on worker threads (or NULL if not used)
+Decrypt_PipelinePtr DecryptPipeline;
+
+//! Size of coalesced input reads in kilobytes, or zero to read each KLV separately
+int ReadBlockKB = 0;
+
+//! Size of the benchmark buffer in megabytes, or zero if not benchmarking
+int BenchmarkSize = 0;
+
 
 #include <time.h>
 
@@ -149,12 +167,37 @@ int main(int argc, char *argv[])
 				PlaintextOffset = atoi(&argv[i][3]);
 				printf("\nPlaintext Offset = %d\n", PlaintextOffset);
 			}
+			else if((argv[i][1] == 't') || (argv[i][1] == 'T'))
+			{
+				if((argv[i][2] != '=') && (argv[i][2] != ':'))
+				{
+					error("-t option syntax = -t=<threads>\n");
+					return 1;
+				}
+				WorkerThreads = atoi(&argv[i][3]);
+			}
+			else if((argv[i][1] == 'r') || (argv[i][1] == 'R'))
+			{
+				if((argv[i][2] != '=') && (argv[i][2] != ':'))
+				{
+					error("-r option syntax = -r=<kilobytes>\n");
+					return 1;
+				}
+				ReadBlockKB = atoi(&argv[i][3]);
+			}
+			else if((argv[i][1] == 'b') || (argv[i][1] == 'B'))
+			{
+				if((argv[i][2] == '=') || (argv[i][2] == ':')) BenchmarkSize = atoi(&argv[i][3]);
+				if(BenchmarkSize <= 0) BenchmarkSize = 64;
+			}
 		}
 	}
 
 	// Load the dictionaries
 	LoadDictionary(DictData);
 
+	if(BenchmarkSize) return RunBenchmark(BenchmarkSize);
+
 	if (argc - num_options < 3)
 	{
 		printf("\nUsage:  %s [options] <in-filename> <out-filename>\n\n", argv[0] );
@@ -164,9 +207,12 @@ int main(int argc, char *argv[])
 		printf("  -h         Perform HMAC hashing\n");
 		printf("  -k=keyfile Use the specified key file\n");
 		printf("  -p=offset  Leave plaintext bytes at the start\n");
+		printf("  -t=threads Encrypt or decrypt using this many worker threads\n");
+		printf("  -r=KB      Read the input file in blocks of this many kilobytes\n");
 		printf("  -ip        Preserve the existing index table values\n");
 		printf("  -l-        Don't update the EssenceContainers batch\n");
 		printf("  -l+        Do update the EssenceContainer value in the descriptor\n");
+		printf("  -b[=MB]    Measure encryption and decryption speed (default 64MB) then exit\n");
 		printf("\n");
 
 		return 1;
@@ -298,6 +344,7 @@ int main(int argc, char *argv[])
 
 	// Set up a body readyer for the source file
 	BodyReaderPtr BodyParser = new BodyReader(InFile);
+	if(ReadBlockKB > 0) BodyParser->SetReadBlockSize(ReadBlockKB * 1024);
 
 	// And a writer for the destination file
 	// Note that we use a GCWriter rather than a BodyWriter as this allows us to match the
@@ -402,11 +449,18 @@ int main(int argc, char *argv[])
 
 				if(SrcECBatch)
 				{
-					MDObjectULList::iterator it = SrcECBatch->begin();
-					while(it != SrcECBatch->end())
+					// Copy the labels as raw data if we can, rather than through the traits of each
+					DataChunk Buffer;
+					const UInt8 *ItemData;
+					size_t Count;
+					if(!(SrcECBatch->GetArrayData(16, ItemData, Count, Buffer) && DstECBatch->SetArrayData(16, Count, ItemData)))
 					{
-						DstECBatch->AddChild()->SetValue((*it).second->Value->PutData());
-						it++;
+						MDObjectULList::iterator it = SrcECBatch->begin();
+						while(it != SrcECBatch->end())
+						{
+							DstECBatch->AddChild()->SetValue((*it).second->Value->PutData());
+							it++;
+						}
 					}
 				}
 			}
@@ -418,7 +472,13 @@ int main(int argc, char *argv[])
 		Writer->SetKAG(CurrentPartition->GetUInt(KAGSize_UL));
 
 		// Parse the file until next partition or an error
-		if (!BodyParser->ReadFromFile()) break;
+		bool More = BodyParser->ReadFromFile();
+
+		// Write out everything still being encrypted or decrypted before the next partition pack
+		if(EncryptPipeline) EncryptPipeline->Flush();
+		if(DecryptPipeline) DecryptPipeline->Flush();
+
+		if(!More) break;
 	}
 
 	// Write the footer partition
@@ -889,6 +949,11 @@ bool ProcessPackageForEncrypt(BodyReaderPtr BodyParser, GCWriterPtr Writer, UInt
 		Encrypt_GCReadHandler *pHandler = new Encrypt_GCReadHandler(Writer, BodySID, ContextID, KeyID, KeyFileName);
 		pHandler->SetPlaintextOffset(PlaintextOffset);
 		if(Index) pHandler->SetIndex(Index);
+		if(WorkerThreads > 0)
+		{
+			if(!EncryptPipeline) EncryptPipeline = new Encrypt_Pipeline(WorkerThreads);
+			pHandler->SetPipeline(EncryptPipeline);
+		}
 		GCReadHandlerPtr Handler = pHandler;
 		GCReadHandlerPtr FillerHandler = new Basic_GCFillerHandler(Writer, BodySID);
 		BodyParser->MakeGCReader(BodySID, Handler, FillerHandler);
@@ -1000,6 +1065,14 @@ bool ProcessPackageForDecrypt(BodyReaderPtr BodyParser, GCWriterPtr Writer, UInt
 	Decrypt_GCEncryptionHandler *Test = SmartPtr_Cast(EncHandler, Decrypt_GCEncryptionHandler);
 	if(!Test->KeyValid()) return false;
 
+	// Decrypt on worker threads if requested, handing the plaintext back to the reader in order
+	if(WorkerThreads > 0)
+	{
+		if(!DecryptPipeline) DecryptPipeline = new Decrypt_Pipeline(WorkerThreads);
+		Test->SetPipeline(DecryptPipeline);
+		pHandler->SetPipeline(DecryptPipeline);
+	}
+
 	BodyParser->MakeGCReader(BodySID, Handler, FillerHandler);
 	GCReaderPtr Reader = BodyParser->GetGCReader(BodySID);
 	if(Reader) Reader->SetEncryptionHandler(EncHandler);
@@ -1048,3 +1121,215 @@ void mxflib::error(const char *Fmt, ...)
 	va_end(args);
 }
 
+
+//! Report the throughput of a benchmark pass
+static void BenchmarkReport(const char *Name, double Bytes, clock_t Start)
+{
+	double Seconds = static_cast<double>(clock() - Start) / CLOCKS_PER_SEC;
+
+	if(Seconds <= 0) printf("  %-32s too fast to measure\n", Name);
+	else printf("  %-32s %7.3f GB/s\n", Name, Bytes / Seconds / 1.0e9);
+}
+
+
+//! Measure encryption and decryption throughput
+/*! Each test processes a buffer of MBytes megabytes of random data. The raw
+ *  AES tests process it several times, the KLVEObject tests encrypt it as a
+ *  single KLV in a memory file and then decrypt it again.
+ *  \return 0 if all OK, else 1
+ */
+int RunBenchmark(int MBytes)
+{
+	const int Passes = 4;
+
+	size_t Size = static_cast<size_t>(MBytes) * 1024 * 1024;
+	double TotalBytes = static_cast<double>(Size) * Passes;
+
+	// Fixed key and IV - the values make no difference to the speed
+	UInt8 Key[16];
+	UInt8 IV[16];
+	int i;
+	for(i=0; i<16; i++) { Key[i] = (UInt8)(i * 17); IV[i] = (UInt8)(255 - i); }
+
+	// Source data
+	DataChunk Plain(Size);
+	size_t j;
+	for(j=0; j<Size; j++) Plain.Data[j] = (UInt8)rand();
+
+	printf("\nAES-128-CBC using %d MB buffers:\n", MBytes);
+
+	EncryptPtr Enc = new AESEncrypt;
+	DecryptPtr Dec = new AESDecrypt;
+	if((!Enc->SetKey(16, Key)) || (!Dec->SetKey(16, Key)))
+	{
+		error("Unable to set AES key\n");
+		return 1;
+	}
+
+	DataChunk Work;
+	Work.Set(Plain);
+
+	// Raw encryption (each pass starts a new chain so that the decryption passes below can undo them)
+	clock_t Start = clock();
+	for(i=0; i<Passes; i++)
+	{
+		Enc->SetIV(16, IV, true);
+		Enc->Encrypt(Work);
+	}
+	BenchmarkReport("Encrypt (copy)", TotalBytes, Start);
+
+	Start = clock();
+	for(i=0; i<Passes; i++)
+	{
+		Enc->SetIV(16, IV, true);
+		Enc->EncryptInPlace(Work);
+	}
+	BenchmarkReport("Encrypt (in place)", TotalBytes, Start);
+
+	// Raw decryption, checking that the result matches the original
+	Start = clock();
+	for(i=0; i<Passes; i++)
+	{
+		Dec->SetIV(16, IV, true);
+		Dec->DecryptInPlace(Work);
+	}
+	BenchmarkReport("Decrypt (in place)", TotalBytes, Start);
+
+	if(memcmp(Work.Data, Plain.Data, Size) != 0)
+	{
+		error("Decrypted data does not match the original\n");
+		return 1;
+	}
+
+	Start = clock();
+	for(i=0; i<Passes; i++)
+	{
+		Dec->SetIV(16, IV, true);
+		Dec->Decrypt(Work);
+	}
+	BenchmarkReport("Decrypt (copy)", TotalBytes, Start);
+
+	// Encryption and decryption with HMAC, as separate passes then combined
+	HashPtr Hasher = new HashHMACSHA1;
+	Hasher->SetKey(16, Key);
+
+	Start = clock();
+	for(i=0; i<Passes; i++)
+	{
+		Enc->SetIV(16, IV, true);
+		Enc->EncryptInPlace(Work);
+		Hasher->HashData(Work);
+	}
+	BenchmarkReport("Encrypt + HMAC (separate)", TotalBytes, Start);
+
+	Start = clock();
+	for(i=0; i<Passes; i++)
+	{
+		Enc->SetIV(16, IV, true);
+		Enc->EncryptAndHashInPlace(Work.Size, Work.Data, Hasher.GetPtr());
+	}
+	BenchmarkReport("Encrypt + HMAC (combined)", TotalBytes, Start);
+
+	Start = clock();
+	for(i=0; i<Passes; i++)
+	{
+		Dec->SetIV(16, IV, true);
+		Hasher->HashData(Work);
+		Dec->DecryptInPlace(Work);
+	}
+	BenchmarkReport("HMAC + Decrypt (separate)", TotalBytes, Start);
+
+	Start = clock();
+	for(i=0; i<Passes; i++)
+	{
+		Dec->SetIV(16, IV, true);
+		Dec->HashAndDecryptInPlace(Work.Size, Work.Data, Hasher.GetPtr());
+	}
+	BenchmarkReport("HMAC + Decrypt (combined)", TotalBytes, Start);
+
+	if(memcmp(Work.Data, Plain.Data, Size) != 0)
+	{
+		error("Decrypted data does not match the original\n");
+		return 1;
+	}
+
+	// KLVEObject encryption of a single KLV into a memory file
+	// DRAGONS: The memory file buffer is pre-allocated to stop buffer growth being timed
+	DataChunkPtr FileBuffer = new DataChunk;
+	FileBuffer->ResizeBuffer(Size + 1024);
+	MXFFilePtr Mem = new MXFFile;
+	Mem->OpenMemory(FileBuffer);
+
+	// Use a GC picture element key - the key makes no difference to the speed
+	const UInt8 ElementKey[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x02, 0x01, 0x01, 0x0d, 0x01, 0x03, 0x01, 0x15, 0x01, 0x05, 0x01 };
+	KLVObjectPtr Source = new KLVObject(new UL(ElementKey));
+	Source->SetLength(Size);
+	Source->GetData().Set(Plain);
+
+	KLVEObjectPtr KLVE = new KLVEObject(Source);
+	UUIDPtr ContextID = new UUID;
+	KLVE->SetContextID(ContextID);
+	KLVE->SetEncryptIV(16, IV, true);
+	KLVE->SetDestination(Mem, 0);
+
+	Start = clock();
+	Enc = new AESEncrypt;
+	KLVE->SetEncrypt(Enc);
+	Enc->SetKey(16, Key);
+	KLVE->WriteKL();
+	size_t Bytes = KLVE->WriteData();
+	BenchmarkReport("KLVEObject write", static_cast<double>(Size), Start);
+
+	if(Bytes != Size)
+	{
+		error("Only %s of %s bytes written by KLVEObject\n", UInt64toString(Bytes).c_str(), UInt64toString(Size).c_str());
+		return 1;
+	}
+
+	// KLVEObject decryption of the same KLV
+	KLVObjectPtr Encrypted = new KLVObject;
+	Encrypted->SetSource(Mem, 0);
+	Encrypted->ReadKL();
+
+	Start = clock();
+	KLVEObjectPtr ReadKLVE = new KLVEObject(Encrypted);
+	Dec = new AESDecrypt;
+	Dec->SetKey(16, Key);
+	ReadKLVE->SetDecrypt(Dec);
+	Bytes = ReadKLVE->ReadDataFrom(0);
+	BenchmarkReport("KLVEObject read", static_cast<double>(Size), Start);
+
+	if((Bytes != Size) || (memcmp(ReadKLVE->GetData().Data, Plain.Data, Size) != 0))
+	{
+		error("KLVEObject decrypted data does not match the original\n");
+		return 1;
+	}
+
+	// Random-access reads of small ranges from the same KLV, as used to pull single tiles out of a frame
+	const size_t RangeSize = 4096;
+	const int RangeCount = 1000;
+	if(Size > RangeSize)
+	{
+		ReadKLVE = new KLVEObject(Encrypted);
+		ReadKLVE->SetDecrypt(Dec);
+
+		srand(1);
+		Start = clock();
+		for(i=0; i<RangeCount; i++)
+		{
+			Position Offset = static_cast<Position>((static_cast<double>(rand()) / RAND_MAX) * (Size - RangeSize));
+			Bytes = ReadKLVE->ReadDataFrom(Offset, RangeSize);
+
+			if((Bytes != RangeSize) || (memcmp(ReadKLVE->GetData().Data, &Plain.Data[Offset], RangeSize) != 0))
+			{
+				error("KLVEObject random-access read at 0x%s does not match the original\n", Int64toHexString(Offset).c_str());
+				return 1;
+			}
+		}
+		BenchmarkReport("KLVEObject random 4k reads", static_cast<double>(RangeCount) * RangeSize, Start);
+	}
+
+	printf("\n");
+
+	return 0;
+}
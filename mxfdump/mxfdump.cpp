@@ -78,11 +78,17 @@ static bool DumpIDs = true;
 //! Flag for basic compiled dictionary as bootstrap when loading a metadictionary
 static bool BootstrapDict = false;
 
+//! Flag for listing the key and length of each KLV rather than dumping the metadata
+static bool ListKLVs = false;
+
 #ifdef OPTION3ENABLED
 //! Flag for diplaying baseline UL of sets unsing the ObjectClass extention mechanism
 static bool ShowBaseline = false;
 #endif // OPTION3ENABLED
 
+//! Flag for building the whole dictionary as it is loaded, rather than each definition as it is used
+static bool EagerDict = false;
+
 static void DumpObject(MDObjectPtr Object, std::string Prefix);
 
 
@@ -140,6 +146,8 @@ int main_process(int argc, char *argv[])
 				DebugMode = true;
 			else if((argv[i][1] == 'i') || (argv[i][1] == 'I'))
 				FullIndex = true;
+			else if((argv[i][1] == 'e') || (argv[i][1] == 'E'))
+				EagerDict = true;
 			else if((argv[i][1] == 'c') || (argv[i][1] == 'C'))
 			{
 				if(argv[i][2] == '0')
@@ -151,6 +159,8 @@ int main_process(int argc, char *argv[])
 				FullBody = true;
 //			else if((argv[i][1] == 'g') || (argv[i][1] == 'G'))
 //				FollowGlobals = true;
+			else if((argv[i][1] == 'k') || (argv[i][1] == 'K'))
+				ListKLVs = true;
 			else if((argv[i][1] == 'l') || (argv[i][1] == 'L'))
 				DumpLocation = true;
 #ifdef OPTION3ENABLED
@@ -216,8 +226,10 @@ int main_process(int argc, char *argv[])
 		printf("         -c         Check dump (produce simple counts for automated testing)\n");
 		printf("         -c0        Don't dump UUID, UMID and Timestamp values (for comparing files)\n");
 		printf("         -dd <dict> Load supplementary dictionary (also -d for legacy)\n");
+		printf("         -e         Build the whole dictionary when loaded, rather than as definitions are used\n");
 		printf("         -g         Follow global references (if linked)\n");
 		printf("         -i         Dump full index tables (can be lengthy)\n");
+		printf("         -k         List the key and length of every KLV in the file\n");
 		printf("         -l         Show the location (byte offset) of metadata items dumped\n");
 #ifdef COMPILED_DICT
 		printf("         -m <dict>  Specify main dictionary (instead of compile-time version)\n");
@@ -238,6 +250,9 @@ int main_process(int argc, char *argv[])
 		return 1;
 	}
 
+	// Only build the dictionary definitions that are used by this file, unless asked to build them all
+	if(!EagerDict) SetFeature(FeatureLazyDictionary);
+
 	if(BootstrapDict)
 	{
 		printf("- using a minimal compile-time dictionary and extending from metadictionary\n");
@@ -280,6 +295,23 @@ int main_process(int argc, char *argv[])
 		return 1;
 	}
 
+	// List the KLVs if requested, rather than dumping the file
+	if(ListKLVs)
+	{
+		KLVView View(TestFile);
+		KLVView::iterator it = View.begin();
+		while(it != View.end())
+		{
+			MDOTypePtr Type = MDOType::Find(UL(it->Key));
+			printf("0x%s %s %s %s\n", Int64toHexString(it->Offset, 8).c_str(), UL(it->Key).GetString().c_str(),
+				   Int64toString(it->ValueLength).c_str(), Type ? Type->Name().c_str() : "Unknown");
+			++it;
+		}
+
+		TestFile->Close();
+		return 0;
+	}
+
 	// Get a RIP (however possible)
 	TestFile->GetRIP();
 
@@ -33,6 +33,54 @@
 using namespace mxflib;
 
 
+//! Encrypt data bytes in place and add the encrypted bytes to a hash
+/*! \param Hasher The hash to update, or NULL to encrypt only
+ *  \return true if the encryption is successful
+ */
+bool Encrypt_Base::EncryptAndHashInPlace(size_t Size, UInt8 *Data, Hash_Base *Hasher)
+{
+	// Without a hash there is nothing to combine
+	if(!Hasher) return EncryptInPlace(Size, Data);
+
+	while(Size)
+	{
+		size_t ThisSize = (Size > CryptoBlockSize) ? CryptoBlockSize : Size;
+
+		if(!EncryptInPlace(ThisSize, Data)) return false;
+		Hasher->HashData(ThisSize, Data);
+
+		Data += ThisSize;
+		Size -= ThisSize;
+	}
+
+	return true;
+}
+
+
+//! Add encrypted data bytes to a hash then decrypt them in place
+/*! \param Hasher The hash to update, or NULL to decrypt only
+ *  \return true if the decryption <i>appears to be</i> successful
+ */
+bool Decrypt_Base::HashAndDecryptInPlace(size_t Size, UInt8 *Data, Hash_Base *Hasher)
+{
+	// Without a hash there is nothing to combine
+	if(!Hasher) return DecryptInPlace(Size, Data);
+
+	while(Size)
+	{
+		size_t ThisSize = (Size > CryptoBlockSize) ? CryptoBlockSize : Size;
+
+		Hasher->HashData(ThisSize, Data);
+		if(!DecryptInPlace(ThisSize, Data)) return false;
+
+		Data += ThisSize;
+		Size -= ThisSize;
+	}
+
+	return true;
+}
+
+
 //! Set a decryption Initialization Vector
 /*! \return False if Initialization Vector is rejected
  */
@@ -143,6 +191,8 @@ void KLVEObject::Init(void)
 	CurrentReadOffset = 0;
 	CurrentWriteOffset = 0;
 
+	DecryptOffset = -1;
+
 	PreDecrypted = 0;
 	AwaitingEncryption = 0;
 };
@@ -462,26 +512,57 @@ size_t KLVEObject::ReadDataFrom(Position Offset, size_t Size /*=-1*/)
 		// Initialize the decryption engine with the specified Initialization Vector
 		Decrypt->SetIV(16, Data.Data, true);
 
-		// Decrypt the check value...
-		DataChunkPtr PlainCheck = Decrypt->Decrypt(16, &Data.Data[16]);
+		// Decrypt the check value... (in place if possible, we own this buffer and are about to re-use it)
+		const UInt8 *PlainCheck = NULL;
+		DataChunkPtr PlainCheckData;
+		if(Decrypt->CanDecryptInPlace(16))
+		{
+			if(Decrypt->DecryptInPlace(16, &Data.Data[16])) PlainCheck = &Data.Data[16];
+		}
+		else
+		{
+			PlainCheckData = Decrypt->Decrypt(16, &Data.Data[16]);
+			if(PlainCheckData && (PlainCheckData->Size == 16)) PlainCheck = PlainCheckData->Data;
+		}
 
 		// Encrypt the check value... (Which is "CHUKCHUKCHUKCHUK" who ever said Chuck Harrison has no ego?)
 		const UInt8 DefinitivePlainCheck[16] = { 0x43, 0x48, 0x55, 0x4B, 0x43, 0x48, 0x55, 0x4B, 0x43, 0x48, 0x55, 0x4B, 0x43, 0x48, 0x55, 0x4B };
-		if((!PlainCheck) || (memcmp(PlainCheck->Data, DefinitivePlainCheck, PlainCheck->Size) != 0))
+		if((!PlainCheck) || (memcmp(PlainCheck, DefinitivePlainCheck, 16) != 0))
 		{
 			error("Check value did not correctly decrypt in KLVEObject::ReadDataFrom() - is the encryption key correct?\n");
 			return 0;
 		}
+
+		// The decryption chain is now ready for the first encrypted block
+		DecryptOffset = PlaintextOffset;
 	}
 
 	// If all the requested bytes are encrypted read-and-decrypt
 	if(Offset >= PlaintextOffset) 
 	{
-		// Check if an attempt is being made to random access the encrypted data - and barf if this is so
+		// Random access to the encrypted data is possible by re-starting the CBC chain, but not while hashing
 		if(Offset != CurrentReadOffset)
 		{
-			error("Attempt to perform random-access reading of an encrypted KLV value field\n");
-			return 0;
+			if(ReadHasher)
+			{
+				error("Attempt to perform random-access reading of an encrypted KLV value field while calculating a MIC\n");
+				return 0;
+			}
+
+			// Discard anything decrypted for the old position
+			PreDecrypted = 0;
+
+			// If we are not starting on a block boundary decrypt the whole block and keep the bytes from Offset onwards
+			Position BlockStart = Offset - ((Offset - PlaintextOffset) % EncryptionGranularity);
+			if(BlockStart != Offset)
+			{
+				if(ReadChunkedCryptoDataFrom(BlockStart, EncryptionGranularity) != EncryptionGranularity) return 0;
+
+				PreDecrypted = static_cast<int>(EncryptionGranularity - (Offset - BlockStart));
+				memcpy(PreDecryptBuffer, &Data.Data[Offset - BlockStart], PreDecrypted);
+			}
+
+			CurrentReadOffset = Offset;
 		}
 
 		size_t Ret = ReadCryptoDataFrom(Offset, Size);
@@ -506,6 +587,7 @@ size_t KLVEObject::ReadDataFrom(Position Offset, size_t Size /*=-1*/)
 
 		// Update the read pointer (it is possible to random access within the plaintext area)
 		CurrentReadOffset = Offset + Ret;
+		PreDecrypted = 0;
 
 		// Update the current hash if we are calculating one
 		if(ReadHasher) ReadHasher->HashData(Data);
@@ -518,14 +600,17 @@ size_t KLVEObject::ReadDataFrom(Position Offset, size_t Size /*=-1*/)
 
 	/* We will be mixing plaintext and encrypted */
 
-	// Check if an attempt is being made to random access the encrypted data - and barf if this is so
-	// DRAGONS: It is possible to re-load the initial IV to allow a "rewind" but this is not implemented
-	if(CurrentReadOffset > PlaintextOffset)
+	// Check if an attempt is being made to random access the encrypted data while hashing - and barf if this is so
+	// DRAGONS: Without a hasher ReadChunkedCryptoDataFrom() will re-load the IV if we have already read beyond PlaintextOffset
+	if(ReadHasher && (CurrentReadOffset > PlaintextOffset))
 	{
-		error("Attempt to perform random-access reading of an encrypted KLV value field\n");
+		error("Attempt to perform random-access reading of an encrypted KLV value field while calculating a MIC\n");
 		return 0;
 	}
 
+	// Any previously decrypted bytes cannot be for the start of the encrypted data
+	PreDecrypted = 0;
+
 	// Determine how many plaintext bytes could be available (maximum)
 	Length PlainSize = PlaintextOffset - Offset;
 
@@ -603,21 +688,19 @@ size_t KLVEObject::ReadCryptoDataFrom(Position Offset, size_t Size /*=-1*/)
 	// Check if all the requested bytes have already been decrypted
 	if(BytesToRead <= PreDecrypted)
 	{
-		// Set the data	into the DataChunk
+		// Set the data	into the DataChunk (DRAGONS: Set() does not shrink the chunk, so empty it first)
+		Data.Resize(0);
 		Data.Set(static_cast<size_t>(BytesToRead), PreDecryptBuffer);
 
-		// Remove any padding if required
-		if(Offset + Data.Size > ValueLength)
-		{
-			BytesToRead = ValueLength - Offset;
-			Data.Resize(static_cast<size_t>(BytesToRead));
-		}
-
 		// Shuffle any remaining bytes
-		memmove(PreDecryptBuffer, &PreDecryptBuffer[BytesToRead], static_cast<size_t>(EncryptionGranularity - BytesToRead));
+		PreDecrypted -= static_cast<int>(BytesToRead);
+		if(PreDecrypted) memmove(PreDecryptBuffer, &PreDecryptBuffer[BytesToRead], PreDecrypted);
+
+		// Remove any padding if required
+		if(Offset + Data.Size > ValueLength) Data.Resize(static_cast<size_t>(ValueLength - Offset));
 
 		// All done
-		return static_cast<size_t>(BytesToRead);
+		return Data.Size;
 	}
 
 	// Work out how many bytes have to be decrypted this time
@@ -644,17 +727,13 @@ size_t KLVEObject::ReadCryptoDataFrom(Position Offset, size_t Size /*=-1*/)
 	// Add back in any pre-decrypted data
 	if(PreDecrypted)
 	{
-		// Steal the newly decrypted bytes
-		UInt8 *Buffer = Data.StealBuffer(true);
-
-		// Make a buffer large enough for the complete data
-		Data.ResizeBuffer(PreDecrypted + static_cast<size_t>(BytesToDecrypt));
+		// Grow the buffer to fit the complete data (this keeps the existing buffer if it is big enough)
+		size_t NewBytes = Data.Size;
+		Data.Resize(PreDecrypted + NewBytes);
 
-		// Put the pre-decrypted bytes at the start
-		Data.Set(PreDecrypted, PreDecryptBuffer);
-
-		// Follow it with the newly decrypted data
-		Data.Set(static_cast<size_t>(BytesToDecrypt), Buffer, PreDecrypted);
+		// Move the newly decrypted bytes up to make room, then put the pre-decrypted bytes at the start
+		memmove(&Data.Data[PreDecrypted], Data.Data, NewBytes);
+		memcpy(Data.Data, PreDecryptBuffer, PreDecrypted);
 	}
 
 	// If we have decrypted more than requested store them as pre-decrypted for next time
@@ -683,16 +762,26 @@ size_t KLVEObject::ReadCryptoDataFrom(Position Offset, size_t Size /*=-1*/)
  *  \param Size Number of bytes to read, if = -1 all available bytes will be read (which could be billions!)
  *  \return The number of bytes read
  *	The IV must have already been set, Size must be a multiple of 16 as must (Offset - PlaintextOffset). 
+ *  If Offset is not the block following the last one decrypted the IV is re-loaded from the previous block (not allowed when hashing).
  *  Only encrypted parts of the value may be read using this function (i.e. Offset >= PlaintextOffset)
  */
 size_t KLVEObject::ReadChunkedCryptoDataFrom(Position Offset, size_t Size)
 {
+	// Re-start the decryption chain if this is not the next block
+	if(Offset != DecryptOffset)
+	{
+		if(ReadHasher)
+		{
+			error("Attempt to perform random-access reading of an encrypted KLV value field while calculating a MIC\n");
+			return 0;
+		}
+
+		if(!SeekDecrypt(Offset)) return 0;
+	}
+
 	// Read the encrypted data
 	size_t NewSize = Base_ReadDataFrom(DataOffset + Offset, Size);
 
-	// Update the current hash if we are calculating one
-	if(ReadHasher) ReadHasher->HashData(Data);
-
 	// Resize if less bytes than requested were actualy read
 	if(NewSize != Size)
 	{
@@ -707,30 +796,37 @@ size_t KLVEObject::ReadChunkedCryptoDataFrom(Position Offset, size_t Size)
 			
 			// Invalidate the "next" position to prevent further read attempts
 			CurrentReadOffset = Source.OuterLength;
+			DecryptOffset = -1;
 			return 0;
 		}
 	}
 
-	// See if we can decrypt this in place...
+	// See if we can decrypt this in place, updating the current hash (if we are calculating one) as we go
 	if(Decrypt->CanDecryptInPlace(Size))
 	{
-		if(!Decrypt->DecryptInPlace(Data))
+		if(!Decrypt->HashAndDecryptInPlace(Data.Size, Data.Data, ReadHasher.GetPtr()))
 		{
 			// Invalidate the "next" position to prevent further read attempts
 			CurrentReadOffset = Source.OuterLength;
+			DecryptOffset = -1;
 			Data.Resize(0);
 			return 0;
 		}
 
+		DecryptOffset = Offset + Size;
 		return Size;
 	}
 
+	// Update the current hash if we are calculating one
+	if(ReadHasher) ReadHasher->HashData(Data);
+
 	// Decrypt by making a copy
 	DataChunkPtr NewData = Decrypt->Decrypt(Data);
 	if(!NewData)
 	{
 		// Invalidate the "next" position to prevent further read attempts
 		CurrentReadOffset = Source.OuterLength;
+		DecryptOffset = -1;
 		Data.Resize(0);
 		return 0;
 	}
@@ -738,10 +834,45 @@ size_t KLVEObject::ReadChunkedCryptoDataFrom(Position Offset, size_t Size)
 	// Take over the buffer from the decrypted data
 	Data.TakeBuffer(NewData);
 
+	DecryptOffset = Offset + Size;
 	return Size;
 }
 
 
+//! Re-start the CBC decryption chain at a given block of the encrypted portion of the KLV value field
+/*! \param Offset Offset from the start of the KLV value of the block to be decrypted next, (Offset - PlaintextOffset) must be a multiple of 16
+ *  \return false on error, else true
+ *  In CBC mode the IV for any block is the ciphertext of the previous block (or the encrypted check value for the first block),
+ *  so loading that as the IV allows decryption to start at any block without decrypting everything before it.
+ */
+bool KLVEObject::SeekDecrypt(Position Offset)
+{
+	if((Offset < PlaintextOffset) || (((Offset - PlaintextOffset) % EncryptionGranularity) != 0))
+	{
+		error("KLVEObject::SeekDecrypt() called with an offset that is not the start of an encrypted block\n");
+		return false;
+	}
+
+	// The check value is the ciphertext block immediately before the first encrypted byte
+	Position IVPos;
+	if(Offset == PlaintextOffset) IVPos = DataOffset - EncryptionGranularity;
+	else IVPos = DataOffset + Offset - EncryptionGranularity;
+
+	DataChunk IV;
+	if(Base_ReadDataFrom(IV, IVPos, EncryptionGranularity) != EncryptionGranularity)
+	{
+		error("Unable to read the previous cipher block in KLVEObject::SeekDecrypt()\n");
+		DecryptOffset = -1;
+		return false;
+	}
+
+	Decrypt->SetIV(EncryptionGranularity, IV.Data, true);
+	DecryptOffset = Offset;
+
+	return true;
+}
+
+
 //! Write data from a given buffer to a given location in the destination file
 /*! \param Buffer Pointer to data to be written
  *  \param Offset The offset within the KLV value field of the first byte to write
@@ -817,19 +948,9 @@ size_t KLVEObject::WriteDataTo(const UInt8 *Buffer, Position Offset, size_t Size
 
 		// ** Write the check value
 
-		// Encrypt the check value... (Which is "CHUKCHUKCHUKCHUK" who ever said Chuck Harrison has no ego?)
+		// Encrypt and write the check value... (Which is "CHUKCHUKCHUKCHUK" who ever said Chuck Harrison has no ego?)
 		const UInt8 PlainCheck[16] = { 0x43, 0x48, 0x55, 0x4B, 0x43, 0x48, 0x55, 0x4B, 0x43, 0x48, 0x55, 0x4B, 0x43, 0x48, 0x55, 0x4B };
-		DataChunkPtr CheckData = Encrypt->Encrypt(16, PlainCheck);
-
-		// Write the encrypted check value
-		if(CheckData && (CheckData->Size == 16))
-		{
-			Base_WriteDataTo(CheckData->Data, DataOffset - EncryptionOverhead + 16, 16);
-
-			// Update the current hash if we are calculating one
-			if(WriteHasher) WriteHasher->HashData(CheckData);
-		}
-		else
+		if(EncryptAndWrite(PlainCheck, 16 - EncryptionOverhead, 16) != 16)
 		{
 			error("Could not encrypt check value - encryption system is not working correctly\n");
 		}
@@ -937,9 +1058,6 @@ size_t KLVEObject::WriteDataTo(const UInt8 *Buffer, Position Offset, size_t Size
  */
 size_t KLVEObject::WriteCryptoDataTo(const UInt8 *Buffer, Position Offset, size_t Size)
 {
-	// Self-deleting store to allow us to extend working buffer if required
-	DataChunk TempData;
-
 	// Are we going to need to write padding bytes?
 	bool AddPadding;
 	if(static_cast<Length>(Offset + Size) >= ValueLength) AddPadding = true; else AddPadding = false;
@@ -954,7 +1072,8 @@ size_t KLVEObject::WriteCryptoDataTo(const UInt8 *Buffer, Position Offset, size_
 	if((!AddPadding) && (Size < static_cast<size_t>(EncryptionGranularity - AwaitingEncryption)))
 	{
 		// Add to the end of the waiting buffer
-		memcpy(&AwaitingEncryptionBuffer[AwaitingEncryption], Data.Data, Size);
+		memcpy(&AwaitingEncryptionBuffer[AwaitingEncryption], Buffer, Size);
+		AwaitingEncryption += static_cast<int>(Size);
 
 		// All done
 		return Size;
@@ -966,17 +1085,18 @@ size_t KLVEObject::WriteCryptoDataTo(const UInt8 *Buffer, Position Offset, size_
 	// If there are any bytes waiting they need to be added to this write
 	if(AwaitingEncryption)
 	{
-		// Build the full data in the temporary buffer
-		TempData.ResizeBuffer(AwaitingEncryption + Size);
+		// Build the full data in the working buffer (discarding old contents so they are not copied if it grows)
+		WorkBuffer.Size = 0;
+		WorkBuffer.ResizeBuffer(AwaitingEncryption + Size, false);
 
 		// Start with "waiting" data
-		TempData.Set(AwaitingEncryption, AwaitingEncryptionBuffer);
+		WorkBuffer.Set(AwaitingEncryption, AwaitingEncryptionBuffer);
 
 		// Copy in the new data
-		TempData.Append(Size, Buffer);
+		WorkBuffer.Append(Size, Buffer);
 
-		// Replace the working buffer pointer with a pointer to the temporary buffer
-		Buffer = TempData.Data;
+		// Replace the buffer pointer with a pointer to the working buffer
+		Buffer = WorkBuffer.Data;
 
 		// Update the offset (move it back to the first waiting byte)
 		Offset -= AwaitingEncryption;
@@ -1007,16 +1127,9 @@ size_t KLVEObject::WriteCryptoDataTo(const UInt8 *Buffer, Position Offset, size_
 		// Don't write zero bytes
 		if(StartSize)
 		{
-			// Encrypt by making a copy
-			DataChunkPtr NewData = Encrypt->Encrypt(static_cast<size_t>(StartSize), Buffer);
-			if(!NewData) return 0;
-
-			// Write the encrypted data
-			Base_WriteDataTo(NewData->Data, DataOffset + Offset, static_cast<size_t>(StartSize));
-
-			// Update the current hash if we are calculating one
-			// TODO: Sort the possible overflow here
-			if(WriteHasher) WriteHasher->HashData(static_cast<size_t>(StartSize), NewData->Data);
+			// Encrypt and write the data
+			// DRAGONS: If Buffer is the WorkBuffer only the first StartSize bytes are encrypted, leaving the rest for below
+			if(!EncryptAndWrite(Buffer, Offset, static_cast<size_t>(StartSize))) return 0;
 		}
 
 		// Buffer for last data to be encrypted
@@ -1035,15 +1148,8 @@ size_t KLVEObject::WriteCryptoDataTo(const UInt8 *Buffer, Position Offset, size_
 			else *(pDst++) = (UInt8)Pad;
 		}
 
-		// Encrypt by making a copy
-		DataChunkPtr NewData = Encrypt->Encrypt(EncryptionGranularity, TempBuffer);
-		if(!NewData) return 0;
-
-		// Write the encrypted data
-		Base_WriteDataTo(NewData->Data, DataOffset + Offset + StartSize, EncryptionGranularity);
-
-		// Update the current hash if we are calculating one
-		if(WriteHasher) WriteHasher->HashData(EncryptionGranularity, NewData->Data);
+		// Encrypt and write the last chunk
+		if(!EncryptAndWrite(TempBuffer, Offset + StartSize, EncryptionGranularity)) return 0;
 
 		// There are no more bytes to encrypt
 		AwaitingEncryption = 0;
@@ -1067,22 +1173,15 @@ size_t KLVEObject::WriteCryptoDataTo(const UInt8 *Buffer, Position Offset, size_
 	// Any differnece will be "left-over"
 	AwaitingEncryption = static_cast<int>(BytesRequiringEncryption - BytesToEncrypt);
 
-	// Encrypt by making a copy
-	DataChunkPtr NewData = Encrypt->Encrypt(static_cast<size_t>(BytesToEncrypt), Buffer);
-	if(!NewData) return 0;
-
 	// If there will be any "left-over" bytes they will be awaiting next time
 	if(AwaitingEncryption)
 	{
 		memcpy(AwaitingEncryptionBuffer, &Buffer[BytesToEncrypt], AwaitingEncryption);
 	}
 
-	// Write the encrypted data
-	Size = Base_WriteDataTo(NewData->Data, DataOffset + Offset, static_cast<size_t>(BytesToEncrypt));
-
-	// Update the current hash if we are calculating one
-	// TODO: Sort the possible overflow here
-	if(WriteHasher) WriteHasher->HashData(Size, NewData->Data);
+	// Encrypt and write the data
+	Size = EncryptAndWrite(Buffer, Offset, static_cast<size_t>(BytesToEncrypt));
+	if(!Size) return 0;
 
 	// Chain the IV for next time...
 	EncryptionIV = Encrypt->GetIV();
@@ -1093,6 +1192,45 @@ size_t KLVEObject::WriteCryptoDataTo(const UInt8 *Buffer, Position Offset, size_
 
 
 
+//! Encrypt a given buffer and write it to a given location in the destination file
+/*! \param Buffer Pointer to data to be encrypted, this is not modified unless it is the WorkBuffer
+ *  \param Offset The offset within the KLV value field of the first byte to write
+ *  \param Size The number of bytes to encrypt and write
+ *  \return The number of bytes written
+ */
+size_t KLVEObject::EncryptAndWrite(const UInt8 *Buffer, Position Offset, size_t Size)
+{
+	if(Encrypt->CanEncryptInPlace(Size))
+	{
+		// Copy the data into the working buffer unless that is where it already is
+		// DRAGONS: Setting the size to zero first prevents old data being copied if the buffer is reallocated
+		if(Buffer != WorkBuffer.Data)
+		{
+			WorkBuffer.Size = 0;
+			WorkBuffer.Set(Size, Buffer);
+		}
+
+		// Encrypt in place, updating the current hash (if we are calculating one) as we go
+		if(!Encrypt->EncryptAndHashInPlace(Size, WorkBuffer.Data, WriteHasher.GetPtr())) return 0;
+
+		// Write the encrypted data
+		return Base_WriteDataTo(WorkBuffer.Data, DataOffset + Offset, Size);
+	}
+
+	// Encrypt by making a copy
+	DataChunkPtr NewData = Encrypt->Encrypt(Size, Buffer);
+	if(!NewData) return 0;
+
+	// Write the encrypted data
+	size_t Ret = Base_WriteDataTo(NewData->Data, DataOffset + Offset, Size);
+
+	// Update the current hash if we are calculating one
+	if(WriteHasher) WriteHasher->HashData(Ret, NewData->Data);
+
+	return Ret;
+}
+
+
 //! Write the key and length of the current DataChunk to the destination file
 /*! The key and length will be written to the source file as set by SetSource.
  *  If LenSize is zero the length will be formatted to match KLSize (if possible!)
@@ -37,11 +37,16 @@
 // Forward refs
 namespace mxflib
 {
+	class Hash_Base;
 }
 
 
 namespace mxflib
 {
+	//! Size of the sections used when combining encryption or decryption with hashing
+	/*! Small enough for each section to still be in the cache when it is hashed, and a multiple of all common cipher block sizes */
+	const size_t CryptoBlockSize = 32 * 1024;
+
 	//! Base encryptor wrapper class
 	/*! \note Classes derived from this class <b>must not</b> include their own RefCount<> derivation
 	 */
@@ -124,6 +129,15 @@ namespace mxflib
 		 */
 		bool EncryptInPlace(DataChunkPtr &Data) { return EncryptInPlace(Data->Size, Data->Data); };
 
+		//! Encrypt data bytes in place and add the encrypted bytes to a hash
+		/*! The default version works through the data in CryptoBlockSize sections, encrypting then hashing
+		 *  each while it is still in the cache. Derived classes may replace this with a truly combined version.
+		 *  \param Hasher The hash to update, or NULL to encrypt only
+		 *  \return true if the encryption is successful
+		 *  \note This must only be called if CanEncryptInPlace() returns true for Size
+		 */
+		virtual bool EncryptAndHashInPlace(size_t Size, UInt8 *Data, Hash_Base *Hasher);
+
 		//! Encrypt data and return in a new buffer
 		/*! \return NULL pointer if the encryption is unsuccessful
 		 */
@@ -226,6 +240,15 @@ namespace mxflib
 		 */
 		bool DecryptInPlace(DataChunkPtr &Data) { return DecryptInPlace(Data->Size, Data->Data); };
 
+		//! Add encrypted data bytes to a hash then decrypt them in place
+		/*! The default version works through the data in CryptoBlockSize sections, hashing then decrypting
+		 *  each while it is still in the cache. Derived classes may replace this with a truly combined version.
+		 *  \param Hasher The hash to update, or NULL to decrypt only
+		 *  \return true if the decryption <i>appears to be</i> successful
+		 *  \note This must only be called if CanDecryptInPlace() returns true for Size
+		 */
+		virtual bool HashAndDecryptInPlace(size_t Size, UInt8 *Data, Hash_Base *Hasher);
+
 		//! Decrypt data and return in a new buffer
 		/*! \return NULL pointer if the decryption is unsuccessful
 		 */
@@ -338,6 +361,8 @@ namespace mxflib
 		Position CurrentReadOffset;					//!< The location of the next read (if reading in sequence) - used to detect random access attempts
 		Position CurrentWriteOffset;				//!< The location of the next write (if writing in sequence) - used to detect random access attempts
 
+		Position DecryptOffset;						//!< The value offset of the encrypted block that the decryption wrapper's CBC chain is ready for (-1 if not yet set)
+
 		int PreDecrypted;							//!< Number of extra bytes decrypted last time that are buffer for the next read
 		UInt8 PreDecryptBuffer[EncryptionGranularity];
 													//!< Left over bytes from decrypting the last chunk - these will be returned first with the next read call
@@ -346,6 +371,8 @@ namespace mxflib
 		UInt8 AwaitingEncryptionBuffer[EncryptionGranularity];
 													//!< Left over bytes from encrypting the last chunk - these will be written first at the next write call
 
+		DataChunk WorkBuffer;						//!< Working buffer used to encrypt in place, kept between writes to save reallocating it
+
 		UInt32 FooterLength;						//!< The size of the AS-DCP footer to be written for this KLVEObject
 
 	public:
@@ -573,9 +600,18 @@ namespace mxflib
 		 *  \param Size Number of bytes to read, if -1 all available bytes will be read (which could be billions!)
 		 *  \return The number of bytes read
 		 *	The IV must have already been set, Size must be a multiple of 16 as must (Offset - PlaintextOffset). 
+		 *  If Offset is not the block following the last one decrypted the IV is re-loaded from the previous block (not allowed when hashing).
 		 *  Only encrypted parts of the value may be read using this function (i.e. Offset >= PlaintextOffset)
 		 */
 		size_t ReadChunkedCryptoDataFrom(Position Offset, size_t Size);
+
+		//! Re-start the CBC decryption chain at a given block of the encrypted portion of the KLV value field
+		/*! \param Offset Offset from the start of the KLV value of the block to be decrypted next, (Offset - PlaintextOffset) must be a multiple of 16
+		 *  \return false on error, else true
+		 *  In CBC mode the IV for any block is the ciphertext of the previous block (or the encrypted check value for the first block),
+		 *  so loading that as the IV allows decryption to start at any block without decrypting everything before it.
+		 */
+		bool SeekDecrypt(Position Offset);
 	
 		//! Write encrypted data from a given buffer to a given location in the destination file
 		/*! \param Buffer Pointer to data to be written
@@ -586,24 +622,54 @@ namespace mxflib
 		 *  Only encrypted parts of the value may be written using this function (i.e. Offset >= PlaintextOffset)
 		 */
 		size_t WriteCryptoDataTo(const UInt8 *Buffer, Position Offset, size_t Size);
+
+		//! Encrypt a given buffer and write it to a given location in the destination file
+		/*! \param Buffer Pointer to data to be encrypted, this is not modified unless it is the WorkBuffer
+		 *  \param Offset The offset within the KLV value field of the first byte to write
+		 *  \param Size The number of bytes to encrypt and write
+		 *  \return The number of bytes written
+		 *  The data is encrypted in the WorkBuffer if the encryption wrapper can encrypt in place,
+		 *  otherwise a new encrypted copy is made. The written bytes are added to the write hash.
+		 */
+		size_t EncryptAndWrite(const UInt8 *Buffer, Position Offset, size_t Size);
 	};
 
 	//! Smart pointer to a KLVEObject (cannot point to KLVObjects)
-	/*! This is required to be a class rather than a typedef to allow casting of the RefCount pointers.
-	 *	KLVEObject is derived from KLVObject which holds the reference counter, so pointer calls requiring a pointer
-	 *  to the reference count object need to be <i>adjusted</i>
+	/*! This is required to be a class rather than a typedef as KLVEObject is derived from KLVObject which
+	 *  holds the reference counter. The pointer is held through the KLVObject reference counter and only
+	 *  the target object is cast when members are accessed.
+	 *  DRAGONS: This used to cast the IRefCount<KLVObject> pointer to an IRefCount<KLVEObject> pointer, which
+	 *           is not a type any object actually has - optimizing compilers may then discard the calls made
+	 *           through it as unreachable
 	 */
-	class KLVEObjectPtr : public SmartPtr<KLVEObject>
+	class KLVEObjectPtr : public SmartPtr<KLVObject>
 	{
 	public:
 		//! Construct a NULL KLVEObjectPtr
-		KLVEObjectPtr() : SmartPtr<KLVEObject>() {}
+		KLVEObjectPtr() : SmartPtr<KLVObject>() {}
 
 		//! Construct a KLVEObjectPtr initialized to point to an existing object
-		KLVEObjectPtr(IRefCount<KLVObject> * ptr) : SmartPtr<KLVEObject>((IRefCount<KLVEObject>*)ptr) {};
+		KLVEObjectPtr(IRefCount<KLVObject> * ptr) : SmartPtr<KLVObject>(ptr) {};
 
 		//! Assign pointer or NULL
-		KLVEObjectPtr & operator = (IRefCount<KLVObject> * ptr) {__Assign((IRefCount<KLVEObject>*)ptr); return *this;}
+		KLVEObjectPtr & operator = (IRefCount<KLVObject> * ptr) {__Assign(ptr); return *this;}
+
+		//! Get the contained pointer
+		KLVEObject *GetPtr() const { return static_cast<KLVEObject*>(SmartPtr<KLVObject>::GetPtr()); }
+
+		//! Give access to members of KLVEObject
+		KLVEObject * operator ->()
+		{
+			mxflib_assert(GetPtr()!=NULL);
+			return GetPtr();
+		}
+
+		//! Give const access to members of KLVEObject
+		const KLVEObject * operator ->() const
+		{
+			mxflib_assert(GetPtr()!=NULL);
+			return GetPtr();
+		}
 	};
 }
 
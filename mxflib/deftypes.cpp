@@ -147,6 +147,373 @@ namespace mxflib_deftypes
 }
 
 
+// Build functions used by both normal and lazy dictionary loading
+static int BuildTypes(TypeRecordList &TypesData, SymbolSpacePtr DefaultSymbolSpace);
+static int BuildClasses(ClassRecordList &ClassesData, SymbolSpacePtr DefaultSymbolSpace);
+
+//! Current generation of the shared dictionary, incremented each time types or classes are built into it
+static int DictionaryGeneration = 0;
+
+//! Record that types or classes are about to be built
+/*! DRAGONS: Once the dictionary is frozen, types and classes are built into the overlay active on this thread, so only
+ *           the generation of that overlay is changed - reader threads must not modify the shared count
+ */
+static void NextDictionaryGeneration(void)
+{
+	if(!MDOType::IsFrozen()) DictionaryGeneration++;
+	else if(DictionaryOverlay::GetCurrent()) DictionaryOverlay::GetCurrent()->Generation++;
+}
+
+
+/* Lazy dictionary loading - used when FeatureLazyDictionary is set */
+namespace
+{
+	//! A type definition held by lazy dictionary loading until the type is first found
+	class LazyType : public RefCount<LazyType>
+	{
+	public:
+		TypeRecordPtr Record;				//!< The record that will define this type, NULL once built
+		bool Built;							//!< Set once the type has been built (or an attempt has been made)
+
+	public:
+		LazyType(TypeRecordPtr &Record) : Record(Record), Built(false) {}
+	};
+
+	//! A smart pointer to a LazyType
+	typedef SmartPtr<LazyType> LazyTypePtr;
+
+	// Forward declare LazyClass to allow LazyClassPtr to be defined early
+	class LazyClass;
+
+	//! A smart pointer to a LazyClass
+	typedef SmartPtr<LazyClass> LazyClassPtr;
+
+	//! A top-level class definition held by lazy dictionary loading until it, or one of its children, is first found
+	class LazyClass : public RefCount<LazyClass>
+	{
+	public:
+		ClassRecordPtr Record;				//!< The record that will define this class and its children, NULL once built
+		SymbolSpacePtr DefaultSymbolSpace;	//!< The default symbol space in use when this class was loaded
+		std::list<LazyClassPtr> Extensions;	//!< Extensions to this class, made in order once it is built
+		bool Built;							//!< Set once the class has been built (or an attempt has been made)
+
+	public:
+		LazyClass(ClassRecordPtr &Record, SymbolSpacePtr &DefaultSymbolSpace) : Record(Record), DefaultSymbolSpace(DefaultSymbolSpace), Built(false) {}
+	};
+
+	ULHashMap<LazyTypePtr> LazyTypeLookup;			//!< Types held by lazy loading, by UL
+	std::list<LazyTypePtr> LazyTypes;				//!< Types held by lazy loading, in load order
+	size_t LazyTypeCount = 0;						//!< Number of types held by lazy loading that are not yet built
+
+	ULHashMap<LazyClassPtr> LazyClassLookup;		//!< Classes held by lazy loading, by the UL of each class and each of its children
+	std::list<LazyClassPtr> LazyClasses;			//!< Top-level classes held by lazy loading, in load order
+	size_t LazyClassCount = 0;						//!< Number of top-level classes held by lazy loading that are not yet built
+
+	//! Set while the internally required types and classes are loaded, these are always built straight away
+	bool DefiningInternals = false;
+
+
+	//! Hold a type record for lazy building if possible
+	/*! \return true if the record is held, false if it should be built now
+	 */
+	bool DeferType(TypeRecordPtr &ThisType)
+	{
+		// Labels are added as they are loaded, and types without a UL cannot be found until a UUID is generated for them
+		if(!ThisType->UL) return false;
+		if((ThisType->Class == TypeLabel) || (ThisType->Class == TypeSymbolSpace)) return false;
+
+		// Extensions of existing types are made in order, so build them now (this will first build any type they extend)
+		if(LazyTypeLookup.FindVersionless(*ThisType->UL) || MDType::Find(ThisType->UL)) return false;
+
+		LazyTypePtr Entry = new LazyType(ThisType);
+		LazyTypeLookup.Set(*ThisType->UL, Entry);
+		LazyTypes.push_back(Entry);
+		LazyTypeCount++;
+
+		// Add the name now so that finding the type by name will build it
+		ThisType->SymSpace->AddSymbol(ThisType->Type, ThisType->UL);
+
+		return true;
+	}
+
+
+	//! Build a type held by lazy dictionary loading
+	void BuildLazy(LazyTypePtr Entry)
+	{
+		// DRAGONS: Flag as built first as building may find this type again (for example if it is an unresolvable base)
+		Entry->Built = true;
+		LazyTypeCount--;
+
+		TypeRecordList List;
+		List.push_back(Entry->Record);
+		Entry->Record = NULL;
+
+		BuildTypes(List, List.front()->SymSpace);
+	}
+
+
+	//! Determine if all classes in a class record, and in any of its children, have a UL
+	/*! \param CheckThis - If false only the children are checked
+	 */
+	bool AllHaveULs(ClassRecordPtr &ThisClass, bool CheckThis = true)
+	{
+		if(CheckThis && !ThisClass->UL) return false;
+
+		ClassRecordList::iterator it = ThisClass->Children.begin();
+		while(it != ThisClass->Children.end())
+		{
+			if(!AllHaveULs(*it)) return false;
+			it++;
+		}
+
+		return true;
+	}
+
+
+	//! Index a class record, and any of its children, for lazy building
+	void IndexClass(LazyClassPtr &Entry, ClassRecordPtr &ThisClass, SymbolSpacePtr &DefaultSymbolSpace, std::string RootName)
+	{
+		// DRAGONS: An item may be a child of more than one set, the first definition is the one that builds it
+		LazyClassLookup.Insert(*ThisClass->UL, Entry);
+
+		// Add the name now so that finding the class by name will build it - this matches the name added by MDOType::DefineClass()
+		SymbolSpacePtr ThisSymbolSpace = ThisClass->SymSpace ? ThisClass->SymSpace : DefaultSymbolSpace;
+		ThisSymbolSpace->AddSymbol(RootName + ThisClass->Name, ThisClass->UL);
+
+		// Arrays and vectors are converted to array types, so their children do not become classes
+		if((ThisClass->Class == ClassArray) || (ThisClass->Class == ClassVector)) return;
+
+		ClassRecordList::iterator it = ThisClass->Children.begin();
+		while(it != ThisClass->Children.end())
+		{
+			IndexClass(Entry, *it, ThisSymbolSpace, RootName + ThisClass->Name + "/");
+			it++;
+		}
+	}
+
+
+	//! Hold an extension for lazy building with the class it extends, if that class is not yet built
+	/*! \return true if the extension is held, false if it should be made now
+	 */
+	bool DeferExtension(ClassRecordPtr &ThisClass, SymbolSpacePtr &DefaultSymbolSpace)
+	{
+		SymbolSpacePtr ThisSymbolSpace = ThisClass->SymSpace ? ThisClass->SymSpace : DefaultSymbolSpace;
+
+		// Locate the class being extended - by UL if known, otherwise by name, as done by MDOType::DefineClass()
+		ULPtr TargetUL = ThisClass->UL;
+		if(!TargetUL) TargetUL = ThisSymbolSpace->Find(ThisClass->Name);
+		if(!TargetUL) return false;
+
+		// Only extensions to top-level classes that are held, but not yet built, can be held
+		const LazyClassPtr *Found = LazyClassLookup.FindVersionless(*TargetUL);
+		if((!Found) || (*Found)->Built) return false;
+
+		// DRAGONS: Take a copy as the lookup may be re-organized when the new children are indexed
+		LazyClassPtr Target = *Found;
+
+		// Only extensions to a top-level class whose new children are all findable by UL can be held.
+		// Otherwise build the extended class now, so that this extension is made after any already held for it
+		if(   (!ULHashMap<LazyClassPtr>::MatchesVersionless(Target->Record->UL->GetValue(), TargetUL->GetValue()))
+		   || (!AllHaveULs(ThisClass, false)))
+		{
+			MDOType::Find(TargetUL);
+			return false;
+		}
+
+		Target->Extensions.push_back(new LazyClass(ThisClass, DefaultSymbolSpace));
+
+		// Index the new children so that finding one of them builds the extended class
+		ClassRecordList::iterator it = ThisClass->Children.begin();
+		while(it != ThisClass->Children.end())
+		{
+			IndexClass(Target, *it, ThisSymbolSpace, ThisClass->Name + "/");
+			it++;
+		}
+
+		return true;
+	}
+
+
+	//! Hold a top-level class record for lazy building if possible
+	/*! \return true if the record is held, false if it should be built now
+	 */
+	bool DeferClass(ClassRecordPtr &ThisClass, SymbolSpacePtr &DefaultSymbolSpace)
+	{
+		if(ThisClass->Parent) return false;
+
+		if(ThisClass->Class == ClassExtend) return DeferExtension(ThisClass, DefaultSymbolSpace);
+
+		// Otherwise only new sets, packs and items are deferred - orphaned children and renames are built in order
+		if((ThisClass->Class != ClassSet) && (ThisClass->Class != ClassPack) && (ThisClass->Class != ClassItem)) return false;
+
+		// Classes without a UL cannot be found until a UUID is generated for them
+		if(!AllHaveULs(ThisClass)) return false;
+
+		// Redefinitions of existing classes are made in order, so build them now (this will first build any class they redefine)
+		if(LazyClassLookup.FindVersionless(*ThisClass->UL) || MDOType::Find(ThisClass->UL)) return false;
+
+		LazyClassPtr Entry = new LazyClass(ThisClass, DefaultSymbolSpace);
+		IndexClass(Entry, ThisClass, DefaultSymbolSpace, "");
+		LazyClasses.push_back(Entry);
+		LazyClassCount++;
+
+		return true;
+	}
+
+
+	//! Build a top-level class held by lazy dictionary loading
+	void BuildLazy(LazyClassPtr Entry)
+	{
+		// DRAGONS: Flag as built first as building will find this class and its children again
+		Entry->Built = true;
+		LazyClassCount--;
+
+		ClassRecordList List;
+		List.push_back(Entry->Record);
+		Entry->Record = NULL;
+
+		BuildClasses(List, Entry->DefaultSymbolSpace);
+
+		// Now make any extensions, in the order they were loaded
+		std::list<LazyClassPtr>::iterator it = Entry->Extensions.begin();
+		while(it != Entry->Extensions.end())
+		{
+			ClassRecordList ExtensionList;
+			ExtensionList.push_back((*it)->Record);
+
+			BuildClasses(ExtensionList, (*it)->DefaultSymbolSpace);
+			it++;
+		}
+
+		Entry->Extensions.clear();
+	}
+
+
+	//! Add the tags from a class record, and any of its children, to a primer
+	void AddTags(Primer *ThisPrimer, ClassRecordPtr &ThisClass)
+	{
+		if(ThisClass->Tag) ThisPrimer->insert(Primer::value_type(ThisClass->Tag, *ThisClass->UL));
+
+		ClassRecordList::iterator it = ThisClass->Children.begin();
+		while(it != ThisClass->Children.end())
+		{
+			AddTags(ThisPrimer, *it);
+			it++;
+		}
+	}
+}
+
+
+// DRAGONS: namespace mxflib_deftypes is semi-privat eto allow legacytypes.cpp to access items
+namespace mxflib_deftypes
+{
+	//! Build the type with a given UL if it is held by lazy dictionary loading
+	/*! \return true if the type was built, it can then be found in the usual way */
+	bool BuildLazyType(const UL &TypeUL)
+	{
+		if(!LazyTypeCount) return false;
+
+		const LazyTypePtr *Entry = LazyTypeLookup.FindVersionless(TypeUL);
+		if((!Entry) || (*Entry)->Built) return false;
+
+		BuildLazy(*Entry);
+		return true;
+	}
+
+
+	//! Build the class with a given UL if it is held by lazy dictionary loading, along with the rest of its top-level class
+	/*! \return true if the class was built, it can then be found in the usual way */
+	bool BuildLazyClass(const UL &ClassUL)
+	{
+		if(!LazyClassCount) return false;
+
+		const LazyClassPtr *Entry = LazyClassLookup.FindVersionless(ClassUL);
+		if((!Entry) || (*Entry)->Built) return false;
+
+		BuildLazy(*Entry);
+		return true;
+	}
+
+
+	//! Determine if any classes are held by lazy dictionary loading and not yet built
+	bool HasLazyClasses(void)
+	{
+		return LazyClassCount != 0;
+	}
+
+
+	//! Add the tags of all classes held by lazy dictionary loading to a primer
+	void AddLazyTags(Primer *ThisPrimer)
+	{
+		if(!LazyClassCount) return;
+
+		std::list<LazyClassPtr>::iterator it = LazyClasses.begin();
+		while(it != LazyClasses.end())
+		{
+			if(!(*it)->Built)
+			{
+				AddTags(ThisPrimer, (*it)->Record);
+
+				std::list<LazyClassPtr>::iterator Ext_it = (*it)->Extensions.begin();
+				while(Ext_it != (*it)->Extensions.end())
+				{
+					AddTags(ThisPrimer, (*Ext_it)->Record);
+					Ext_it++;
+				}
+			}
+
+			it++;
+		}
+	}
+
+
+	//! Discard all classes held by lazy dictionary loading
+	void ClearLazyClasses(void)
+	{
+		LazyClassLookup.clear();
+		LazyClasses.clear();
+		LazyClassCount = 0;
+	}
+}
+
+
+//! Build all types and classes that are still held by lazy dictionary loading
+void mxflib::BuildLazyDictionary(void)
+{
+	// DRAGONS: Building may build other held entries, so the Built flag is checked for each one
+	std::list<LazyTypePtr>::iterator Type_it = LazyTypes.begin();
+	while(Type_it != LazyTypes.end())
+	{
+		if(!(*Type_it)->Built) BuildLazy(*Type_it);
+		Type_it++;
+	}
+
+	std::list<LazyClassPtr>::iterator Class_it = LazyClasses.begin();
+	while(Class_it != LazyClasses.end())
+	{
+		if(!(*Class_it)->Built) BuildLazy(*Class_it);
+		Class_it++;
+	}
+
+	// Everything is now built, so the index is no longer needed
+	LazyTypeLookup.clear();
+	LazyTypes.clear();
+	ClearLazyClasses();
+
+	// Locate reference target types for the new classes
+	MDOType::LocateRefTypes();
+}
+
+
+//! Get the current generation of the loaded dictionary
+int mxflib::GetDictionaryGeneration(void)
+{
+	// The shared dictionary does not change once frozen, so this only changes with the overlay for this thread
+	DictionaryOverlay *Overlay = DictionaryOverlay::GetCurrent();
+	return Overlay ? (DictionaryGeneration + Overlay->Generation) : DictionaryGeneration;
+}
+
+
 //! Load types from the specified in-memory definitions
 /*! \note The last entry in the array must be a terminating entry with Class == TypeNULL
  *  \return 0 if all OK
@@ -289,20 +656,64 @@ void MDOType::DefineInternals(void)
 	// DRAGONS: We set the "inited" flag first as otherwise the test in LoadTypes() will cause infinite recursion!
 	InternalsDefined = true;
 
+	DefiningInternals = true;
 	LoadTypes(BasicInternalTypes);
 	LoadClasses(BasicInternalClasses, MXFLibSymbols);
+	DefiningInternals = false;
 
 	// Define the known traits if required
 	if(LoadBuiltInTraits) DefineTraits();
 }
 
 
+//! Freeze the loaded dictionary so that files may be parsed on several threads at once
+void mxflib::FreezeDictionary(void)
+{
+	MDOType::Freeze();
+}
+
+
 //! Load types from the specified in-memory definitions
-/*! \return 0 if all OK
+/*! If FeatureLazyDictionary is set most types are not built until they are first found
+ *  \return 0 if all OK
  *  \return -1 on error
  */
 int mxflib::LoadTypes(TypeRecordList &TypesData, SymbolSpacePtr DefaultSymbolSpace /*=MXFLibSymbols*/)
 {
+	// DRAGONS: Lazy building would modify the shared dictionary, so it is not used once frozen
+	if((!Feature(FeatureLazyDictionary)) || MDOType::IsFrozen() || DefiningInternals) return BuildTypes(TypesData, DefaultSymbolSpace);
+
+	//! Check if we have required internal items defined
+	if(!MDOType::GetInternalsDefined()) MDOType::DefineInternals();
+
+	//! List of types that cannot be deferred and are to be built now
+	TypeRecordList BuildNow;
+
+	TypeRecordList::iterator it = TypesData.begin();
+	while(it != TypesData.end())
+	{
+		// Set the symbol space
+		if(!(*it)->SymSpace) (*it)->SymSpace = DefaultSymbolSpace;
+
+		if(!DeferType(*it)) BuildNow.push_back(*it);
+		it++;
+	}
+
+	if(BuildNow.empty()) return 0;
+
+	return BuildTypes(BuildNow, DefaultSymbolSpace);
+}
+
+
+//! Build types from the specified in-memory definitions
+/*! This function is called by LoadTypes() and is recursive
+ *  \return 0 if all OK
+ *  \return -1 on error
+ */
+static int BuildTypes(TypeRecordList &TypesData, SymbolSpacePtr DefaultSymbolSpace)
+{
+	NextDictionaryGeneration();
+
 	//! Check if we have required internal items defined
 	if(!MDOType::GetInternalsDefined()) MDOType::DefineInternals();
 
@@ -331,6 +742,14 @@ int mxflib::LoadTypes(TypeRecordList &TypesData, SymbolSpacePtr DefaultSymbolSpa
 		MDTypePtr Ptr = MDType::Find((*it)->UL);
 		bool Extending = Ptr ? true : false;
 
+		// Types in a frozen dictionary are not changed - the shared definition is used as it is
+		if(Extending && MDType::IsShared(Ptr))
+		{
+			debug("Not extending %s as the dictionary is frozen\n", Ptr->Name().c_str());
+			it++;
+			continue;
+		}
+
 		if(Extending && (!(*it)->Type.empty()) && ((*it)->Type != Ptr->Name()))
 		{
 			warning("%s is assigned to type %s - the dictionary entry named %s has the same identifier so simply updates parts of the definition\n",
@@ -631,6 +1050,13 @@ int mxflib::LoadTypes(TypeRecordList &TypesData, SymbolSpacePtr DefaultSymbolSpa
 			// Label definition
 			case TypeLabel:
 			{
+				// DRAGONS: Labels are only held in the shared dictionary, so cannot be added once it is frozen
+				if(MDOType::IsFrozen())
+				{
+					debug("Label %s not added as the dictionary is frozen\n", (*it)->Type.c_str());
+					break;
+				}
+
 				UInt8 *Mask = NULL;
 				UInt8 MaskData[16];
 
@@ -689,7 +1115,7 @@ int mxflib::LoadTypes(TypeRecordList &TypesData, SymbolSpacePtr DefaultSymbolSpa
 		}
 
 		// Recurse...
-		LoadTypes(Unresolved);
+		BuildTypes(Unresolved, DefaultSymbolSpace);
 	}
 
 	// All done OK
@@ -719,11 +1145,50 @@ namespace
 
 
 //! Load classes from the specified in-memory definitions
-/*! \return 0 if all OK
+/*! If FeatureLazyDictionary is set most classes are not built until they, or one of their children, are first found
+ *  \return 0 if all OK
  *  \return -1 on error
  */
 int mxflib::LoadClasses(ClassRecordList &ClassesData, SymbolSpacePtr DefaultSymbolSpace /*=MXFLibSymbols*/)
 {
+	int Ret;
+
+	// DRAGONS: Lazy building would modify the shared dictionary, so it is not used once frozen
+	if((!Feature(FeatureLazyDictionary)) || MDOType::IsFrozen() || DefiningInternals)
+	{
+		Ret = BuildClasses(ClassesData, DefaultSymbolSpace);
+	}
+	else
+	{
+		//! List of classes that cannot be deferred and are to be built now
+		ClassRecordList BuildNow;
+
+		ClassRecordList::iterator it = ClassesData.begin();
+		while(it != ClassesData.end())
+		{
+			if(!DeferClass(*it, DefaultSymbolSpace)) BuildNow.push_back(*it);
+			it++;
+		}
+
+		Ret = BuildNow.empty() ? 0 : BuildClasses(BuildNow, DefaultSymbolSpace);
+	}
+
+	// Build a static primer (for use in index tables) - this includes the tags of any classes not yet built
+	MDOType::MakePrimer(true);
+
+	return Ret;
+}
+
+
+//! Build classes from the specified in-memory definitions
+/*! This function is called by LoadClasses() and is recursive
+ *  \return 0 if all OK
+ *  \return -1 on error
+ */
+static int BuildClasses(ClassRecordList &ClassesData, SymbolSpacePtr DefaultSymbolSpace)
+{
+	NextDictionaryGeneration();
+
 	//! List to hold any entries that are not resolved during this pass (we will recurse to resolve them at the end of the pass)
 	ClassRecordList Unresolved;
 
@@ -767,12 +1232,9 @@ int mxflib::LoadClasses(ClassRecordList &ClassesData, SymbolSpacePtr DefaultSymb
 		}
 
 		// Recurse...
-		LoadClasses(Unresolved, DefaultSymbolSpace);
+		BuildClasses(Unresolved, DefaultSymbolSpace);
 	}
 
-	// Build a static primer (for use in index tables)
-	MDOType::MakePrimer(true);
-
 	return 0;
 }
 
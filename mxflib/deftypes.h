@@ -466,7 +466,7 @@ namespace mxflib
 
 //! UnknownType
 const UInt8 UnknownType_UL_Data[16] = { 0x8f, 0x64, 0x35, 0x9b, 0xfe, 0x75, 0x36, 0x89, 0x8c, 0x4e, 0x57, 0x91, 0xcd, 0x68, 0x6c, 0xe4 };
-const UL UnknownType_UL(UnknownType_UL_Data);
+const ULConst UnknownType_UL = { UnknownType_UL_Data };
 
 
 /* Example usage:
@@ -1086,6 +1086,26 @@ namespace mxflib
 		return LoadDictionaryFromXML(strXML, "", FastFail);
 	}
 
+	//! Freeze the loaded dictionary so that files may be parsed on several threads at once
+	/*! After this call the shared dictionary is not modified - any classes or types defined while reading a file
+	 *  (such as from its metadictionary) are held in a DictionaryOverlay for that file.
+	 *  \note All dictionaries and traits mappings must be loaded before calling this
+	 */
+	void FreezeDictionary(void);
+
+	//! Build all types and classes that are still held by lazy dictionary loading
+	/*! When FeatureLazyDictionary is set, LoadTypes() and LoadClasses() index most definitions by UL and name rather
+	 *  than building them, and each is built the first time it is found. This completes the building of all of them.
+	 */
+	void BuildLazyDictionary(void);
+
+	//! Get the current generation of the loaded dictionary
+	/*! This value changes each time types or classes are built, so may be used to determine if anything derived from
+	 *  the dictionary needs to be rebuilt. Once the dictionary is frozen it only changes when types or classes are built
+	 *  into the DictionaryOverlay active on this thread.
+	 */
+	int GetDictionaryGeneration(void);
+
 
 //! MXFLIB_DICTIONARY_START - Use to start a type definition block
 #define MXFLIB_DICTIONARY_START(Name)		const ConstDictionaryRecord Name[] = {
@@ -1116,6 +1136,23 @@ namespace mxflib_deftypes
 
 	//! Build the map of all known traits
 	void DefineTraits(void);
+
+	//! Build the type with a given UL if it is held by lazy dictionary loading
+	/*! \return true if the type was built, it can then be found in the usual way */
+	bool BuildLazyType(const mxflib::UL &TypeUL);
+
+	//! Build the class with a given UL if it is held by lazy dictionary loading, along with the rest of its top-level class
+	/*! \return true if the class was built, it can then be found in the usual way */
+	bool BuildLazyClass(const mxflib::UL &ClassUL);
+
+	//! Determine if any classes are held by lazy dictionary loading and not yet built
+	bool HasLazyClasses(void);
+
+	//! Add the tags of all classes held by lazy dictionary loading to a primer
+	void AddLazyTags(mxflib::Primer *ThisPrimer);
+
+	//! Discard all classes held by lazy dictionary loading
+	void ClearLazyClasses(void);
 };
 
 #endif // MXFLIB__DICTIONARY_H
@@ -32,6 +32,8 @@
 
 #include "mxflib/system.h"
 
+#include <cstring>						//!< Required for memcpy
+
 namespace mxflib
 {
 	/*
@@ -99,6 +101,44 @@ namespace mxflib
 	inline Int16 GetI16_LE(const unsigned char *src) { return (Int16)GetU16_LE(src); }
 	inline Int32 GetI32_LE(const unsigned char *src) { return (Int32)GetU32_LE(src); }
 	inline Int64 GetI64_LE(const unsigned char *src) { return (Int64)GetU64_LE(src); }
+
+	/*
+	** GetUxxArray() - Get an array of unsigned xx-bit integers
+	**
+	** DRAGONS: Each item is converted on its own, with no dependency between items, so that an optimizing
+	**          compiler can use byte-swap instructions or vectorize the loop
+	*/
+	inline void GetU16Array(UInt16 *Dest, const unsigned char *Src, size_t Count) { for(size_t i = 0; i < Count; i++) Dest[i] = GetU16(&Src[i * 2]); }
+	inline void GetU32Array(UInt32 *Dest, const unsigned char *Src, size_t Count) { for(size_t i = 0; i < Count; i++) Dest[i] = GetU32(&Src[i * 4]); }
+	inline void GetU64Array(UInt64 *Dest, const unsigned char *Src, size_t Count) { for(size_t i = 0; i < Count; i++) Dest[i] = GetU64(&Src[i * 8]); }
+
+	/*
+	** PutUxxArray() - Put an array of unsigned xx-bit integers
+	*/
+	inline void PutU16Array(const UInt16 *Src, unsigned char *Dest, size_t Count) { for(size_t i = 0; i < Count; i++) PutU16(Src[i], &Dest[i * 2]); }
+	inline void PutU32Array(const UInt32 *Src, unsigned char *Dest, size_t Count) { for(size_t i = 0; i < Count; i++) PutU32(Src[i], &Dest[i * 4]); }
+	inline void PutU64Array(const UInt64 *Src, unsigned char *Dest, size_t Count) { for(size_t i = 0; i < Count; i++) PutU64(Src[i], &Dest[i * 8]); }
+
+	/*
+	** GetArrayItems() / PutArrayItems() - Versions of GetUxxArray() and PutUxxArray() overloaded by item type, for use in templates
+	*/
+	inline void GetArrayItems(UInt8 *Dest, const unsigned char *Src, size_t Count) { memcpy(Dest, Src, Count); }
+	inline void GetArrayItems(Int8 *Dest, const unsigned char *Src, size_t Count) { memcpy(Dest, Src, Count); }
+	inline void GetArrayItems(UInt16 *Dest, const unsigned char *Src, size_t Count) { GetU16Array(Dest, Src, Count); }
+	inline void GetArrayItems(Int16 *Dest, const unsigned char *Src, size_t Count) { GetU16Array(reinterpret_cast<UInt16*>(Dest), Src, Count); }
+	inline void GetArrayItems(UInt32 *Dest, const unsigned char *Src, size_t Count) { GetU32Array(Dest, Src, Count); }
+	inline void GetArrayItems(Int32 *Dest, const unsigned char *Src, size_t Count) { GetU32Array(reinterpret_cast<UInt32*>(Dest), Src, Count); }
+	inline void GetArrayItems(UInt64 *Dest, const unsigned char *Src, size_t Count) { GetU64Array(Dest, Src, Count); }
+	inline void GetArrayItems(Int64 *Dest, const unsigned char *Src, size_t Count) { GetU64Array(reinterpret_cast<UInt64*>(Dest), Src, Count); }
+
+	inline void PutArrayItems(const UInt8 *Src, unsigned char *Dest, size_t Count) { memcpy(Dest, Src, Count); }
+	inline void PutArrayItems(const Int8 *Src, unsigned char *Dest, size_t Count) { memcpy(Dest, Src, Count); }
+	inline void PutArrayItems(const UInt16 *Src, unsigned char *Dest, size_t Count) { PutU16Array(Src, Dest, Count); }
+	inline void PutArrayItems(const Int16 *Src, unsigned char *Dest, size_t Count) { PutU16Array(reinterpret_cast<const UInt16*>(Src), Dest, Count); }
+	inline void PutArrayItems(const UInt32 *Src, unsigned char *Dest, size_t Count) { PutU32Array(Src, Dest, Count); }
+	inline void PutArrayItems(const Int32 *Src, unsigned char *Dest, size_t Count) { PutU32Array(reinterpret_cast<const UInt32*>(Src), Dest, Count); }
+	inline void PutArrayItems(const UInt64 *Src, unsigned char *Dest, size_t Count) { PutU64Array(Src, Dest, Count); }
+	inline void PutArrayItems(const Int64 *Src, unsigned char *Dest, size_t Count) { PutU64Array(reinterpret_cast<const UInt64*>(Src), Dest, Count); }
 }
 
 
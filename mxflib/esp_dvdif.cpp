@@ -75,6 +75,9 @@ namespace
 	const UInt32 ID_dmlh = 0x646d6c68;		//! "dmlh"
 
 	const UInt32 ID_00db = 0x30306462;		//! "00db" - the base for video streams
+
+	//! Value of DIFEnd used for raw DV from an input where the end is not known, such as a pipe
+	const Position DIFEndUnknown = INT64_C(0x7fffffffffffffff);
 }
 
 
@@ -86,7 +89,7 @@ namespace
 }
 
 //! Examine the open file and return a list of essence descriptors
-EssenceStreamDescriptorList DV_DIF_EssenceSubParser::IdentifyEssence(FileHandle InFile)
+EssenceStreamDescriptorList DV_DIF_EssenceSubParser::IdentifyEssence(EssenceProbePtr &Probe)
 {
 	int BufferBytes;
 
@@ -96,8 +99,8 @@ EssenceStreamDescriptorList DV_DIF_EssenceSubParser::IdentifyEssence(FileHandle
 	if(!Buffer) Buffer = new UInt8[DV_DIF_BUFFERSIZE];
 
 	// Read the first 12 bytes of the file to allow us to identify it
-	FileSeek(InFile, 0);
-	BufferBytes =(int) FileRead(InFile, Buffer, 12);
+	Probe->Seek(0);
+	BufferBytes =(int) Probe->Read(Buffer, 12);
 
 	// If the file is smaller than 12 bytes give up now!
 	if(BufferBytes < 12) return Ret;
@@ -109,8 +112,8 @@ EssenceStreamDescriptorList DV_DIF_EssenceSubParser::IdentifyEssence(FileHandle
 		if((Buffer[8] != 'A') || (Buffer[9] != 'V') || (Buffer[10] != 'I') || (Buffer[11] != ' ')) return Ret;
 
 		// So its an AVI file.. but what type?
-		FileSeek(InFile, 12);
-		U32Pair Header = ReadRIFFHeader(InFile);
+		Probe->Seek(12);
+		U32Pair Header = Probe->ReadRIFFHeader();
 
 		// If the first item isn't a list then we are stumpted!
 		if(Header.first != ID_LIST) return Ret;
@@ -122,16 +125,16 @@ EssenceStreamDescriptorList DV_DIF_EssenceSubParser::IdentifyEssence(FileHandle
 		if(ListSize < 4) return Ret;
 
 		// Must be an "hdrl" list
-		if(ReadU32(InFile) != ID_hdrl) return Ret;
+		if(Probe->ReadU32() != ID_hdrl) return Ret;
 		Decrement(ListSize,4);
 
 		// Initialize the video stream number
 		StreamNumber = 0;
 
 		// Find the "strl" entry
-		while((ListSize > 0) && !FileEof(InFile))
+		while((ListSize > 0) && !Probe->Eof())
 		{
-			U32Pair Header = ReadRIFFHeader(InFile);
+			U32Pair Header = Probe->ReadRIFFHeader();
 			Decrement(ListSize,Header.second + 8);
 
 			if(Header.first != ID_LIST)
@@ -139,9 +142,9 @@ EssenceStreamDescriptorList DV_DIF_EssenceSubParser::IdentifyEssence(FileHandle
 				// Grab the frame count as we pass
 				if(Header.first == ID_avih)
 				{
-					FileSeek(InFile, FileTell(InFile) + 16);
+					Probe->Seek(Probe->Tell() + 16);
 					UInt8 Buffer[4];
-					FileRead(InFile, Buffer, 4);
+					Probe->Read(Buffer, 4);
 					AVIFrameCount = GetU32_LE(Buffer);
 					
 					// Reduce the amount that we skip forwards as we have already moved 20 bytes
@@ -149,31 +152,31 @@ EssenceStreamDescriptorList DV_DIF_EssenceSubParser::IdentifyEssence(FileHandle
 				}
 
 	 			// Skip anything that is not a list
-				FileSeek(InFile, FileTell(InFile) + Header.second);
+				Probe->Seek(Probe->Tell() + Header.second);
 			}
 			else
 			{
 				// Work out where the end of this list is
-				Position ListEnd = FileTell(InFile) + Header.second;
+				Position ListEnd = Probe->Tell() + Header.second;
 
 				// Read the list type (we are only interested in stream info lists)
-				if(ReadU32(InFile) == ID_strl)
+				if(Probe->ReadU32() == ID_strl)
 				{
 					// We only support file with a stream header at the start of each strl list
-					if(ReadRIFFHeader(InFile).first != ID_strh) return Ret;
+					if(Probe->ReadRIFFHeader().first != ID_strh) return Ret;
 
 					// Skip the fccType
-					ReadU32(InFile);
+					Probe->ReadU32();
 
-					UInt32 MediaType = ReadU32(InFile);
+					UInt32 MediaType = Probe->ReadU32();
 
 					if( (MediaType == ID_dvsd) || (MediaType == ID_DVSD) )
 					{
 						// Record where the actual essence starts (for building descriptors)
-						Position EssenceStart = FileTell(InFile) - 28;
+						Position EssenceStart = Probe->Tell() - 28;
 
 						// Send the location of the list to the descriptor builder
-						MDObjectPtr VideoDescObj = BuildCDCIEssenceDescriptorFromAVI(InFile, EssenceStart);
+						MDObjectPtr VideoDescObj = BuildCDCIEssenceDescriptorFromAVI(Probe, EssenceStart);
 
 						// Quit here if we couldn't build an essence descriptor
 						if(!VideoDescObj) return Ret;
@@ -185,10 +188,10 @@ EssenceStreamDescriptorList DV_DIF_EssenceSubParser::IdentifyEssence(FileHandle
 						Descriptor->SourceFormat.Set(DV_DIF_AVI_Format);
 						Descriptor->Descriptor = VideoDescObj;
 
-						MDObjectPtr AudioDescObj = BuildSoundEssenceDescriptorFromAVI(InFile, EssenceStart);
+						MDObjectPtr AudioDescObj = BuildSoundEssenceDescriptorFromAVI(Probe, EssenceStart);
 
 						// Return to the start of the DIF data (building the audio descriptor will probably have moved the file pointer)
-						FileSeek(InFile, DIFStart);
+						Probe->Seek(DIFStart);
 
 						// Don't build the multiplex version if we failed to build the sound descriptor (or the mux descriptor)
 						if(AudioDescObj)
@@ -294,7 +297,7 @@ EssenceStreamDescriptorList DV_DIF_EssenceSubParser::IdentifyEssence(FileHandle
 					StreamNumber++;
 				}
 				// Skip what is left of this list
-				FileSeek(InFile, ListEnd);
+				Probe->Seek(ListEnd);
 			}
 		}
 
@@ -313,8 +316,8 @@ EssenceStreamDescriptorList DV_DIF_EssenceSubParser::IdentifyEssence(FileHandle
 	mxflib_assert(DV_DIF_BUFFERSIZE >= (80 * 150));
 
 	// Read the first 80*150 bytes of the file, this should be the first DIF sequence
-	FileSeek(InFile, 0);
-	BufferBytes = (int)FileRead(InFile, Buffer, 80 * 150);
+	Probe->Seek(0);
+	BufferBytes = (int)Probe->Read(Buffer, 80 * 150);
 
 	// If we couldn't read the sequence give up now!
 	if(BufferBytes < (80 * 150)) return Ret;
@@ -344,18 +347,19 @@ EssenceStreamDescriptorList DV_DIF_EssenceSubParser::IdentifyEssence(FileHandle
 	}
 
 	// Attempt to parse the format
-	MDObjectPtr VideoDescObj = BuildCDCIEssenceDescriptor(InFile, 0);
+	MDObjectPtr VideoDescObj = BuildCDCIEssenceDescriptor(Probe, 0);
 
 	// Quit here if we couldn't build an essence descriptor
 	if(!VideoDescObj) return Ret;
 
 	// Check the size (assume the entire file is DIF data)
+	// DRAGONS: If the input is not seekable (such as a pipe) the end will not be known until we read it
 	DIFStart = 0;
-	FileSeekEnd(InFile);
-	DIFEnd = FileTell(InFile);
+	if(Probe->SeekEnd() == 0) DIFEnd = Probe->Tell();
+	else DIFEnd = DIFEndUnknown;
 
 	// Seek to the start of the DIF data
-	FileSeek(InFile, DIFStart);
+	Probe->Seek(DIFStart);
 
 	// Build a descriptor with a zero ID (we only support single stream files)
 	EssenceStreamDescriptorPtr Descriptor = new EssenceStreamDescriptor;
@@ -364,10 +368,10 @@ EssenceStreamDescriptorList DV_DIF_EssenceSubParser::IdentifyEssence(FileHandle
 	Descriptor->SourceFormat.Set(DV_DIF_RAW_Format);
 	Descriptor->Descriptor = VideoDescObj;
 
-	MDObjectPtr AudioDescObj = BuildSoundEssenceDescriptor(InFile, 0);
+	MDObjectPtr AudioDescObj = BuildSoundEssenceDescriptor(Probe, 0);
 
 	// Return to the start of the DIF data (building the audio descriptor will probably have moved the file pointer)
-	FileSeek(InFile, DIFStart);
+	Probe->Seek(DIFStart);
 
 	// Don't build the multiplex version if we failed to build the sound descriptor (or the mux descriptor)
 	if(AudioDescObj)
@@ -671,6 +675,35 @@ Position DV_DIF_EssenceSubParser::GetCurrentPosition(void)
 }
 
 
+//! Seek so that the next read is the given edit unit
+/*! \return true if the seek succeeded */
+bool DV_DIF_EssenceSubParser::SeekToEditUnit(FileHandle InFile, Position EditUnit)
+{
+	if(!CanSeek()) return false;
+
+	// Every edit unit is the same size, so work out where this one starts
+	Position Offset = DIFStart + EditUnit * (150 * 80 * SeqCount);
+	if((EditUnit < 0) || (Offset > DIFEnd)) return false;
+
+	if(FileSeek(InFile, Offset) != 0) return false;
+
+	PictureNumber = EditUnit;
+	CachedDataSize = static_cast<size_t>(-1);
+
+	return true;
+}
+
+
+//! Get the number of edit units in the essence, if this is known without reading it
+/*! \return The duration in SetEditRate() sized edit units, or -1 if not known (such as for AVI wrapped DV) */
+Length DV_DIF_EssenceSubParser::GetEssenceDuration(FileHandle InFile)
+{
+	if(!CanSeek() || (DIFEnd == DIFEndUnknown)) return -1;
+
+	return (DIFEnd - DIFStart) / (150 * 80 * SeqCount);
+}
+
+
 //! Read a number of wrapping items from the specified stream and return them in a data chunk
 /*! If frame or line mapping is used the parameter Count is used to
  *	determine how many items are read. In frame wrapping it is in
@@ -826,14 +859,14 @@ Length DV_DIF_EssenceSubParser::Write(FileHandle InFile, UInt32 Stream, MXFFileP
 
 //! Read the header at the specified position in a DV file to build an essence descriptor
 /*! DRAGONS: Currently rather scrappy */
-MDObjectPtr DV_DIF_EssenceSubParser::BuildCDCIEssenceDescriptor(FileHandle InFile, UInt64 Start /*=0*/)
+MDObjectPtr DV_DIF_EssenceSubParser::BuildCDCIEssenceDescriptor(EssenceProbePtr &Probe, UInt64 Start /*=0*/)
 {
 	MDObjectPtr Ret;
 	UInt8 Buffer[0x1e0];
 
 	// Read the DIF blocks up to the third VAUX block
-	FileSeek(InFile, Start);
-	if(FileRead(InFile, Buffer, 0x1e0) < 0x1e0) return Ret;
+	Probe->Seek(Start);
+	if(Probe->Read(Buffer, 0x1e0) < 0x1e0) return Ret;
 
 	// Set 50Hz flag from the header
 	is50Hz = ((Buffer[3] & 0x80) == 0x80);
@@ -982,14 +1015,14 @@ MDObjectPtr DV_DIF_EssenceSubParser::BuildCDCIEssenceDescriptor(FileHandle InFil
 
 //! Read the header at the specified position in a DV file to build a sound essence descriptor
 /*! DRAGONS: Currently rather scrappy */
-MDObjectPtr DV_DIF_EssenceSubParser::BuildSoundEssenceDescriptor(FileHandle InFile, UInt64 Start /*=0*/)
+MDObjectPtr DV_DIF_EssenceSubParser::BuildSoundEssenceDescriptor(EssenceProbePtr &Probe, UInt64 Start /*=0*/)
 {
 	MDObjectPtr Ret;
 	UInt8 Buffer[80];
 
 	// Read the header DIF block
-	FileSeek(InFile, Start);
-	if(FileRead(InFile, Buffer, 80) < 80) return Ret;
+	Probe->Seek(Start);
+	if(Probe->Read(Buffer, 80) < 80) return Ret;
 
 	// Set 625/50 flag from the header
 	bool is50Hz = ((Buffer[3] & 0x80) == 0x80);
@@ -1051,39 +1084,39 @@ MDObjectPtr DV_DIF_EssenceSubParser::BuildSoundEssenceDescriptor(FileHandle InFi
 
 
 //! Read the header at the specified position in a DV-AVI file to build an essence descriptor
-MDObjectPtr DV_DIF_EssenceSubParser::BuildCDCIEssenceDescriptorFromAVI(FileHandle InFile, UInt64 Start)
+MDObjectPtr DV_DIF_EssenceSubParser::BuildCDCIEssenceDescriptorFromAVI(EssenceProbePtr &Probe, UInt64 Start)
 {
 	MDObjectPtr Ret;
 
 	// Re-read the header list
-	FileSeek(InFile, Start);
-	U32Pair Header = ReadRIFFHeader(InFile);
+	Probe->Seek(Start);
+	U32Pair Header = Probe->ReadRIFFHeader();
 	UInt32 ListSize = Header.second;
 
 	// Verify that this is a list
 	if(Header.first != ID_LIST) return Ret;
 
 	// Read the list type (we are only interested in stream info lists)
-	if(ReadU32(InFile) != ID_strl) return Ret;
+	if(Probe->ReadU32() != ID_strl) return Ret;
 	Decrement(ListSize, 4);
 
 	// We only support files with a stream header at the start of each strl list
-	Header = ReadRIFFHeader(InFile);
+	Header = Probe->ReadRIFFHeader();
 	if(Header.first != ID_strh) return Ret;
 	Decrement(ListSize, 8);
 
 	// Read this chunk
-	DataChunkPtr StreamHeader = FileReadChunk(InFile, Header.second);
+	DataChunkPtr StreamHeader = Probe->ReadChunk(Header.second);
 	Decrement(ListSize, Header.second);
 
 	// We only support files with a stream format following the stream header
 	if(ListSize < 8) return Ret;
-	Header = ReadRIFFHeader(InFile);
+	Header = Probe->ReadRIFFHeader();
 	if(Header.first != ID_strf) return Ret;
 	Decrement(ListSize, 8);
 
 	// Read this chunk
-	DataChunkPtr StreamFormat = FileReadChunk(InFile, Header.second);
+	DataChunkPtr StreamFormat = Probe->ReadChunk(Header.second);
 	Decrement(ListSize, Header.second);
 
 	/* Build the stream ID that this essence uses - this is normally ##db where ## is the stream number in decimal */
@@ -1094,12 +1127,12 @@ MDObjectPtr DV_DIF_EssenceSubParser::BuildCDCIEssenceDescriptorFromAVI(FileHandl
 	// Check if there is an index chunk - this will define the StreamID
 	if(ListSize > 8)
 	{
-		Header = ReadRIFFHeader(InFile);
+		Header = Probe->ReadRIFFHeader();
 		Decrement(ListSize, 8);
 		if(Header.first == ID_indx) 
 		{
 			// Read this chunk
-			DataChunkPtr IndexChunk = FileReadChunk(InFile, Header.second);
+			DataChunkPtr IndexChunk = Probe->ReadChunk(Header.second);
 			Decrement(ListSize, Header.second);
 
 			if(IndexChunk->Size >= 12) AVIStreamID = GetU32(&IndexChunk->Data[8]);
@@ -1110,35 +1143,34 @@ MDObjectPtr DV_DIF_EssenceSubParser::BuildCDCIEssenceDescriptorFromAVI(FileHandl
 	//          We may make more use of the header in future
 
 	// Start scanning for the movi list
-	UInt64 Scan = FileTell(InFile) + ListSize;
+	Position Scan = Probe->Tell() + ListSize;
 
-	while(!FileEof(InFile))
+	while(!Probe->Eof())
 	{
 		// Seek to the next position (and check that we succeeded - if not we are beyond the EOF)
-		FileSeek(InFile, Scan);
-		if(FileTell(InFile) != Scan) return Ret;
+		if(Probe->Seek(Scan) != 0) return Ret;
 
 		// Read the chunk header
-		Header = ReadRIFFHeader(InFile);
+		Header = Probe->ReadRIFFHeader();
 		
 		// Work out where this chunk ends
-		UInt64 NextScan = FileTell(InFile) + Header.second;
+		Position NextScan = Probe->Tell() + Header.second;
 
 		// Is this the movi list?
 		if(Header.first == ID_LIST)
 		{
-			UInt32 ListID = ReadU32(InFile);
+			UInt32 ListID = Probe->ReadU32();
 			if(ListID == ID_movi)
 			{
 				ListSize = Header.second;
 
-				while(ListSize && !FileEof(InFile))
+				while(ListSize && !Probe->Eof())
 				{
-					Header = ReadRIFFHeader(InFile);
+					Header = Probe->ReadRIFFHeader();
 					if(Header.first == AVIStreamID)
 					{
 						// Record the start of the data
-						DIFStart = FileTell(InFile);
+						DIFStart = Probe->Tell();
 						DIFEnd = -1;
 						
 						// Record the outer list and current chunk remaining byte counts
@@ -1146,16 +1178,16 @@ MDObjectPtr DV_DIF_EssenceSubParser::BuildCDCIEssenceDescriptorFromAVI(FileHandl
 						AVIChunkRemaining = Header.second;
 
 						// Build the header from this data
-						Ret = BuildCDCIEssenceDescriptor(InFile, static_cast<UInt64>(DIFStart));
+						Ret = BuildCDCIEssenceDescriptor(Probe, static_cast<UInt64>(DIFStart));
 						
 						// Return to the start of the data
-						FileSeek(InFile, DIFStart);
+						Probe->Seek(DIFStart);
 
 						return Ret;
 					}
 
 					// Skip over the contents of this chunk
-					FileSeek(InFile, FileTell(InFile) + Header.second);
+					Probe->Seek(Probe->Tell() + Header.second);
 
 					// Remove the size of the chunk header and the chunk from the list size
 					Decrement(ListSize, (Header.second + 8));
@@ -1166,20 +1198,20 @@ MDObjectPtr DV_DIF_EssenceSubParser::BuildCDCIEssenceDescriptorFromAVI(FileHandl
 			{
 				ListSize = Header.second;
 
-				while(ListSize && !FileEof(InFile))
+				while(ListSize && !Probe->Eof())
 				{
-					Header = ReadRIFFHeader(InFile);
+					Header = Probe->ReadRIFFHeader();
 
 					// Work out where this chunk in the list ends
-					Position ChunkEnd = FileTell(InFile) + Header.second;
+					Position ChunkEnd = Probe->Tell() + Header.second;
 
 					if(Header.first == ID_dmlh)
 					{
-						AVIFrameCount = ReadU32_LE(InFile);
+						AVIFrameCount = Probe->ReadU32_LE();
 					}
 
 					// Skip over the contents of this chunk
-					FileSeek(InFile, ChunkEnd);
+					Probe->Seek(ChunkEnd);
 
 					// Remove the size of the chunk header and the chunk from the list size
 					Decrement(ListSize, (Header.second + 8));
@@ -1196,39 +1228,39 @@ MDObjectPtr DV_DIF_EssenceSubParser::BuildCDCIEssenceDescriptorFromAVI(FileHandl
 
 
 //! Read the header at the specified position in a DV-AVI file to build an audio essence descriptor
-MDObjectPtr DV_DIF_EssenceSubParser::BuildSoundEssenceDescriptorFromAVI(FileHandle InFile, UInt64 Start)
+MDObjectPtr DV_DIF_EssenceSubParser::BuildSoundEssenceDescriptorFromAVI(EssenceProbePtr &Probe, UInt64 Start)
 {
 	MDObjectPtr Ret;
 
 	// Re-read the header list
-	FileSeek(InFile, Start);
-	U32Pair Header = ReadRIFFHeader(InFile);
+	Probe->Seek(Start);
+	U32Pair Header = Probe->ReadRIFFHeader();
 	UInt32 ListSize = Header.second;
 
 	// Verify that this is a list
 	if(Header.first != ID_LIST) return Ret;
 
 	// Read the list type (we are only interested in stream info lists)
-	if(ReadU32(InFile) != ID_strl) return Ret;
+	if(Probe->ReadU32() != ID_strl) return Ret;
 	Decrement(ListSize, 4);
 
 	// We only support files with a stream header at the start of each strl list
-	Header = ReadRIFFHeader(InFile);
+	Header = Probe->ReadRIFFHeader();
 	if(Header.first != ID_strh) return Ret;
 	Decrement(ListSize, 8);
 
 	// Read this chunk
-	DataChunkPtr StreamHeader = FileReadChunk(InFile, Header.second);
+	DataChunkPtr StreamHeader = Probe->ReadChunk(Header.second);
 	Decrement(ListSize, Header.second);
 
 	// We only support files with a stream format following the stream header
 	if(ListSize < 8) return Ret;
-	Header = ReadRIFFHeader(InFile);
+	Header = Probe->ReadRIFFHeader();
 	if(Header.first != ID_strf) return Ret;
 	Decrement(ListSize, 8);
 
 	// Read this chunk
-	DataChunkPtr StreamFormat = FileReadChunk(InFile, Header.second);
+	DataChunkPtr StreamFormat = Probe->ReadChunk(Header.second);
 	Decrement(ListSize, Header.second);
 
 	/* Build the stream ID that this essence uses - this is normally ##db where ## is the stream number in decimal */
@@ -1239,12 +1271,12 @@ MDObjectPtr DV_DIF_EssenceSubParser::BuildSoundEssenceDescriptorFromAVI(FileHand
 	// Check if there is an index chunk - this will define the StreamID
 	if(ListSize > 8)
 	{
-		Header = ReadRIFFHeader(InFile);
+		Header = Probe->ReadRIFFHeader();
 		Decrement(ListSize, 8);
 		if(Header.first == ID_indx) 
 		{
 			// Read this chunk
-			DataChunkPtr IndexChunk = FileReadChunk(InFile, Header.second);
+			DataChunkPtr IndexChunk = Probe->ReadChunk(Header.second);
 			Decrement(ListSize, Header.second);
 
 			if(IndexChunk->Size >= 12) AVIStreamID = GetU32(&IndexChunk->Data[8]);
@@ -1255,34 +1287,33 @@ MDObjectPtr DV_DIF_EssenceSubParser::BuildSoundEssenceDescriptorFromAVI(FileHand
 	//          We may make more use of the header in future
 
 	// Start scanning for the movi list
-	UInt64 Scan = FileTell(InFile) + ListSize;
+	Position Scan = Probe->Tell() + ListSize;
 
-	while(!FileEof(InFile))
+	while(!Probe->Eof())
 	{
 		// Seek to the next position (and check that we succeeded - if not we are beyond the EOF)
-		FileSeek(InFile, Scan);
-		if(FileTell(InFile) != Scan) return Ret;
+		if(Probe->Seek(Scan) != 0) return Ret;
 
 		// Read the chunk header
-		Header = ReadRIFFHeader(InFile);
+		Header = Probe->ReadRIFFHeader();
 		
 		// Work out where this chunk ends
-		UInt64 NextScan = FileTell(InFile) + Header.second;
+		Position NextScan = Probe->Tell() + Header.second;
 
 		// Is this the movi list?
 		if(Header.first == ID_LIST)
 		{
-			if(ReadU32(InFile) == ID_movi)
+			if(Probe->ReadU32() == ID_movi)
 			{
 				ListSize = Header.second;
 
-				while(ListSize && !FileEof(InFile))
+				while(ListSize && !Probe->Eof())
 				{
-					Header = ReadRIFFHeader(InFile);
+					Header = Probe->ReadRIFFHeader();
 					if(Header.first == AVIStreamID)
 					{
 						// Record the start of the data
-						DIFStart = FileTell(InFile);
+						DIFStart = Probe->Tell();
 						DIFEnd = -1;
 						
 						// Record the outer list and current chunk remaining byte counts
@@ -1290,16 +1321,16 @@ MDObjectPtr DV_DIF_EssenceSubParser::BuildSoundEssenceDescriptorFromAVI(FileHand
 						AVIChunkRemaining = Header.second;
 
 						// Build the header from this data
-						Ret = BuildSoundEssenceDescriptor(InFile, static_cast<UInt64>(DIFStart));
+						Ret = BuildSoundEssenceDescriptor(Probe, static_cast<UInt64>(DIFStart));
 						
 						// Return to the start of the data
-						FileSeek(InFile, DIFStart);
+						Probe->Seek(DIFStart);
 
 						return Ret;
 					}
 
 					// Skip over the contents of this chunk
-					FileSeek(InFile, FileTell(InFile) + Header.second);
+					Probe->Seek(Probe->Tell() + Header.second);
 
 					// Remove the size of the chunk header and the chunk from the list size
 					Decrement(ListSize, (Header.second + 8));
@@ -1336,6 +1367,13 @@ size_t DV_DIF_EssenceSubParser::ReadInternal(FileHandle InFile, UInt32 Stream, U
 	{
 		if(DIFEnd == -1)
 			Count = AVIFrameCount - PictureNumber;
+		else if(DIFEnd == DIFEndUnknown)
+		{
+			error("Clip wrapping DV essence is not supported when the size of the input cannot be determined\n");
+			CachedDataSize = 0;
+			CachedCount = Count;
+			return 0;
+		}
 		else
 			Count = ((DIFEnd - DIFStart) / (150 * 80)) - PictureNumber;
 	}
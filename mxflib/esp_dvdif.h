@@ -49,7 +49,7 @@ namespace mxflib
 		Position CurrentPos;								//!< Current position in the input file
 
 		Position DIFStart;									//!< Byte offset of first byte of first DIF
-		Position DIFEnd;									//!< Byte offset of last byte of last DIF + 1, or -1 if the file is an AVI file
+		Position DIFEnd;									//!< Byte offset of last byte of last DIF + 1, -1 if the file is an AVI file, or DIFEndUnknown if not yet known
 
 		int SeqCount;										//!< Number of DIF sequences in an edit unit
 		int NativeSeqCount;									//!< Number of DIF sequences in a frame at native edit rate
@@ -173,8 +173,10 @@ namespace mxflib
 			return ExtensionList;
 		}
 
-		//! Examine the open file and return a list of essence descriptors
-		virtual EssenceStreamDescriptorList IdentifyEssence(FileHandle InFile);
+		using EssenceSubParser::IdentifyEssence;
+
+		//! Examine an essence file via a shared probe buffer and return a list of essence descriptors
+		virtual EssenceStreamDescriptorList IdentifyEssence(EssenceProbePtr &Probe);
 
 		//! Examine the open file and return the wrapping options known by this parser
 		virtual WrappingOptionList IdentifyWrappingOptions(FileHandle InFile, EssenceStreamDescriptor &Descriptor);
@@ -219,6 +221,16 @@ namespace mxflib
 		//! Get the current position in SetEditRate() sized edit units
 		virtual Position GetCurrentPosition(void);
 
+		//! Does this essence parser support SeekToEditUnit()
+		/*! Raw DV has a fixed size per edit unit so can be seeked, but AVI wrapped DV is not supported */
+		virtual bool CanSeek(void) { return DIFEnd != -1; }
+
+		//! Seek so that the next read is the given edit unit
+		virtual bool SeekToEditUnit(FileHandle InFile, Position EditUnit);
+
+		//! Get the number of edit units in the essence, if this is known without reading it
+		virtual Length GetEssenceDuration(FileHandle InFile);
+
 		//! Read a number of wrapping items from the specified stream and return them in a data chunk
 		virtual DataChunkPtr Read(FileHandle InFile, UInt32 Stream, UInt64 Count = 1/*, IndexTablePtr Index = NULL*/);
 
@@ -244,16 +256,16 @@ namespace mxflib
 
 	protected:
 		//! Read the header at the specified position in a DV file to build a video essence descriptor
-		MDObjectPtr BuildCDCIEssenceDescriptor(FileHandle InFile, UInt64 Start = 0);
+		MDObjectPtr BuildCDCIEssenceDescriptor(EssenceProbePtr &Probe, UInt64 Start = 0);
 
 		//! Read the header at the specified position in a DV file to build an audio essence descriptor
-		MDObjectPtr BuildSoundEssenceDescriptor(FileHandle InFile, UInt64 Start = 0);
+		MDObjectPtr BuildSoundEssenceDescriptor(EssenceProbePtr &Probe, UInt64 Start = 0);
 
 		//! Read the header at the specified position in a DV-AVI file to build an essence descriptor
-		MDObjectPtr BuildCDCIEssenceDescriptorFromAVI(FileHandle InFile, UInt64 Start);
+		MDObjectPtr BuildCDCIEssenceDescriptorFromAVI(EssenceProbePtr &Probe, UInt64 Start);
 
 		//! Read the header at the specified position in a DV-AVI file to build an audio essence descriptor
-		MDObjectPtr BuildSoundEssenceDescriptorFromAVI(FileHandle InFile, UInt64 Start);
+		MDObjectPtr BuildSoundEssenceDescriptorFromAVI(EssenceProbePtr &Probe, UInt64 Start);
 
 		//! Scan the essence to calculate how many bytes to transfer for the given edit unit count
 		size_t ReadInternal(FileHandle InFile, UInt32 Stream, UInt64 Count/*, IndexTablePtr Index = NULL*/);
@@ -105,7 +105,7 @@ namespace
 
 //! Examine the open file and return a list of essence descriptors
 /*! \note This call will modify properties SampleRate, DataStart and DataSize */
-EssenceStreamDescriptorList mxflib::JP2K_EssenceSubParser::IdentifyEssence(FileHandle InFile)
+EssenceStreamDescriptorList mxflib::JP2K_EssenceSubParser::IdentifyEssence(EssenceProbePtr &Probe)
 {
 	// ".JP2" Signature box
 	const UInt8 JP2_Signature[] = { 0x00, 0x00, 0x00, 0x0c, 0x6a, 0x50, 0x20, 0x20, 0x0d, 0x0a, 0x87, 0x0a };
@@ -119,8 +119,8 @@ EssenceStreamDescriptorList mxflib::JP2K_EssenceSubParser::IdentifyEssence(FileH
 	EssenceStreamDescriptorList Ret;
 
 	// Read the first 12 bytes of the file to allow us to identify it
-	FileSeek(InFile, 0);
-	BufferBytes = (int)FileRead(InFile, Buffer, 12);
+	Probe->Seek(0);
+	BufferBytes = (int)Probe->Read(Buffer, 12);
 
 	// If the file is smaller than 12 bytes give up now!
 	if(BufferBytes < 12) return Ret;
@@ -131,7 +131,7 @@ EssenceStreamDescriptorList mxflib::JP2K_EssenceSubParser::IdentifyEssence(FileH
 		// But it could be a JPEG 2000 codestream file
 		if(memcmp(Buffer, J2C_Signature, 4) != 0) return Ret;
 
-		MDObjectPtr DescObj = BuildDescriptorFromCodeStream(InFile, 0);
+		MDObjectPtr DescObj = BuildDescriptorFromCodeStream(Probe, 0);
 
 		// Quit here if we couldn't build an essence descriptor
 		if(!DescObj) return Ret;
@@ -156,7 +156,7 @@ EssenceStreamDescriptorList mxflib::JP2K_EssenceSubParser::IdentifyEssence(FileH
 		return Ret;
 	}
 
-	MDObjectPtr DescObj = BuildDescriptorFromJP2(InFile);
+	MDObjectPtr DescObj = BuildDescriptorFromJP2(Probe);
 
 	// Quit here if we couldn't build an essence descriptor
 	if(!DescObj) return Ret;
@@ -283,6 +283,36 @@ DataChunkPtr mxflib::JP2K_EssenceSubParser::Read(FileHandle InFile, UInt32 Strea
 }
 
 
+//! Seek so that the next read is the given edit unit
+/*! As each file holds a single picture the only valid edit units are 0 (the picture) and 1 (the end of the file)
+ *  \return true if the seek succeeded
+ */
+bool mxflib::JP2K_EssenceSubParser::SeekToEditUnit(FileHandle InFile, Position EditUnit)
+{
+	if(EditUnit == 0)
+	{
+		// DRAGONS: A CurrentPos of 0 means the start of the data
+		CurrentPos = 0;
+	}
+	else if(EditUnit == 1)
+	{
+		if(DataSize != 0) CurrentPos = DataStart + DataSize;
+		else
+		{
+			// If the size is unknown the rest of the file is data
+			if(FileSeekEnd(InFile) != 0) return false;
+			CurrentPos = static_cast<Position>(FileTell(InFile));
+		}
+	}
+	else return false;
+
+	PictureNumber = EditUnit;
+	CachedDataSize = static_cast<size_t>(-1);
+
+	return true;
+}
+
+
 //! Write a number of wrapping items from the specified stream to an MXF file
 /*! If frame or line mapping is used the parameter Count is used to
  *	determine how many items are read. In frame wrapping it is in
@@ -329,7 +359,7 @@ Length mxflib::JP2K_EssenceSubParser::Write(FileHandle InFile, UInt32 Stream, MX
 
 //! Read the essence information from the codestream at the specified position in the source file and build an essence descriptor
 /*! \note This call will modify properties SampleRate, DataStart and DataSize */
-MDObjectPtr mxflib::JP2K_EssenceSubParser::BuildDescriptorFromCodeStream(FileHandle InFile, Position Offset /*=0*/)
+MDObjectPtr mxflib::JP2K_EssenceSubParser::BuildDescriptorFromCodeStream(EssenceProbePtr &Probe, Position Offset /*=0*/)
 {
 	MDObjectPtr Ret;
 
@@ -337,7 +367,7 @@ MDObjectPtr mxflib::JP2K_EssenceSubParser::BuildDescriptorFromCodeStream(FileHan
 	bool IsRGB = true;
 
 	// Parse the header
-	ParseJP2KCodestreamHeader(InFile, Offset);
+	ParseJP2KCodestreamHeader(Probe, Offset);
 
 	// Header iterator
 	HeaderType::iterator it;
@@ -526,12 +556,12 @@ MDObjectPtr mxflib::JP2K_EssenceSubParser::BuildDescriptorFromCodeStream(FileHan
 
 //! Read the essence information at the start of the "JP2" format source file and build an essence descriptor
 /*! \note This call will modify properties SampleRate, DataStart and DataSize */
-MDObjectPtr mxflib::JP2K_EssenceSubParser::BuildDescriptorFromJP2(FileHandle InFile)
+MDObjectPtr mxflib::JP2K_EssenceSubParser::BuildDescriptorFromJP2(EssenceProbePtr &Probe)
 {
 	MDObjectPtr Ret;
 
 	// Parse the header
-	ParseJP2Header(InFile);
+	ParseJP2Header(Probe);
 
 	// If we didn't find any codestream data there is no point going any further
 	if(DataStart == 0) return Ret;
@@ -561,7 +591,7 @@ MDObjectPtr mxflib::JP2K_EssenceSubParser::BuildDescriptorFromJP2(FileHandle InF
 		else return Ret;
 	}
 	
-	Ret = BuildDescriptorFromCodeStream(InFile, DataStart);
+	Ret = BuildDescriptorFromCodeStream(Probe, DataStart);
 	
 	return Ret;
 }
@@ -597,8 +627,14 @@ size_t mxflib::JP2K_EssenceSubParser::ReadInternal(FileHandle InFile, UInt32 Str
 
 	// If the size is unknown we assume the rest of the file is data
 	// DRAGONS: Should work even for JP2 files as an "unknown" length must be the last item in a JP2 file
-	FileSeekEnd(InFile);
-	Ret = static_cast<Length>(FileTell(InFile) - CurrentPos);
+	if(FileSeekEnd(InFile) == 0)
+		Ret = static_cast<Length>(FileTell(InFile) - CurrentPos);
+	else
+	{
+		// DRAGONS: This can happen if the input is a non-seekable source where the image is larger than the input window
+		error("Unable to determine the size of the JPEG 2000 image data\n");
+		Ret = 0;
+	}
 	
 	// Move back to the current position
 	FileSeek(InFile, CurrentPos);
@@ -750,7 +786,7 @@ printf("Read Done\n");
 
 
 //! Parse a JP2 header at the start of the specified file into items in the Header multimap
-bool mxflib::JP2K_EssenceSubParser::ParseJP2Header(FileHandle InFile)
+bool mxflib::JP2K_EssenceSubParser::ParseJP2Header(EssenceProbePtr &Probe)
 {
 	// Known superboxes
 	static const char *SuperBoxes[] = { "jp2h", "res ", "uinf", NULL };
@@ -772,17 +808,17 @@ bool mxflib::JP2K_EssenceSubParser::ParseJP2Header(FileHandle InFile)
 	// Flag that the rest of the file is currently available
 	Length Remaining = -1;
 
-	FileSeek(InFile, 0);
-	while(!FileEof(InFile))
+	Probe->Seek(0);
+	while(!Probe->Eof())
 	{
 		int Bytes = 0;
 		char BoxName[5];
 
 		// Read the box length
-		Length BoxLength = ReadU32(InFile);
+		Length BoxLength = Probe->ReadU32();
 		
 		// Read the box name
-		FileRead(InFile, (UInt8*)BoxName, 4);
+		Probe->Read((UInt8*)BoxName, 4);
 		BoxName[4] = 0;
 
 		// Count bytes used so far
@@ -791,7 +827,7 @@ bool mxflib::JP2K_EssenceSubParser::ParseJP2Header(FileHandle InFile)
 		// Read extended length if used
 		if(BoxLength == 1)
 		{
-			BoxLength = ReadI64(InFile);
+			BoxLength = Probe->ReadI64();
 
 			// Adjust byte count
 			Bytes += 8;
@@ -811,7 +847,7 @@ bool mxflib::JP2K_EssenceSubParser::ParseJP2Header(FileHandle InFile)
 		// Parsing ends once the first codestream is found
 		if(strcmp(BoxName, "jp2c") == 0)
 		{
-			DataStart = FileTell(InFile);
+			DataStart = Probe->Tell();
 			CurrentPos = DataStart;
 			if(BoxLength < 2) DataSize = 0;
 			else DataSize = BoxLength - 2;
@@ -856,7 +892,7 @@ bool mxflib::JP2K_EssenceSubParser::ParseJP2Header(FileHandle InFile)
 			else ReadLength = (int)BoxLength;
 
 			DataChunkPtr ThisData = new DataChunk(ReadLength);
-			int Bytes = (int)FileRead(InFile, ThisData->Data, ReadLength);
+			int Bytes = (int)Probe->Read(ThisData->Data, ReadLength);
 
 			// Resize the value if not all bytes read
 			if(Bytes != ReadLength) ThisData->Resize(Bytes);
@@ -877,7 +913,7 @@ bool mxflib::JP2K_EssenceSubParser::ParseJP2Header(FileHandle InFile)
 		/* Are we done yet? */
 
 		// EOF will end parsing completely
-		if(FileEof(InFile)) break;
+		if(Probe->Eof()) break;
 
 		// End parsing of this box if required
 		if(Remaining == 0)
@@ -907,21 +943,21 @@ bool mxflib::JP2K_EssenceSubParser::ParseJP2Header(FileHandle InFile)
 //! Parse a JPEG 2000 header at the specified offset in a file into items in the Header multimap
 /*! This parsing includes the first tile-part header
  */
-bool mxflib::JP2K_EssenceSubParser::ParseJP2KCodestreamHeader(FileHandle InFile, Position Offset)
+bool mxflib::JP2K_EssenceSubParser::ParseJP2KCodestreamHeader(EssenceProbePtr &Probe, Position Offset)
 {
 	// Clear any existing header data
 	Header.clear();
 
-	FileSeek(InFile, Offset);
+	Probe->Seek(Offset);
 	
 	// Verify that the first byte of the first marker if 0xff
-	UInt8 Start = ReadU8(InFile);
+	UInt8 Start = Probe->ReadU8();
 	if(Start != 0xff) return false;
 
 	// Read the first marker
-	UInt8 Marker = ReadU8(InFile);
+	UInt8 Marker = Probe->ReadU8();
 
-	while(!FileEof(InFile))
+	while(!Probe->Eof())
 	{
 		// Parsing ends once we read SOD
 		if(Marker == 0x93)
@@ -932,7 +968,7 @@ bool mxflib::JP2K_EssenceSubParser::ParseJP2KCodestreamHeader(FileHandle InFile,
 		bool isSegment = true;
 
 		// Determine if there is a marker segment
-		UInt16 SegmentLength = ReadU16(InFile);
+		UInt16 SegmentLength = Probe->ReadU16();
 		mxflib_assert(SegmentLength > 2);
 
 		// Looks like no segment (or it could be a long length)
@@ -953,7 +989,7 @@ bool mxflib::JP2K_EssenceSubParser::ParseJP2KCodestreamHeader(FileHandle InFile,
 			SegmentLength -= 2;
 
 			ThisData = new DataChunk(SegmentLength);
-			int Bytes = (int)FileRead(InFile, ThisData->Data, SegmentLength);
+			int Bytes = (int)Probe->Read(ThisData->Data, SegmentLength);
 
 			// Resize the value if not all bytes read
 			if(Bytes != SegmentLength) ThisData->Resize(Bytes);
@@ -967,11 +1003,11 @@ bool mxflib::JP2K_EssenceSubParser::ParseJP2KCodestreamHeader(FileHandle InFile,
 		if(isSegment)
 		{
 			// Verify that the first byte of the next marker if 0xff
-			UInt8 Start = ReadU8(InFile);
+			UInt8 Start = Probe->ReadU8();
 			if(Start != 0xff) return false;
 
 			// Read the next marker
-			Marker = ReadU8(InFile);
+			Marker = Probe->ReadU8();
 		}
 		else
 		{
@@ -136,8 +136,10 @@ namespace mxflib
 			return ExtensionList;
 		}
 
-		//! Examine the open file and return a list of essence descriptors
-		virtual EssenceStreamDescriptorList IdentifyEssence(FileHandle InFile);
+		using EssenceSubParser::IdentifyEssence;
+
+		//! Examine an essence file via a shared probe buffer and return a list of essence descriptors
+		virtual EssenceStreamDescriptorList IdentifyEssence(EssenceProbePtr &Probe);
 
 		//! Examine the open file and return the wrapping options known by this parser
 		virtual WrappingOptionList IdentifyWrappingOptions(FileHandle InFile, EssenceStreamDescriptor &Descriptor);
@@ -182,6 +184,16 @@ namespace mxflib
 		//! Get the current position in SetEditRate() sized edit units
 		virtual Position GetCurrentPosition(void) { return PictureNumber; }
 
+		//! Does this essence parser support SeekToEditUnit()
+		/*! Each file holds a single picture, so the only positions are the start and end of that picture */
+		virtual bool CanSeek(void) { return true; }
+
+		//! Seek so that the next read is the given edit unit
+		virtual bool SeekToEditUnit(FileHandle InFile, Position EditUnit);
+
+		//! Get the number of edit units in the essence, which is always one picture per file
+		virtual Length GetEssenceDuration(FileHandle InFile) { return 1; }
+
 		//! Read a number of wrapping items from the specified stream and return them in a data chunk
 		virtual DataChunkPtr Read(FileHandle InFile, UInt32 Stream, UInt64 Count = 1);
 
@@ -214,22 +226,22 @@ namespace mxflib
 
 		//! Read the essence information from the codestream at the specified position in the source file and build an essence descriptor
 		/*! \note This call will modify properties SampleRate, DataStart and DataSize */
-		MDObjectPtr BuildDescriptorFromCodeStream(FileHandle InFile, Position Offset = 0 );
+		MDObjectPtr BuildDescriptorFromCodeStream(EssenceProbePtr &Probe, Position Offset = 0 );
 
 		//! Read the essence information at the start of the "JP2" format source file and build an essence descriptor
 		/*! \note This call will modify properties SampleRate, DataStart and DataSize */
-		MDObjectPtr BuildDescriptorFromJP2(FileHandle InFile);
+		MDObjectPtr BuildDescriptorFromJP2(EssenceProbePtr &Probe);
 
 		//! Scan the essence to calculate how many bytes to transfer for the given edit unit count
 		size_t ReadInternal(FileHandle InFile, UInt32 Stream, Length Count);
 
 		//! Parse a JP2 header at the start of the specified file into items in the Header multimap
-		bool ParseJP2Header(FileHandle InFile);
+		bool ParseJP2Header(EssenceProbePtr &Probe);
 
 		//! Parse a JPEG 2000 header at the specified offset in a file into items in the Header multimap
 		/*! This parsing includes the first tile-part header
 		 */
-		bool ParseJP2KCodestreamHeader(FileHandle InFile, Position Offset);
+		bool ParseJP2KCodestreamHeader(EssenceProbePtr &Probe, Position Offset);
 
 
 		//! Return the greatest common divisor of two numbers
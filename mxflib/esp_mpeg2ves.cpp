@@ -61,7 +61,7 @@ StringList MPEG2_VES_EssenceSubParser::HandledExtensions(void)
 /*! \note Valid MPEG2-VES files with > 510 extra zeroes before the first start code
  *	      will not be identifed!
  */
-EssenceStreamDescriptorList MPEG2_VES_EssenceSubParser::IdentifyEssence(FileHandle InFile)
+EssenceStreamDescriptorList MPEG2_VES_EssenceSubParser::IdentifyEssence(EssenceProbePtr &Probe)
 {
 	int BufferBytes;
 	UInt8 Buffer[1024*8];
@@ -69,9 +69,9 @@ EssenceStreamDescriptorList MPEG2_VES_EssenceSubParser::IdentifyEssence(FileHand
 
 	EssenceStreamDescriptorList Ret;
 
-	// Read the first 512 bytes of the file to allow us to investigate it
-	FileSeek(InFile, 0);
-	BufferBytes = (int)FileRead(InFile, Buffer, 1024*8);
+	// Read the first 8k bytes of the file to allow us to investigate it
+	Probe->Seek(0);
+	BufferBytes = (int)Probe->Read(Buffer, 1024*8);
 	
 	// If the file is smaller than 16 bytes give up now!
 	if(BufferBytes < 16) return Ret;
@@ -113,7 +113,7 @@ EssenceStreamDescriptorList MPEG2_VES_EssenceSubParser::IdentifyEssence(FileHand
 		}
 	}
 
-	MDObjectPtr DescObj = BuildMPEG2VideoDescriptor(InFile, StartPos);
+	MDObjectPtr DescObj = BuildMPEG2VideoDescriptor(Probe, StartPos);
 	
 	// Quit here if we couldn't build an essence descriptor
 	if(!DescObj) return Ret;
@@ -209,6 +209,10 @@ void MPEG2_VES_EssenceSubParser::Use(UInt32 Stream, WrappingOptionPtr &UseWrappi
 	GOPOffset = 0;
 	ClosedGOP = false;					// Start by assuming the GOP is closed
 //	IndexMap.clear();
+
+	EditPointTable.clear();
+	EditPointScanned = 0;
+	EditPointScanDone = false;
 }
 
 
@@ -274,6 +278,115 @@ Position MPEG2_VES_EssenceSubParser::GetCurrentPosition(void)
 }
 
 
+//! Seek so that the next read is the edit point at or before the given edit unit
+/*! \return true if the seek succeeded */
+bool MPEG2_VES_EssenceSubParser::SeekToEditUnit(FileHandle InFile, Position EditUnit)
+{
+	if(!CanSeek() || (EditUnit < 0)) return false;
+
+	// Ensure that the table covers the requested edit unit
+	if((EditUnit >= EditPointScanned) && !EditPointScanDone) ScanEditPoints(InFile, EditUnit);
+
+	// Locate the last edit point at or before the requested edit unit
+	std::map<Position, Position>::iterator it = EditPointTable.upper_bound(EditUnit);
+	if(it == EditPointTable.begin()) return false;
+	it--;
+
+	// Set up the parser state as it would be at the start of that edit unit
+	// DRAGONS: Every entry in the table is the sequence header of a closed GOP, starting with an anchor frame
+	PictureNumber = (*it).first;
+	CurrentPos = (*it).second;
+	AnchorFrame = PictureNumber;
+	GOPOffset = 0;
+	ClosedGOP = true;
+	EndOfStream = false;
+	BuffCount = 0;
+	CachedDataSize = static_cast<size_t>(-1);
+
+	return true;
+}
+
+
+//! Scan the file to extend EditPointTable until it includes all edit points up to the given picture
+/*! This is a quick scan for start codes that does none of the work of ReadInternal(), so edit points
+ *  can be located without reading every preceding edit unit
+ */
+void MPEG2_VES_EssenceSubParser::ScanEditPoints(FileHandle InFile, Position Target)
+{
+	// Resume from the last edit point found, or the start of the file
+	Position Picture = 0;
+	Position Pos = 0;
+	bool Closed = false;
+	if(!EditPointTable.empty())
+	{
+		std::map<Position, Position>::reverse_iterator it = EditPointTable.rbegin();
+		Picture = (*it).first;
+		Pos = (*it).second;
+		Closed = true;
+	}
+
+	const size_t ScanBufferSize = 65536;
+	UInt8 *ScanBuffer = new UInt8[ScanBufferSize];
+
+	UInt32 Scan = 0xffffffff;
+	int GOPBytes = 0;						//! Number of bytes still to read from a GOP header to reach the closed_gop flag
+	bool SeqHead = false;					//! Set true once a sequence header has been found for the next picture
+	Position SeqHeadPos = 0;				//! The file offset of the last sequence header found
+
+	FileSeek(InFile, Pos);
+	for(;;)
+	{
+		size_t Bytes = FileRead(InFile, ScanBuffer, ScanBufferSize);
+		if((Bytes == 0) || (Bytes == static_cast<size_t>(-1)))
+		{
+			EditPointScanDone = true;
+			break;
+		}
+
+		size_t i;
+		for(i = 0; i < Bytes; i++)
+		{
+			UInt8 ThisByte = ScanBuffer[i];
+
+			// Pick the closed_gop flag from the fourth byte of a GOP header
+			if(GOPBytes && (--GOPBytes == 0)) Closed = (ThisByte & 0x40) ? true : false;
+
+			Scan = (Scan << 8) | ThisByte;
+			if((Scan & 0xffffff00) != 0x00000100) continue;
+
+			// Sequence header start code
+			if(ThisByte == 0xb3)
+			{
+				SeqHead = true;
+				SeqHeadPos = Pos + i - 3;
+			}
+			// GOP start code
+			else if(ThisByte == 0xb8)
+			{
+				GOPBytes = 4;
+			}
+			// Picture start code
+			else if(ThisByte == 0x00)
+			{
+				if(SeqHead && Closed) EditPointTable[Picture] = SeqHeadPos;
+				SeqHead = false;
+
+				// Stop once we have started the target picture
+				if(Picture++ >= Target) break;
+			}
+		}
+
+		if(i < Bytes) break;
+
+		Pos += Bytes;
+	}
+
+	delete[] ScanBuffer;
+
+	EditPointScanned = Picture;
+}
+
+
 //! Get the next "installment" of essence data
 /*! \return Pointer to a data chunk holding the next data or a NULL pointer when no more remains
  *	\note If there is more data to come but it is not currently available the return value will be a pointer to an empty data chunk
@@ -392,15 +505,15 @@ Length MPEG2_VES_EssenceSubParser::Write(FileHandle InFile, UInt32 Stream, MXFFi
 
 //! Read the sequence header at the specified position in an MPEG2 file to build an essence descriptor
 /*! DRAGONS: Currently rather scrappy */
-MDObjectPtr MPEG2_VES_EssenceSubParser::BuildMPEG2VideoDescriptor(FileHandle InFile, UInt64 Start /*=0*/)
+MDObjectPtr MPEG2_VES_EssenceSubParser::BuildMPEG2VideoDescriptor(EssenceProbePtr &Probe, UInt64 Start /*=0*/)
 {
 	MDObjectPtr Ret;
 	const size_t BUFFERSIZE = 512;
 	UInt8 Buffer[BUFFERSIZE];
 
 	// Read the sequence header
-	FileSeek(InFile, Start);
-	if(FileRead(InFile, Buffer, BUFFERSIZE) < BUFFERSIZE) return Ret;
+	Probe->Seek(Start);
+	if(Probe->Read(Buffer, BUFFERSIZE) < BUFFERSIZE) return Ret;
 
 	UInt32 HSize = (Buffer[4] << 4) | (Buffer[5] >> 4);
 	UInt32 VSize = ((Buffer[5] & 0x0f) << 8) | (Buffer[6]);
@@ -458,9 +571,9 @@ MDObjectPtr MPEG2_VES_EssenceSubParser::BuildMPEG2VideoDescriptor(FileHandle InF
 	else
 	{
 		// Skip over the intra buffer and read the non-intra flag
-		FileSeek(InFile, Start + 11 + 64);
+		Probe->Seek(Start + 11 + 64);
 		UInt8 Flags;
-		FileRead(InFile, &Flags, 1);
+		Probe->Read(&Flags, 1);
 
 		LoadNonIntra = Flags & 0x01;
 	}
@@ -830,7 +943,14 @@ size_t MPEG2_VES_EssenceSubParser::ReadInternal(FileHandle InFile, UInt32 Stream
 	}
 
 	// Move to the start of the data
-	FileSeek(InFile, CurrentStart);
+	// DRAGONS: With a windowed (non-seekable) input this fails if the scanned data is larger than the window
+	if(FileSeek(InFile, CurrentStart) != 0)
+	{
+		error("Unable to return to the start of MPEG2 edit unit at 0x%s\n", Int64toHexString(CurrentStart, 8).c_str());
+		EndOfStream = true;
+		CachedDataSize = 0;
+		return 0;
+	}
 
 	Length Ret = CurrentPos - CurrentStart;
 
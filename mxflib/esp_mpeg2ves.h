@@ -80,6 +80,10 @@ namespace mxflib
 
 		Position GOPStartTimecode;							//!< The most recently extracted GOP start timecode
 
+		std::map<Position, Position> EditPointTable;		//!< Table of edit points found by ScanEditPoints(), giving the file offset for each picture number
+		Position EditPointScanned;							//!< All edit points before this picture number are in EditPointTable
+		bool EditPointScanDone;								//!< Set once ScanEditPoints() has reached the end of the file
+
 	public:
 		//! Class for EssenceSource objects for parsing/sourcing MPEG-VES essence
 		class ESP_EssenceSource : public EssenceSubParserBase::ESP_EssenceSource
@@ -165,6 +169,17 @@ namespace mxflib
 				// We always return one edit unit at a time
 				return true;
 			}
+
+			//! Seek so that the next data read is the edit point at or before the given edit unit
+			virtual bool SeekToEditUnit(Position EditUnit)
+			{
+				if(!EssenceSubParserBase::ESP_EssenceSource::SeekToEditUnit(EditUnit)) return false;
+
+				// Discard any part-read edit unit from the previous position
+				BytesRemaining = 0;
+
+				return true;
+			}
 		};
 
 		// Give our essence source class privilaged access
@@ -184,6 +199,9 @@ namespace mxflib
 			EndOfStream = false;
 
 			GOPStartTimecode = 0;
+
+			EditPointScanned = 0;
+			EditPointScanDone = false;
 		}
 
 		//! Build a new parser of this type and return a pointer to it
@@ -192,8 +210,10 @@ namespace mxflib
 		//! Report the extensions of files this sub-parser is likely to handle
 		virtual StringList HandledExtensions(void);
 
-		//! Examine the open file and return a list of essence descriptors
-		virtual EssenceStreamDescriptorList IdentifyEssence(FileHandle InFile);
+		using EssenceSubParser::IdentifyEssence;
+
+		//! Examine an essence file via a shared probe buffer and return a list of essence descriptors
+		virtual EssenceStreamDescriptorList IdentifyEssence(EssenceProbePtr &Probe);
 
 		//! Examine the open file and return the wrapping options known by this parser
 		virtual WrappingOptionList IdentifyWrappingOptions(FileHandle InFile, EssenceStreamDescriptor &Descriptor);
@@ -210,6 +230,13 @@ namespace mxflib
 		//! Get the current position in SetEditRate() sized edit units
 		virtual Position GetCurrentPosition(void);
 
+		//! Does this essence parser support SeekToEditUnit()
+		/*! \note Only supported at the native edit rate */
+		virtual bool CanSeek(void) { return EditRatio == 1; }
+
+		//! Seek so that the next read is the edit point at or before the given edit unit
+		virtual bool SeekToEditUnit(FileHandle InFile, Position EditUnit);
+
 
 		// Index table functions
 		
@@ -246,7 +273,7 @@ namespace mxflib
 
 	protected:
 		//! Read the sequence header at the specified position in an MPEG2 file to build an essence descriptor
-		MDObjectPtr BuildMPEG2VideoDescriptor(FileHandle InFile, UInt64 Start = 0);
+		MDObjectPtr BuildMPEG2VideoDescriptor(EssenceProbePtr &Probe, UInt64 Start = 0);
 
 		//! Scan the essence to calculate how many bytes to transfer for the given edit unit count
 		size_t ReadInternal(FileHandle InFile, UInt32 Stream, UInt64 Count);
@@ -254,6 +281,9 @@ namespace mxflib
 		//! Get a byte from the current stream
 		int BuffGetU8(FileHandle InFile);
 
+		//! Scan the file to extend EditPointTable until it includes all edit points up to the given picture
+		void ScanEditPoints(FileHandle InFile, Position Target);
+
 	};
 
 }
@@ -47,7 +47,7 @@ namespace
 
 //! Examine the open file and return a list of essence descriptors
 /*! \note This call will modify properties SampleRate, DataStart and DataSize */
-EssenceStreamDescriptorList mxflib::WAVE_PCM_EssenceSubParser::IdentifyEssence(FileHandle InFile)
+EssenceStreamDescriptorList mxflib::WAVE_PCM_EssenceSubParser::IdentifyEssence(EssenceProbePtr &Probe)
 {
 	int BufferBytes;
 	UInt8 Buffer[12];
@@ -55,8 +55,8 @@ EssenceStreamDescriptorList mxflib::WAVE_PCM_EssenceSubParser::IdentifyEssence(F
 	EssenceStreamDescriptorList Ret;
 
 	// Read the first 12 bytes of the file to allow us to identify it
-	FileSeek(InFile, 0);
-	BufferBytes = (int)FileRead(InFile, Buffer, 12);
+	Probe->Seek(0);
+	BufferBytes = (int)Probe->Read(Buffer, 12);
 
 	// If the file is smaller than 12 bytes give up now!
 	if(BufferBytes < 12) return Ret;
@@ -67,7 +67,7 @@ EssenceStreamDescriptorList mxflib::WAVE_PCM_EssenceSubParser::IdentifyEssence(F
 	// Just because the file is a RIFF file doesn't mean it's a wave file!
 	if((Buffer[8] != 'W') || (Buffer[9] != 'A') || (Buffer[10] != 'V') || (Buffer[11] != 'E')) return Ret;
 
-	MDObjectPtr DescObj = BuildWaveAudioDescriptor(InFile, 0);
+	MDObjectPtr DescObj = BuildWaveAudioDescriptor(Probe, 0);
 
 	// Quit here if we couldn't build an essence descriptor
 	if(!DescObj) return Ret;
@@ -538,7 +538,7 @@ Position WAVE_PCM_EssenceSubParser::CalcCurrentPosition(void)
 
 //! Read the sequence header at the specified position in a Wave file to build an essence descriptor
 /*! \note This call will modify properties SampleRate, DataStart and DataSize */
-MDObjectPtr mxflib::WAVE_PCM_EssenceSubParser::BuildWaveAudioDescriptor(FileHandle InFile, UInt64 Start /*=0*/)
+MDObjectPtr mxflib::WAVE_PCM_EssenceSubParser::BuildWaveAudioDescriptor(EssenceProbePtr &Probe, UInt64 Start /*=0*/)
 {
 	const unsigned int ID_RIFF = 0x52494646;		//! "RIFF"
 	const unsigned int ID_fmt  = 0x666d7420;		//! "fmt "
@@ -546,15 +546,15 @@ MDObjectPtr mxflib::WAVE_PCM_EssenceSubParser::BuildWaveAudioDescriptor(FileHand
 
 	MDObjectPtr Ret;
 
-	FileSeek(InFile, Start);
-	U32Pair Header = ReadRIFFHeader(InFile);
+	Probe->Seek(Start);
+	U32Pair Header = Probe->ReadRIFFHeader();
 
 	// Can't build a descriptor if it isn't a RIFF file!
 	if(Header.first != ID_RIFF) return Ret;
 	if(Header.second < 4) return Ret;
 
 	// Read the RIFF file type (always 4 bytes)
-	DataChunkPtr ChunkData = FileReadChunk(InFile, 4);
+	DataChunkPtr ChunkData = Probe->ReadChunk(4);
 	
 	// Can't build a descriptor if it isn't a WAVE file!
 	if(memcmp(ChunkData->Data, "WAVE", 4) != 0) return Ret;
@@ -564,14 +564,14 @@ MDObjectPtr mxflib::WAVE_PCM_EssenceSubParser::BuildWaveAudioDescriptor(FileHand
 	// DRAGONS: "LIST" chunks are "sets" and are not yet supported
 	for(;;)
 	{
-		Header = ReadRIFFHeader(InFile);
+		Header = Probe->ReadRIFFHeader();
 
 		// End of file?
 		if((Header.first == 0) && (Header.second == 0)) break;
 
 		if(Header.first == ID_fmt)
 		{
-			ChunkData = FileReadChunk(InFile, Header.second);
+			ChunkData = Probe->ReadChunk(Header.second);
 			if(ChunkData->Size < 16) return Ret;
 
 			UInt16 AudioFormat = GetU16_LE(&ChunkData->Data[0]);
@@ -610,16 +610,20 @@ MDObjectPtr mxflib::WAVE_PCM_EssenceSubParser::BuildWaveAudioDescriptor(FileHand
 		else if(Header.first == ID_data)
 		{
 			// Record the location of the audio data
-			DataStart = FileTell(InFile);
+			DataStart = Probe->Tell();
 			DataSize = Header.second;
 
+			// Stop once we have the format - there is nothing after the audio data that we need, and
+			// reading past it would run outside the window of a non-seekable input
+			if(Ret) break;
+
 			// ...and skip the chunk value
-			FileSeek(InFile, FileTell(InFile) + Header.second);
+			Probe->Seek(Probe->Tell() + Header.second);
 		}
 		else
 		{
 			// Skip the chunk value
-			FileSeek(InFile, FileTell(InFile) + Header.second);
+			Probe->Seek(Probe->Tell() + Header.second);
 		}
 	}
 
@@ -627,6 +631,85 @@ MDObjectPtr mxflib::WAVE_PCM_EssenceSubParser::BuildWaveAudioDescriptor(FileHand
 }
 
 
+//! Seek so that the next read is the given edit unit
+/*! \return true if the seek succeeded */
+bool mxflib::WAVE_PCM_EssenceSubParser::SeekToEditUnit(FileHandle InFile, Position EditUnit)
+{
+	if((SampleSize == 0) || (EditUnit < 0)) return false;
+
+	// Ensure we know the wrapping sequence
+	if((ConstSamples == 0) && (SampleSequenceSize == 0)) CalcWrappingSequence(UseEditRate);
+
+	// Work out how many samples precede this edit unit
+	Position Samples;
+	if(ConstSamples != 0)
+	{
+		Samples = EditUnit * ConstSamples;
+	}
+	else
+	{
+		if((SampleSequenceSize == 0) || (SampleSequence == NULL)) return false;
+
+		Position SeqSamples = 0;
+		int i;
+		for(i=0; i < SampleSequenceSize; i++) SeqSamples += SampleSequence[i];
+
+		// Complete sequences, then the part sequence
+		Samples = (EditUnit / SampleSequenceSize) * SeqSamples;
+		int Remain = static_cast<int>(EditUnit % SampleSequenceSize);
+		for(i=0; i < Remain; i++) Samples += SampleSequence[i];
+
+		// The next edit unit will use this entry in the sequence
+		SequencePos = Remain;
+	}
+
+	Position Offset = Samples * SampleSize;
+	if(Offset > DataSize) return false;
+
+	// DRAGONS: BytePosition is absolute once reading has started (0 means the start of the data chunk)
+	BytePosition = DataStart + Offset;
+	CurrentPosition = EditUnit;
+	CachedDataSize = static_cast<size_t>(-1);
+
+	return true;
+}
+
+
+//! Get the number of edit units in the essence, if this is known without reading it
+/*! Only complete edit units are counted, as a partial edit unit at the end of the data is not read.
+ *  \return The duration in SetEditRate() sized edit units, or -1 if not known (including when clip wrapping)
+ */
+Length mxflib::WAVE_PCM_EssenceSubParser::GetEssenceDuration(FileHandle InFile)
+{
+	if((SampleSize == 0) || (!SelectedWrapping) || (SelectedWrapping->ThisWrapType != WrappingOption::Frame)) return -1;
+
+	// Ensure we know the wrapping sequence
+	if((ConstSamples == 0) && (SampleSequenceSize == 0)) CalcWrappingSequence(UseEditRate);
+
+	Length Samples = DataSize / SampleSize;
+
+	if(ConstSamples != 0) return Samples / ConstSamples;
+
+	if((SampleSequenceSize == 0) || (SampleSequence == NULL)) return -1;
+
+	Length SeqSamples = 0;
+	int i;
+	for(i=0; i < SampleSequenceSize; i++) SeqSamples += SampleSequence[i];
+	if(SeqSamples == 0) return -1;
+
+	// Complete sequences, then any complete edit units from the part sequence
+	Length Ret = (Samples / SeqSamples) * SampleSequenceSize;
+	Samples %= SeqSamples;
+	for(i=0; (i < SampleSequenceSize) && (Samples >= static_cast<Length>(SampleSequence[i])); i++)
+	{
+		Samples -= SampleSequence[i];
+		Ret++;
+	}
+
+	return Ret;
+}
+
+
 //! Get the number of sample this edit unit
 UInt32 mxflib::WAVE_PCM_EssenceSubParser::SamplesThisEditUnit(void)
 {
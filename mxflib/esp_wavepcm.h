@@ -135,6 +135,17 @@ namespace mxflib
 			//! Set a source type or parser specific option
 			/*! \return true if the option was successfully set */
 			virtual bool SetOption(std::string Option, Int64 Param = 0);
+
+			//! Seek so that the next data read is the given edit unit
+			virtual bool SeekToEditUnit(Position EditUnit)
+			{
+				if(!EssenceSubParserBase::ESP_EssenceSource::SeekToEditUnit(EditUnit)) return false;
+
+				// Discard any part-read edit unit from the previous position
+				BytesRemaining = 0;
+
+				return true;
+			}
 		};
 
 		// Give our essence source class privilaged access
@@ -181,8 +192,10 @@ namespace mxflib
 			return ExtensionList;
 		}
 
-		//! Examine the open file and return a list of essence descriptors
-		virtual EssenceStreamDescriptorList IdentifyEssence(FileHandle InFile);
+		using EssenceSubParser::IdentifyEssence;
+
+		//! Examine an essence file via a shared probe buffer and return a list of essence descriptors
+		virtual EssenceStreamDescriptorList IdentifyEssence(EssenceProbePtr &Probe);
 
 		//! Examine the open file and return the wrapping options known by this parser
 		virtual WrappingOptionList IdentifyWrappingOptions(FileHandle InFile, EssenceStreamDescriptor &Descriptor);
@@ -230,6 +243,15 @@ namespace mxflib
 		//! Get the current position in SetEditRate() sized edit units
 		virtual Position GetCurrentPosition(void) { return CurrentPosition; }
 
+		//! Does this essence parser support SeekToEditUnit()
+		virtual bool CanSeek(void) { return true; }
+
+		//! Seek so that the next read is the given edit unit
+		virtual bool SeekToEditUnit(FileHandle InFile, Position EditUnit);
+
+		//! Get the number of edit units in the essence, if this is known without reading it
+		virtual Length GetEssenceDuration(FileHandle InFile);
+
 		//! Read a number of wrapping items from the specified stream and return them in a data chunk
 		virtual DataChunkPtr Read(FileHandle InFile, UInt32 Stream, UInt64 Count = 1/*, IndexTablePtr Index = NULL*/);
 
@@ -278,7 +300,7 @@ namespace mxflib
 		UInt32 GetBPE_Internal(UInt32 KAGSize, UInt32 SampleSize);
 
 		//! Read the sequence header at the specified position in an MPEG2 file to build an essence descriptor
-		MDObjectPtr BuildWaveAudioDescriptor(FileHandle InFile, UInt64 Start = 0);
+		MDObjectPtr BuildWaveAudioDescriptor(EssenceProbePtr &Probe, UInt64 Start = 0);
 
 		//! Scan the essence to calculate how many bytes to transfer for the given edit unit count
 		size_t ReadInternal(FileHandle InFile, UInt32 Stream, UInt64 Count);
@@ -1427,6 +1427,16 @@ void GCWriter::WriteRaw(KLVObjectPtr Object)
 
 
 
+namespace
+{
+	//! Key of filler KLVs dispatched to the GCReader filler handler
+	const UInt8 GCReaderFillerKey[16] = { 0x06, 0x0E, 0x2B, 0x34, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x10, 0x01, 0x00, 0x00, 0x00 };
+
+	//! Key of encrypted KLVs dispatched to the GCReader encryption handler
+	const UInt8 GCReaderEncryptedKey[16] = { 0x06, 0x0E, 0x2B, 0x34, 0x02, 0x04, 0x01, 0x07, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x7e, 0x01, 0x00 };
+}
+
+
 //! Create a new GCReader, optionally with a given default item handler and filler handler
 /*! \note The default handler receives all KLVs without a specific handler (except fillers)
  *        The filler handler receives all filler KLVs
@@ -1441,6 +1451,20 @@ GCReader::GCReader( MXFFilePtr File, GCReadHandlerPtr DefaultHandler /*=NULL*/,
 	PushBackRequested = false;
 
 	StreamOffset = 0;
+
+	ReadBlockSize = 0;
+	BlockStart = 0;
+	BlockEnd = 0;
+
+	SkipUnhandled = false;
+
+	ReadAheadEditUnits = 0;
+	ReadAheadStart = -1;
+	ReadAheadNext = -1;
+	ReadAheadEnd = -1;
+
+	Follow = false;
+	FollowSize = -1;
 }
 
 
@@ -1451,9 +1475,8 @@ GCReader::GCReader( MXFFilePtr File, GCReadHandlerPtr DefaultHandler /*=NULL*/,
  */
 bool GCReader::ReadFromFile(bool SingleKLV /*=false*/)
 {
-	// Seek to the offset of the "next" KLV
+	// DRAGONS: All reads are made at FileOffset using positional reads, so the file pointer is neither used nor moved
 	mxflib_assert(File);
-	File->Seek(FileOffset);
 
 	// Force us to stop as soon as we have read a single KLV if requested
 	StopNow = SingleKLV;
@@ -1462,8 +1485,17 @@ bool GCReader::ReadFromFile(bool SingleKLV /*=false*/)
 	// Read and dispatch until requested to stop
 	do
 	{
+		// Skip any KLVs that will not be handled, without building KLVObjects for them
+		if(SkipUnhandled && !SkipToHandled()) return false;
+
+		// Ask for upcoming edit units to be read in the background
+		if(ReadAheadIndex) ReadAhead();
+
+		// When following a growing file stop before any KLV that has not yet been completely written
+		if(Follow && !IsKLVAvailable()) return false;
+
 		// Get the next KLV
-		KLVObjectPtr Object = File->ReadKLV();
+		KLVObjectPtr Object = ReadKLV();
 
 		// Exit if we failed
 		if(!Object)	return false;
@@ -1474,12 +1506,8 @@ bool GCReader::ReadFromFile(bool SingleKLV /*=false*/)
 		// Handle the data
 		bool Ret = HandleData(Object);
 		
-		// Perform a pushback (if requested) by seeking to the start of this KLV and not updating offsets
-		if(StopNow && PushBackRequested)
-		{
-			File->Seek(FileOffset);
-		}
-		else
+		// Perform a pushback (if requested) by not updating offsets
+		if(!(StopNow && PushBackRequested))
 		{
 			// Advance to the start of the next KLV and update stream offset 
 			Length Size = Object->GetKLSize() + Object->GetLength();
@@ -1490,9 +1518,6 @@ bool GCReader::ReadFromFile(bool SingleKLV /*=false*/)
 		// Abort if the handler errored
 		if(!Ret) return false;
 
-		// Seek to the next KLV
-		File->Seek(FileOffset);
-
 	} while(!StopNow);
 
 	// We will drop out of the loop on two conditions:
@@ -1504,6 +1529,202 @@ bool GCReader::ReadFromFile(bool SingleKLV /*=false*/)
 }
 
 
+//! Read the key and length of the KLV at FileOffset, from the current coalesced read block if used
+/*! \return NULL if no more valid KLVs
+ */
+KLVObjectPtr GCReader::ReadKLV(void)
+{
+	KLVObjectPtr Ret = new KLVObject();
+
+	// The destination is the file itself, as for a KLV read with MXFFile::ReadKLV(), even when the source is a block
+	Ret->SetDestination(File, FileOffset);
+
+	// Read the key and length from the block if using coalesced reads
+	if(ReadBlockSize)
+	{
+		if(!LoadBlock()) return NULL;
+		Ret->SetSource(BlockFile, FileOffset);
+	}
+	else
+	{
+		Ret->SetSource(File, FileOffset);
+	}
+
+	// Returning NULL if no more valid KLVs
+	if((Ret->ReadKL() < 17) || (Ret->GetLength() < 0)) return NULL;
+
+	// If the value is not wholly within the block it is read from the file itself if the handler requests it
+	// DRAGONS: This only changes the source file, the key and length sizes already read are kept
+	if(ReadBlockSize && ((FileOffset + Ret->GetKLSize() + Ret->GetLength()) > BlockEnd)) Ret->SetSource(File, FileOffset);
+
+	return Ret;
+}
+
+
+//! Ensure that the KL at FileOffset is wholly within the current coalesced read block, reading a new block if required
+/*! \return false if no more data could be read
+ */
+bool GCReader::LoadBlock(void)
+{
+	// DRAGONS: A short block at the end of the file is re-read in case the file has grown
+	if(BlockFile && (FileOffset >= BlockStart) && ((FileOffset + static_cast<Position>(MaxKLSize)) <= BlockEnd)) return true;
+
+	// Read whole aligned blocks, two if the key and length cross a block boundary
+	Position Start = FileOffset - (FileOffset % static_cast<Position>(ReadBlockSize));
+	Position End = FileOffset + static_cast<Position>(MaxKLSize);
+	if(End % static_cast<Position>(ReadBlockSize)) End += ReadBlockSize - (End % static_cast<Position>(ReadBlockSize));
+
+	DataChunkPtr Buffer = File->ReadAt(Start, static_cast<size_t>(End - Start));
+	if((Start + static_cast<Position>(Buffer->Size)) < (FileOffset + 17))
+	{
+		BlockFile = NULL;
+		return false;
+	}
+
+	BlockFile = new MXFFile;
+	BlockFile->OpenMemory(Buffer, Start);
+
+	BlockStart = Start;
+	BlockEnd = Start + Buffer->Size;
+
+	return true;
+}
+
+
+//! Advance FileOffset past any KLVs that would not be dispatched to a handler
+/*! Only the key and length of each skipped KLV are read
+ *  \return false if no more valid KLVs
+ */
+bool GCReader::SkipToHandled(void)
+{
+	KLInfo KL;
+
+	for(;;)
+	{
+		// Read the key and length at the current offset (from the block if using coalesced reads)
+		if(ReadBlockSize)
+		{
+			if(!LoadBlock()) return false;
+			BlockFile->ReadKL(FileOffset, KL);
+		}
+		else
+		{
+			File->ReadKL(FileOffset, KL);
+		}
+		if(KL.KLSize < 16) return false;
+
+		// Partition packs are never skipped - they end the read
+		if(IsPartitionKey(KL.Key)) break;
+
+		// Leave any invalid length for the full KLV read to report
+		if(KL.ValueLength < 0) break;
+
+		if(IsHandled(KL.Key)) break;
+
+		// Step over the unwanted KLV and update stream offset
+		Length Size = KL.End() - FileOffset;
+		FileOffset += Size;
+		StreamOffset += Size;
+	}
+
+	return true;
+}
+
+
+//! Determine if a KLV with the given key would be dispatched to a handler by HandleData()
+/*! \note Encrypted KLVs are always handled if there is an encryption handler, as the track is not known until the value is read
+ */
+bool GCReader::IsHandled(const UInt8 *Key)
+{
+	if((Key[8] == 3) && (memcmp(Key, GCReaderFillerKey, 16) == 0)) return FillerHandler ? true : false;
+
+	if(EncryptionHandler && (Key[5] == 4) && (memcmp(Key, GCReaderEncryptedKey, 16) == 0)) return true;
+
+	if(DefaultHandler) return true;
+
+	UInt32 TrackNumber = Handlers.size() ? GetGCTrackNumber(Key) : 0;
+	if(TrackNumber == 0) return false;
+
+	return Handlers.find(TrackNumber) != Handlers.end();
+}
+
+
+//! Request read-ahead of the next few edit units if the current position is beyond the previous request
+void GCReader::ReadAhead(void)
+{
+	// Nothing to do until half of the previous request has been read (unless we have moved back before it)
+	if((StreamOffset < ReadAheadNext) && (StreamOffset >= ReadAheadStart)) return;
+
+	// Locate the edit unit containing the current stream position
+	Position EditUnit;
+	Length Duration = -1;
+	if(ReadAheadIndex->EditUnitByteCount)
+	{
+		EditUnit = StreamOffset / ReadAheadIndex->EditUnitByteCount;
+	}
+	else
+	{
+		Duration = ReadAheadIndex->GetDuration();
+		if(Duration <= 0) return;
+
+		// Binary search for the last edit unit starting at or before the current position
+		Position Low = 0;
+		Position High = Duration - 1;
+		while(Low < High)
+		{
+			Position Mid = (Low + High + 1) / 2;
+			if(ReadAheadIndex->Lookup(Mid, 0, false)->Location <= StreamOffset) Low = Mid; else High = Mid - 1;
+		}
+		EditUnit = Low;
+	}
+
+	// Locate the end of the read-ahead range (limited to the last indexed edit unit for VBR)
+	Position LastEditUnit = EditUnit + ReadAheadEditUnits;
+	if((Duration > 0) && (LastEditUnit >= Duration)) LastEditUnit = Duration - 1;
+
+	Position End = ReadAheadIndex->Lookup(LastEditUnit, 0, false)->Location;
+	if(End <= StreamOffset) return;
+
+	// Only request the part not already requested
+	Position Start = StreamOffset;
+	if((ReadAheadEnd > Start) && (ReadAheadStart <= Start)) Start = ReadAheadEnd;
+
+	// DRAGONS: Stream offsets are mapped to file offsets assuming the range is in this partition, which is fine for a hint
+	if(End > Start) File->ReadAhead(FileOffset + (Start - StreamOffset), End - Start);
+
+	ReadAheadStart = StreamOffset;
+	ReadAheadNext = StreamOffset + (End - StreamOffset) / 2;
+	ReadAheadEnd = End;
+}
+
+
+//! Determine if the KLV at FileOffset has been completely written (used in follow mode)
+/*! \note Partition packs are reported as available as they end the read
+ */
+bool GCReader::IsKLVAvailable(void)
+{
+	KLInfo KL;
+	if(ReadBlockSize)
+	{
+		if(!LoadBlock()) return false;
+		if(!BlockFile->ReadKL(FileOffset, KL)) return false;
+	}
+	else
+	{
+		if(!File->ReadKL(FileOffset, KL)) return false;
+	}
+
+	if(IsPartitionKey(KL.Key)) return true;
+
+	Position End = KL.End();
+
+	// Only check the file size again if the last known size is too small
+	if(End > FollowSize) FollowSize = File->Size();
+
+	return End <= FollowSize;
+}
+
+
 //! Force a KLVObject to be handled
 /*! \note This is not the normal way that the GCReader is used, but allows the encryption handler
  *        to push the decrypted data back to the GCReader to pass to the appropriate handler
@@ -1516,8 +1737,7 @@ bool GCReader::HandleData(KLVObjectPtr Object)
 	// false for all GC sets and packs. Once this matches we can do a full memcmp.
 	if(Object->GetUL()->GetValue()[8] == 3)
 	{
-		const UInt8 FillerKey[16] = { 0x06, 0x0E, 0x2B, 0x34, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x10, 0x01, 0x00, 0x00, 0x00 };
-		if( memcmp(Object->GetUL()->GetValue(), FillerKey, 16) == 0 )
+		if( memcmp(Object->GetUL()->GetValue(), GCReaderFillerKey, 16) == 0 )
 		{
 			if(FillerHandler) return FillerHandler->HandleData(this, Object);
 			else return true;
@@ -1531,8 +1751,7 @@ bool GCReader::HandleData(KLVObjectPtr Object)
 		// but is false for standard GC sets and packs. Once this matches we can do a full memcmp.
 		if(Object->GetUL()->GetValue()[5] == 4)
 		{
-			const UInt8 EncryptedKey[16] = { 0x06, 0x0E, 0x2B, 0x34, 0x02, 0x04, 0x01, 0x07, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x7e, 0x01, 0x00 };
-			if( memcmp(Object->GetUL()->GetValue(), EncryptedKey, 16) == 0 )
+			if( memcmp(Object->GetUL()->GetValue(), GCReaderEncryptedKey, 16) == 0 )
 			{
 				return EncryptionHandler->HandleData(this, Object);
 			}
@@ -1587,6 +1806,13 @@ BodyReader::BodyReader(MXFFilePtr File)
 	AtEOF = false;					// We don't know if we are at the end of the file
 
 	CurrentBodySID = 0;				// We don't know what BodySID we are now in
+
+	GCRReadBlockSize = 0;			// Read each KLV separately unless told otherwise
+	GCRSkipUnhandled = false;		// Read every KLV unless told otherwise
+
+	Follow = false;					// Assume the file is complete unless told otherwise
+	FollowSize = -1;
+	FollowPartitionPos = -1;
 };
 
 
@@ -1595,8 +1821,7 @@ BodyReader::BodyReader(MXFFilePtr File)
  */
 Position BodyReader::Seek(Position Pos /*=0*/)
 {
-	File->Seek(Pos);				// Move the file pointer
-	CurrentPos = File->Tell();		// Find out where we ended up
+	CurrentPos = Pos;				// Record the new position (reads are positional, so the file pointer is not used)
 	NewPos = true;					// Force reading to be reinitialized
 
 	AtPartition = false;			// We don't know if we are at a partition
@@ -1638,8 +1863,7 @@ Position BodyReader::Seek(UInt32 BodySID, Position Pos)
 		// If that was unknown we need to read the partition pack
 		if(StreamOffset == -1)
 		{
-			File->Seek(PartInfo->GetByteOffset());
-			PartInfo->ThePartition = File->ReadPartition();
+			PartInfo->ThePartition = File->ReadPartitionAt(PartInfo->GetByteOffset());
 
 			if(PartInfo->ThePartition)
 			{
@@ -1652,8 +1876,7 @@ Position BodyReader::Seek(UInt32 BodySID, Position Pos)
 		{
 			if(!PartInfo->ThePartition)
 			{
-				File->Seek(PartInfo->GetByteOffset());
-				PartInfo->ThePartition = File->ReadPartition();
+				PartInfo->ThePartition = File->ReadPartitionAt(PartInfo->GetByteOffset());
 			}
 
 			if(!PartInfo->ThePartition)
@@ -1662,13 +1885,13 @@ Position BodyReader::Seek(UInt32 BodySID, Position Pos)
 				return -1;
 			}
 		
-			if(!(PartInfo->ThePartition->SeekEssence()))
+			EssenceStart = PartInfo->ThePartition->LocateEssence();
+			if(EssenceStart < 0)
 			{
 				error("BodyReader::Seek(%d, 0x%s) failed to locate essence in the predicted partition\n", BodySID, Int64toHexString(Pos).c_str());
 				return -1;
 			}
 
-			EssenceStart = File->Tell();
 			PartInfo->SetEssenceStart(EssenceStart);
 		}
 
@@ -1713,15 +1936,9 @@ Position BodyReader::Seek(UInt32 BodySID, Position Pos)
 		PartInfo = (*it).second;
 	}
 
-	// Seek to the requested location
+	// Record the requested location
 	// DRAGONS: Seek beyond end of file is a silent failure as this may be an incomplete file
-	if(File->Seek(PredictedPos) != 0)
-	{
-		return -1;
-	}
-
-	// Record the current file position
-	CurrentPos = File->Tell();
+	CurrentPos = PredictedPos;
 
 	// As we managed to seek, we are now in the requested BodySID
 	CurrentBodySID = BodySID;
@@ -1748,35 +1965,28 @@ bool BodyReader::IsAtPartition(void)
 	if(AtPartition) return true;
 
 	// Otherwise read the next key to find out
-	File->Seek(CurrentPos);
-	ULPtr ThisUL = File->ReadKey();
+	UInt8 Key[16];
 
 	// Can't be true if we can't read a key
-	if(!ThisUL) return false;
+	if(File->ReadAt(CurrentPos, Key, 16) != 16) return false;
 
 	// So - is this a partition pack?
-	return IsPartitionKey(ThisUL->GetValue());
+	return IsPartitionKey(Key);
 }
 
 
 //! Are we currently at the end of the file?
 bool BodyReader::Eof(void)
 {
+	// When following a growing file we are at the end until the next KLV has been completely written
+	if(Follow) return !IsKLVAvailable(CurrentPos);
+
 	// Return true if we know we are the end of the file
 	if(AtEOF) return true;
 
-	// Otherwise try and find out
-	File->Seek(CurrentPos);
-	
-	// Did the seek set EOF?
-	if(File->Eof()) 
-	{
-		AtEOF = true;
-		return true;
-	}
-
-	// Did the seek place us earlier than we requested? (almost certainly because the file is shorter)
-	if((Position)File->Tell() < CurrentPos) 
+	// Otherwise try and find out - if we can't read a byte at the current position we are at the end
+	UInt8 Byte;
+	if(File->ReadAt(CurrentPos, &Byte, 1) == 0)
 	{
 		AtEOF = true;
 		return true;
@@ -1801,6 +2011,15 @@ bool BodyReader::MakeGCReader(UInt32 BodySID, GCReadHandlerPtr DefaultHandler /*
 
 	// Set the encryption handler if one is configured
 	if(GCREncryptionHandler) Reader->SetEncryptionHandler(GCREncryptionHandler);
+
+	// Set coalesced reads if configured
+	if(GCRReadBlockSize) Reader->SetReadBlockSize(GCRReadBlockSize);
+
+	// Set skipping of unhandled KLVs if configured
+	if(GCRSkipUnhandled) Reader->SetSkipUnhandled();
+
+	// Set follow mode if configured
+	if(Follow) Reader->SetFollow();
 	
 	// Insert into the map
 	Readers[BodySID] = Reader;
@@ -1810,6 +2029,145 @@ bool BodyReader::MakeGCReader(UInt32 BodySID, GCReadHandlerPtr DefaultHandler /*
 
 
 
+//! Set the coalesced read size for all GCReaders
+/*! Applies to all existing GCReaders and any created later - see GCReader::SetReadBlockSize()
+ */
+void BodyReader::SetReadBlockSize(size_t Size)
+{
+	GCRReadBlockSize = Size;
+
+	std::map<UInt32, GCReaderPtr>::iterator it = Readers.begin();
+	while(it != Readers.end())
+	{
+		(*it).second->SetReadBlockSize(Size);
+		it++;
+	}
+}
+
+
+//! Set whether KLVs that no handler would receive are skipped by all GCReaders
+/*! Applies to all existing GCReaders and any created later - see GCReader::SetSkipUnhandled()
+ */
+void BodyReader::SetSkipUnhandled(bool Skip /*=true*/)
+{
+	GCRSkipUnhandled = Skip;
+
+	std::map<UInt32, GCReaderPtr>::iterator it = Readers.begin();
+	while(it != Readers.end())
+	{
+		(*it).second->SetSkipUnhandled(Skip);
+		it++;
+	}
+}
+
+
+//! Enable or disable follow mode for files that are still being written
+/*! Applies to all existing GCReaders and any created later - see GCReader::SetFollow()
+ */
+void BodyReader::SetFollow(bool Enable /*=true*/)
+{
+	Follow = Enable;
+	FollowSize = -1;
+
+	std::map<UInt32, GCReaderPtr>::iterator it = Readers.begin();
+	while(it != Readers.end())
+	{
+		(*it).second->SetFollow(Enable);
+		it++;
+	}
+}
+
+
+//! Get the index table built from the segments found so far in follow mode for a given IndexSID
+IndexTablePtr BodyReader::GetFollowIndex(UInt32 IndexSID)
+{
+	std::map<UInt32, IndexTablePtr>::iterator it = FollowIndexes.find(IndexSID);
+	if(it != FollowIndexes.end()) return (*it).second;
+
+	IndexTablePtr Ret = new IndexTable;
+	Ret->IndexSID = IndexSID;
+	FollowIndexes[IndexSID] = Ret;
+
+	return Ret;
+}
+
+
+//! Determine if the file currently extends at least as far as a given position (used in follow mode)
+bool BodyReader::IsAvailable(Position End)
+{
+	// Only check the file size again if the last known size is too small, so each poll costs one check
+	if(End > FollowSize) FollowSize = File->Size();
+
+	return End <= FollowSize;
+}
+
+
+//! Determine if the KLV at a given position has been completely written (used in follow mode)
+/*! For partition packs this includes any header metadata and index table segments that follow
+ */
+bool BodyReader::IsKLVAvailable(Position Pos)
+{
+	KLInfo KL;
+	if(!File->ReadKL(Pos, KL)) return false;
+
+	Position End = KL.End();
+	if(!IsAvailable(End)) return false;
+
+	// Partition packs are only usable once the header metadata and index that follow them are also complete
+	if(IsPartitionKey(KL.Key))
+	{
+		if(!FollowPack || (FollowPack->GetLocation() != Pos))
+		{
+			FollowPack = File->ReadPartitionAt(Pos);
+			if(!FollowPack) return false;
+		}
+
+		// DRAGONS: LocateEssence() reads the key and length following the pack, so check they are complete first
+		if(!File->ReadKL(End, KL)) return false;
+
+		End = FollowPack->LocateEssence();
+		if((End < 0) || !IsAvailable(End)) return false;
+	}
+
+	return true;
+}
+
+
+//! Record a newly read partition in the RIP and add any index table segments to the follow mode index tables
+void BodyReader::FollowPartition(PartitionPtr ThisPartition)
+{
+	// Only process each partition once, even if we seek back and read it again
+	Position Location = ThisPartition->GetLocation();
+	if(Location <= FollowPartitionPos) return;
+	FollowPartitionPos = Location;
+
+	Position EssencePos = ThisPartition->LocateEssence();
+	if(EssencePos < 0) return;
+
+	UInt32 BodySID = ThisPartition->GetUInt(BodySID_UL);
+	UInt32 IndexSID = ThisPartition->GetUInt(IndexSID_UL);
+
+	// Add to the RIP, unless it is already listed
+	if(File->FileRIP.find(Location) == File->FileRIP.end())
+	{
+		PartitionInfoPtr Info = File->FileRIP.AddPartition(ThisPartition, Location, BodySID);
+		Info->SetSIDs(BodySID, IndexSID);
+		Info->SetStreamOffset(ThisPartition->GetInt64(BodyOffset_UL));
+		Info->SetEssenceStart(EssencePos);
+		File->FileRIP.isGenerated = true;
+	}
+
+	// Add any index table segments - these immediately precede the essence
+	Length IndexSize = ThisPartition->GetInt64(IndexByteCount_UL);
+	if(IndexSID && (IndexSize > 0))
+	{
+		DataChunkPtr IndexChunk = File->ReadAt(EssencePos - IndexSize, static_cast<size_t>(IndexSize));
+
+		GetFollowIndex(IndexSID)->AddSegments(IndexChunk);
+	}
+}
+
+
 //! Read from file
 /*! All KLVs are dispatched to handlers
  *  Stops reading at the next partition pack unless SingleKLV is true when only one KLV is dispatched
@@ -1833,10 +2191,18 @@ bool BodyReader::ReadFromFile(bool SingleKLV /*=false*/)
 		PartitionPtr NewPartition;				// Pointer to the new partition pack
 		for(;;)
 		{
-			// Read the partition pack to establish offsets and BodySID
-			NewPartition = File->ReadPartition();
+			// When following a growing file wait until the partition pack, header metadata and index are complete
+			if(Follow && !IsKLVAvailable(CurrentPos)) return false;
+
+			// Read the partition pack to establish offsets and BodySID, unless it was read while checking that it is complete
+			if(Follow && FollowPack && (FollowPack->GetLocation() == CurrentPos)) NewPartition = FollowPack;
+			else NewPartition = File->ReadPartitionAt(CurrentPos);
+			FollowPack = NULL;
 			if(!NewPartition) return false;
 
+			// Record the partition and any index table segments if following a growing file
+			if(Follow) FollowPartition(NewPartition);
+
 			CurrentBodySID = NewPartition->GetUInt(BodySID_UL);
 			if(CurrentBodySID != 0) Reader = GetGCReader(CurrentBodySID);
 		
@@ -1846,8 +2212,9 @@ bool BodyReader::ReadFromFile(bool SingleKLV /*=false*/)
 			// Skip non-supported essence
 			// We first index the start of the essence data, then the loop causes a re-sync
 			// TODO: Add faster skipping of unwanted body partitions if we have enough RIP data...
-			NewPartition->SeekEssence();
-			CurrentPos = File->Tell();
+			Position EssencePos = NewPartition->LocateEssence();
+			if(EssencePos < 0) return false;
+			CurrentPos = EssencePos;
 			AtPartition = false;
 
 			// Move to the next partition pack then return to caller for them to inspect this pack if required
@@ -1858,10 +2225,11 @@ bool BodyReader::ReadFromFile(bool SingleKLV /*=false*/)
 		Position StreamOffset = NewPartition->GetUInt64("BodyOffset");
 		
 		// Index the start of the essence data
-		NewPartition->SeekEssence();
+		Position EssencePos = NewPartition->LocateEssence();
+		if(EssencePos < 0) return false;
 
 		// Read and handle data
-		Ret = Reader->ReadFromFile(File->Tell(), StreamOffset, SingleKLV);
+		Ret = Reader->ReadFromFile(EssencePos, StreamOffset, SingleKLV);
 
 		// We have now initialized the reader
 		NewPos = false;
@@ -1882,8 +2250,7 @@ bool BodyReader::ReadFromFile(bool SingleKLV /*=false*/)
 	else
 	{
 		// Also reinitialize next time if we are at the end of this partition
-		File->Seek(CurrentPos);
-		if(File->Eof())
+		if(Eof())
 			return false;
 		if(IsAtPartition()) NewPos = true;
 	}
@@ -1893,46 +2260,44 @@ bool BodyReader::ReadFromFile(bool SingleKLV /*=false*/)
 
 
 //! Resync after possible loss or corruption of body data
-/*! Searches for the next partition pack and moves file pointer to that point
+/*! Searches for the next partition pack and moves the current position to that point
  *  \return false if an error (or EOF found)
  */
 bool BodyReader::ReSync()
 {
 	// Do we actually need to resync?
-	if( IsAtPartition())
-	{
-		File->Seek(CurrentPos);
-		return true;
-	}
+	if( IsAtPartition()) return true;
 
 	// Loop around until we have re-synced
+	// DRAGONS: All reads are positional, so the file pointer is neither used nor moved
 	for(;;)
 	{
-		// Read the next key to see if we are yet in sync
-		File->Seek(CurrentPos);
-		ULPtr ThisUL = File->ReadKey();
+		// Read the next key (and length) to see if we are yet in sync
+		KLInfo KL;
+		File->ReadKL(CurrentPos, KL);
 
 		// Fail if we can't read a key
-		if(!ThisUL) return false;
+		if(KL.KLSize < 16) return false;
+		const UInt8 *Key = KL.Key;
 
 		// Validate the start of the key (to see if it is a standard MXF key)
-		const UInt8 *Key = ThisUL->GetValue();
 		if((Key[0] == 0x06) && (Key[1] == 0x0e) && (Key[2] == 0x2b) && (Key[3] == 0x34))
 		{
 			// It seems to be a key - is it a partition pack key? If so we are bac in sync
 			if(IsPartitionKey(Key))
 			{
-				File->Seek(CurrentPos);
 				AtPartition= true;
 				NewPos = true;							// Force read to be reinitialized
 				return true;
 			}
 
+			// When following a growing file don't skip beyond the last completely written KLV
+			if(Follow && !IsKLVAvailable(CurrentPos)) return false;
+
 			// Skip over this key...
-			Length Len = File->ReadBER();
-			if(Len < 0) return false;
+			if(KL.ValueLength < 0) return false;
 
-			CurrentPos = File->Tell() + Len;
+			CurrentPos = KL.End();
 
 			continue;
 		}
@@ -1945,8 +2310,8 @@ bool BodyReader::ReSync()
 		for(;;)
 		{
 			// Scan 64k at a time
-			const UInt64 BufferLen = 65536;
-			DataChunkPtr Buffer = File->Read(BufferLen);
+			const size_t BufferLen = 65536;
+			DataChunkPtr Buffer = File->ReadAt(CurrentPos, BufferLen);
 			
 			if(Buffer->Size < 16) return false;
 
@@ -1961,7 +2326,6 @@ bool BodyReader::ReSync()
 					if(IsPartitionKey(p))
 					{
 						CurrentPos += i;				// Move pointer to new partition pack
-						File->Seek(CurrentPos);
 						NewPos = true;					// Force read to be reinitialized
 						AtPartition= true;
 		
@@ -1972,7 +2336,6 @@ bool BodyReader::ReSync()
 			}
 
 			CurrentPos += End;
-			File->Seek(CurrentPos);
 		}
 	}
 }
@@ -2021,7 +2384,7 @@ void mxflib::RegisterGCSystemKey(DataChunkPtr &Key)
 
 
 //! Get a GCElementKind structure
-GCElementKind mxflib::GetGCElementKind(const ULPtr TheUL)
+GCElementKind mxflib::GetGCElementKind(const UInt8 *Key)
 {
 	GCElementKind ret;
 
@@ -2031,10 +2394,10 @@ GCElementKind mxflib::GetGCElementKind(const ULPtr TheUL)
 	// Note that we first test the 11th byte as this where "Application = MXF Generic Container Keys"
 	// is set and so is the same for all GC keys and different in the majority of non-CG keys
 	// also, avoid testing the 8th byte (version number)
-	if( ( TheUL->GetValue()[10] == GetGCEssenceKey()[10] )
-	 && ( TheUL->GetValue()[9]  == GetGCEssenceKey()[9]  )
-	 && ( TheUL->GetValue()[8]  == GetGCEssenceKey()[8]  )
-	 && ( memcmp(TheUL->GetValue(), GetGCEssenceKey(), 7 ) == 0) )
+	if( ( Key[10] == GetGCEssenceKey()[10] )
+	 && ( Key[9]  == GetGCEssenceKey()[9]  )
+	 && ( Key[8]  == GetGCEssenceKey()[8]  )
+	 && ( memcmp(Key, GetGCEssenceKey(), 7 ) == 0) )
 	{
 		ret.IsValid = true;
 	}
@@ -2051,10 +2414,10 @@ GCElementKind mxflib::GetGCElementKind(const ULPtr TheUL)
 				if(Size > 8)
 				{
 					// Compare top bytes first as these are the most likely to differ
-					if(memcmp(&TheUL->GetValue()[8], &(*it)->Data[8], Size - 8) == 0)
+					if(memcmp(&Key[8], &(*it)->Data[8], Size - 8) == 0)
 					{
 						// DRAGONS: Don't test the version number byte
-						if(memcmp(TheUL->GetValue(), (*it)->Data, 7) == 0)
+						if(memcmp(Key, (*it)->Data, 7) == 0)
 						{
 							ret.IsValid = true;
 							break;
@@ -2066,7 +2429,7 @@ GCElementKind mxflib::GetGCElementKind(const ULPtr TheUL)
 					// There is no point comparing exactly 8 bytes
 					if(Size == 8) Size = 7;
 
-					if(memcmp(TheUL->GetValue(), (*it)->Data, Size) == 0)
+					if(memcmp(Key, (*it)->Data, Size) == 0)
 					{
 						ret.IsValid = true;
 						break;
@@ -2080,10 +2443,10 @@ GCElementKind mxflib::GetGCElementKind(const ULPtr TheUL)
 
 	if(ret.IsValid)
 	{
-		ret.Item =				(TheUL->GetValue())[12];
-		ret.Count =				(TheUL->GetValue())[13];
-		ret.ElementType =       (TheUL->GetValue())[14];
-		ret.Number =			(TheUL->GetValue())[15];
+		ret.Item =				Key[12];
+		ret.Count =				Key[13];
+		ret.ElementType =       Key[14];
+		ret.Number =			Key[15];
 	}
 
 	return ret;
@@ -2146,90 +2509,272 @@ bool mxflib::IsGCSystemItem(const ULPtr TheUL)
 //! Get the track number of this essence key (if it is a GC Key)
 /*! \return 0 if not a valid GC Key
  */
-UInt32 mxflib::GetGCTrackNumber(const ULPtr TheUL)
+UInt32 mxflib::GetGCTrackNumber(const UInt8 *Key)
 {
-	GCElementKind Info = GetGCElementKind(TheUL);
+	GCElementKind Info = GetGCElementKind(Key);
 
 	if(!Info.IsValid) return 0;
 
-	return    (static_cast<UInt32>(TheUL->GetValue()[12]) << 24) | (static_cast<UInt32>(TheUL->GetValue()[13]) << 16) 
-			| (static_cast<UInt32>(TheUL->GetValue()[14]) << 8)  | static_cast<UInt32>(TheUL->GetValue()[15]);
+	return    (static_cast<UInt32>(Key[12]) << 24) | (static_cast<UInt32>(Key[13]) << 16) 
+			| (static_cast<UInt32>(Key[14]) << 8)  | static_cast<UInt32>(Key[15]);
 }
 
 
 
-//! Build a list of parsers with their descriptors for a given essence file
-ParserDescriptorListPtr EssenceParser::IdentifyEssence(FileHandle InFile)
+//! Construct a probe for a given file, reading the head of the file immediately
+EssenceProbe::EssenceProbe(FileHandle InFile, size_t HeadSize /*=DefaultHeadSize*/)
 {
-	// Ensure the EPList is initialized
-	if(!Inited) Init();
+	File = InFile;
+	TailStart = 0;
+	TailRead = false;
+	FileSize = -1;
+	SizeKnown = false;
+	CurrentPos = 0;
+	AtEOF = false;
 
-	ParserDescriptorListPtr Ret = new ParserDescriptorList;
+	Head.Resize(HeadSize);
 
-	EssenceSubParserFactoryList::iterator it = EPList.begin();
-	while(it != EPList.end())
-	{
-		EssenceSubParserPtr EP = (*it)->NewParser();
-		EssenceStreamDescriptorList DescList = EP->IdentifyEssence(InFile);
-		
-		if(!DescList.empty())
-		{
-			Ret->push_back(ParserDescriptorPair(EP, DescList));
-		}
+	FileSeek(File, 0);
+	size_t Bytes = FileRead(File, Head.Data, HeadSize);
+	if(Bytes == static_cast<size_t>(-1)) Bytes = 0;
+	Head.Resize(Bytes);
 
-		it++;
+	// If the head is shorter than requested we have the whole file
+	if(Bytes < HeadSize)
+	{
+		FileSize = static_cast<Int64>(Bytes);
+		SizeKnown = true;
+		TailRead = true;
 	}
-
-	return Ret;
 }
 
 
-//! Produce a list of available wrapping options
-EssenceParser::WrappingConfigList EssenceParser::ListWrappingOptions(bool AllowMultiples, FileHandle InFile, ParserDescriptorListPtr PDList, Rational ForceEditRate, WrappingOption::WrapType ForceWrap /*=WrappingOption::None*/)
+//! Get the size of the file being probed, or -1 if it cannot be determined
+Int64 EssenceProbe::GetSize(void)
 {
-	WrappingConfigList Ret;
+	if(!SizeKnown)
+	{
+		SizeKnown = true;
+		if(FileSeekEnd(File) == 0) FileSize = static_cast<Int64>(FileTell(File));
+	}
 
-	// No options!
-	if((!PDList) || (PDList->empty())) return Ret;
+	return FileSize;
+}
 
-	// Identify the wrapping options for each descriptor
-	ParserDescriptorList::iterator pdit = PDList->begin();
-	while(pdit != PDList->end())
+
+//! Set the read position
+/*! \return 0 if OK, -1 if the position is beyond the end of the file, in which case the read position is left at the end of the file
+ */
+int EssenceProbe::Seek(Position Pos)
+{
+	// Only check the file size if we are moving outside the head buffer (as the head is either full or the whole file)
+	if(Pos > static_cast<Position>(Head.Size))
 	{
-		EssenceStreamDescriptorList::iterator it = (*pdit).second.begin();
-		while(it != (*pdit).second.end())
+		Int64 Size = GetSize();
+		if((Size >= 0) && (Pos > Size))
 		{
-			// Filter out the multiples, if not allowed
-			if(AllowMultiples || (!(*it)->Descriptor->IsA(MultipleDescriptor_UL)))
-			{
-				WrappingOptionList WO = (*pdit).first->IdentifyWrappingOptions(InFile, *(*it));
-
-				// Extract the valid options from those identified by the parser, and add them to Ret
-				ExtractValidWrappingOptions(Ret, InFile, (*it), WO, ForceEditRate, ForceWrap);
-			}
-
-			it++;
+			CurrentPos = Size;
+			AtEOF = true;
+			return -1;
 		}
-		pdit++;
 	}
 
-	return Ret;
+	CurrentPos = Pos;
+	AtEOF = false;
+	return 0;
 }
 
 
-//! Produce a list of available wrapping options
-EssenceParser::WrappingConfigList EssenceParser::ListWrappingOptions(bool AllowMultiples, FileHandle InFile, Rational ForceEditRate, WrappingOption::WrapType ForceWrap /*=WrappingOption::None*/)
+//! Read the tail of the file into Tail, if not already done
+void EssenceProbe::LoadTail(void)
 {
-	// Build a list of parsers with their descriptors for this essence
-	ParserDescriptorListPtr PDList = EssenceParser::IdentifyEssence(InFile);
+	if(TailRead) return;
+	TailRead = true;
 
-	// Return the list of options for these parsers
-	// DRAGONS: This called function will cope with an empty or NULL PDList
-	return ListWrappingOptions(AllowMultiples, InFile, PDList, ForceEditRate, ForceWrap);
-}
+	Int64 Size = GetSize();
+	if(Size < 0) return;
 
+	// Don't re-read anything that is already in the head buffer
+	TailStart = (Size > static_cast<Int64>(DefaultTailSize)) ? (Size - DefaultTailSize) : 0;
+	if(TailStart < static_cast<Position>(Head.Size)) TailStart = static_cast<Position>(Head.Size);
+	if(TailStart >= Size) return;
 
-//! Take a list of wrapping options and validate them agains a specifier edit rate and wrapping type
+	size_t TailSize = static_cast<size_t>(Size - TailStart);
+	Tail.Resize(TailSize);
+
+	FileSeek(File, TailStart);
+	size_t Bytes = FileRead(File, Tail.Data, TailSize);
+	if(Bytes == static_cast<size_t>(-1)) Bytes = 0;
+	Tail.Resize(Bytes);
+}
+
+
+//! Read bytes from the current position
+size_t EssenceProbe::Read(UInt8 *Dest, size_t Size)
+{
+	size_t Bytes = 0;
+	Position End = CurrentPos + Size;
+
+	if(End <= static_cast<Position>(Head.Size))
+	{
+		// Entirely within the head buffer
+		memcpy(Dest, &Head.Data[CurrentPos], Size);
+		Bytes = Size;
+	}
+	else if(SizeKnown && (FileSize >= 0) && (CurrentPos >= FileSize))
+	{
+		// Already at or beyond the end of the file
+		Bytes = 0;
+	}
+	else
+	{
+		// See if the tail buffer can satisfy this request, loading it if we are close enough to the end
+		Int64 FullSize = GetSize();
+		if((FullSize >= 0) && (CurrentPos + static_cast<Int64>(DefaultTailSize) >= FullSize)) LoadTail();
+
+		if((FullSize >= 0) && (CurrentPos >= FullSize))
+		{
+			// The size has just been found, and we are at or beyond the end of the file
+			Bytes = 0;
+		}
+		else if(Tail.Size && (CurrentPos >= TailStart))
+		{
+			// DRAGONS: The tail may be shorter than expected if the file was truncated while being read
+			Position Offset = CurrentPos - TailStart;
+			if(Offset >= static_cast<Position>(Tail.Size)) Bytes = 0;
+			else if(Offset + static_cast<Position>(Size) > static_cast<Position>(Tail.Size)) Bytes = static_cast<size_t>(Tail.Size - Offset);
+			else Bytes = Size;
+
+			if(Bytes) memcpy(Dest, &Tail.Data[Offset], Bytes);
+		}
+		else
+		{
+			// Outside the buffered regions - read from the file
+			FileSeek(File, CurrentPos);
+			Bytes = FileRead(File, Dest, Size);
+			if(Bytes == static_cast<size_t>(-1)) Bytes = 0;
+		}
+	}
+
+	CurrentPos += Bytes;
+	if(Bytes < Size) AtEOF = true;
+
+	return Bytes;
+}
+
+
+//! Read bytes from the current position into a new DataChunk
+DataChunkPtr EssenceProbe::ReadChunk(size_t Size)
+{
+	DataChunkPtr Ret = new DataChunk;
+	Ret->Resize(Size);
+
+	// Read the data (and shrink chunk to fit)
+	Ret->Resize(Read(Ret->Data, Size));
+
+	return Ret;
+}
+
+
+//! Read an IFF chunk header from the current position
+U32Pair EssenceProbe::ReadIFFHeader(bool BigEndian /*=true*/)
+{
+	U32Pair Ret;
+
+	UInt8 Buffer[8];
+	if(Read(Buffer, 8) < 8)
+	{
+		Ret.first = 0;
+		Ret.second = 0;
+		return Ret;
+	}
+
+	Ret.first = GetU32(Buffer);
+
+	if(BigEndian)
+		Ret.second = GetU32(&Buffer[4]);
+	else
+		Ret.second = GetU32_LE(&Buffer[4]);
+
+	return Ret;
+}
+
+
+//! Build a list of parsers with their descriptors for a given essence file
+/*! The head of the file is read once into an EssenceProbe which is shared by all sub-parsers */
+ParserDescriptorListPtr EssenceParser::IdentifyEssence(FileHandle InFile)
+{
+	// Ensure the EPList is initialized
+	if(!Inited) Init();
+
+	ParserDescriptorListPtr Ret = new ParserDescriptorList;
+
+	EssenceProbePtr Probe = new EssenceProbe(InFile);
+
+	EssenceSubParserFactoryList::iterator it = EPList.begin();
+	while(it != EPList.end())
+	{
+		EssenceSubParserPtr EP = (*it)->NewParser();
+		EssenceStreamDescriptorList DescList = EP->IdentifyEssence(Probe);
+		
+		if(!DescList.empty())
+		{
+			Ret->push_back(ParserDescriptorPair(EP, DescList));
+		}
+
+		it++;
+	}
+
+	return Ret;
+}
+
+
+//! Produce a list of available wrapping options
+EssenceParser::WrappingConfigList EssenceParser::ListWrappingOptions(bool AllowMultiples, FileHandle InFile, ParserDescriptorListPtr PDList, Rational ForceEditRate, WrappingOption::WrapType ForceWrap /*=WrappingOption::None*/)
+{
+	WrappingConfigList Ret;
+
+	// No options!
+	if((!PDList) || (PDList->empty())) return Ret;
+
+	// Identify the wrapping options for each descriptor
+	ParserDescriptorList::iterator pdit = PDList->begin();
+	while(pdit != PDList->end())
+	{
+		EssenceStreamDescriptorList::iterator it = (*pdit).second.begin();
+		while(it != (*pdit).second.end())
+		{
+			// Filter out the multiples, if not allowed
+			if(AllowMultiples || (!(*it)->Descriptor->IsA(MultipleDescriptor_UL)))
+			{
+				WrappingOptionList WO = (*pdit).first->IdentifyWrappingOptions(InFile, *(*it));
+
+				// Extract the valid options from those identified by the parser, and add them to Ret
+				ExtractValidWrappingOptions(Ret, InFile, (*it), WO, ForceEditRate, ForceWrap);
+			}
+
+			it++;
+		}
+		pdit++;
+	}
+
+	return Ret;
+}
+
+
+//! Produce a list of available wrapping options
+EssenceParser::WrappingConfigList EssenceParser::ListWrappingOptions(bool AllowMultiples, FileHandle InFile, Rational ForceEditRate, WrappingOption::WrapType ForceWrap /*=WrappingOption::None*/)
+{
+	// Build a list of parsers with their descriptors for this essence
+	ParserDescriptorListPtr PDList = EssenceParser::IdentifyEssence(InFile);
+
+	// Return the list of options for these parsers
+	// DRAGONS: This called function will cope with an empty or NULL PDList
+	return ListWrappingOptions(AllowMultiples, InFile, PDList, ForceEditRate, ForceWrap);
+}
+
+
+//! Take a list of wrapping options and validate them agains a specifier edit rate and wrapping type
 /*! All valid options are built into a WrappingConfig object and added to a specified WrappingConfigList,
  *  which may already contain other items.
  */
@@ -4608,17 +5153,8 @@ bool ListOfFiles::GetNextFile(void)
 		ParseFileName(NextName);
 	}
 
-	// Allocate a buffer to build the file name
-	char *NameBuffer = new char[1024];
-
-	// Build the first file name
-	sprintf(NameBuffer, BaseFileName.c_str(), FileNumber);
-
-	// Get the current name as a srting
-	CurrentFileName = std::string(NameBuffer);
-
-	// Free the name buffer
-	delete[] NameBuffer;
+	// Build the file name
+	CurrentFileName = BuildFileName(FileNumber);
 
 	// Get the next file number
 	FileNumber += ListIncrement;
@@ -4629,6 +5165,9 @@ bool ListOfFiles::GetNextFile(void)
 	// Inform our handler (who may change or even invalidate the file name)
 	if(Handler) Handler->NewFile(CurrentFileName);
 
+	// Start opening the following files while we open this one
+	if((LookAhead > 0) && FileList) StartLookAhead();
+
 	// Validate the file open 
 	if(!OpenFile())
 	{
@@ -4640,6 +5179,213 @@ bool ListOfFiles::GetNextFile(void)
 }
 
 
+//! Build the name of a file in the list from the current filename pattern
+std::string ListOfFiles::BuildFileName(int Number)
+{
+	// Allocate a buffer to build the file name
+	char *NameBuffer = new char[1024];
+
+	// Build the file name
+	sprintf(NameBuffer, BaseFileName.c_str(), Number);
+
+	// Get the name as a srting
+	std::string Ret = std::string(NameBuffer);
+
+	// Free the name buffer
+	delete[] NameBuffer;
+
+	return Ret;
+}
+
+
+namespace
+{
+	//! Number of file open-ahead threads started and not yet joined, across all ListOfFiles
+	int LookAheadThreads = 0;
+
+	//! Mutex protecting LookAheadThreads
+	Mutex LookAheadMutex;
+
+	//! Reserve one of the ListOfFiles::MaxLookAheadThreads open-ahead threads
+	/*! \return true if reserved, false if they are all in use */
+	bool ReserveLookAheadThread(void)
+	{
+		LookAheadMutex.Lock();
+		bool Ret = (LookAheadThreads < ListOfFiles::MaxLookAheadThreads);
+		if(Ret) LookAheadThreads++;
+		LookAheadMutex.Unlock();
+
+		return Ret;
+	}
+
+	//! Release an open-ahead thread reserved by ReserveLookAheadThread()
+	void ReleaseLookAheadThread(void)
+	{
+		LookAheadMutex.Lock();
+		LookAheadThreads--;
+		LookAheadMutex.Unlock();
+	}
+}
+
+
+//! A file being opened ahead of time by a background thread
+struct ListOfFiles::LookAheadFile
+{
+	size_t PreRead;						//!< The number of bytes to read from the start of the file once open
+	std::string Name;					//!< The name of the file being opened
+	FileHandle File;					//!< The handle once opened
+	Thread Opener;						//!< The thread opening this file
+
+	//! Thread entry point for opening a file ahead of time
+	static void Entry(void *Param) { static_cast<LookAheadFile*>(Param)->Open(); }
+
+	//! Open the file, running on the background thread
+	void Open(void);
+};
+
+
+//! Start opening the files following the current file, and drop any that are no longer required
+void ListOfFiles::StartLookAhead(void)
+{
+	// Build the names of the files that will follow the current one in this pattern
+	std::list<std::string> Names;
+	int Number = FileNumber;
+	int i;
+	for(i=0; i<LookAhead; i++)
+	{
+		if((FilesRemaining >= 0) && (i >= FilesRemaining)) break;
+
+		Names.push_back(BuildFileName(Number));
+		Number += ListIncrement;
+	}
+
+	// Drop any files that are neither the current file nor one of the following files
+	LookAheadFileList::iterator it = LookAheadFiles.begin();
+	while(it != LookAheadFiles.end())
+	{
+		if(((*it)->Name != CurrentFileName) && (std::find(Names.begin(), Names.end(), (*it)->Name) == Names.end()))
+		{
+			JoinLookAheadFile(*it);
+			if(FileValid((*it)->File)) FileClose((*it)->File);
+			delete (*it);
+			it = LookAheadFiles.erase(it);
+		}
+		else
+			it++;
+	}
+
+	// Start opening any following files not already being opened
+	std::list<std::string>::iterator Name_it = Names.begin();
+	while(Name_it != Names.end())
+	{
+		bool Found = false;
+		it = LookAheadFiles.begin();
+		while(it != LookAheadFiles.end())
+		{
+			if((*it)->Name == *Name_it) { Found = true; break; }
+			it++;
+		}
+
+		if(!Found)
+		{
+			// Stop if there are already as many files being opened ahead as we allow
+			if(!ReserveLookAheadThread()) break;
+
+			LookAheadFile *Item = new LookAheadFile;
+			Item->Name = *Name_it;
+			Item->PreRead = LookAheadPreRead;
+
+			// If we can't start a thread the file will simply be opened when required
+			if(Item->Opener.Start(LookAheadFile::Entry, Item)) LookAheadFiles.push_back(Item);
+			else
+			{
+				ReleaseLookAheadThread();
+				delete Item;
+			}
+		}
+
+		Name_it++;
+	}
+}
+
+
+//! Open the file, running on the background thread
+void ListOfFiles::LookAheadFile::Open(void)
+{
+	FileHandle NewFile = FileOpenRead(Name.c_str());
+	if(FileValid(NewFile))
+	{
+		// Read the size, and the start of the file, to pull the metadata and first data into any cache
+		FileSize(NewFile);
+
+		if(PreRead)
+		{
+			UInt8 *Buffer = new UInt8[PreRead];
+			FileRead(NewFile, Buffer, PreRead);
+			delete[] Buffer;
+
+			FileSeek(NewFile, 0);
+		}
+	}
+
+	// DRAGONS: The owner will not read this until the thread has been joined
+	File = NewFile;
+}
+
+
+//! Wait for the background open of a file to complete
+void ListOfFiles::JoinLookAheadFile(LookAheadFile *Item)
+{
+	Item->Opener.Join();
+
+	ReleaseLookAheadThread();
+}
+
+
+//! Take a file already opened ahead of time, if there is one for this name
+/*! If the file is still being opened this will wait for the open to complete.
+ *  \return true if File has been set to the handle of the file, false if the file has not been opened ahead (or failed to open)
+ */
+bool ListOfFiles::TakeLookAheadFile(std::string Name, FileHandle &File)
+{
+	LookAheadFileList::iterator it = LookAheadFiles.begin();
+	while(it != LookAheadFiles.end())
+	{
+		if((*it)->Name == Name)
+		{
+			JoinLookAheadFile(*it);
+			FileHandle Ret = (*it)->File;
+			delete (*it);
+			LookAheadFiles.erase(it);
+
+			if(!FileValid(Ret)) return false;
+
+			File = Ret;
+			return true;
+		}
+		it++;
+	}
+
+	return false;
+}
+
+
+//! Wait for all files being opened ahead of time and close them
+void ListOfFiles::ClearLookAhead(void)
+{
+	LookAheadFileList::iterator it = LookAheadFiles.begin();
+	while(it != LookAheadFiles.end())
+	{
+		JoinLookAheadFile(*it);
+		if(FileValid((*it)->File)) FileClose((*it)->File);
+		delete (*it);
+		it++;
+	}
+
+	LookAheadFiles.clear();
+}
+
+
 
 //! Set the sequential source to use the EssenceSource from the currently open and identified source file
 /*! \return true if all OK, false if no EssenceSource available
@@ -4797,6 +5543,39 @@ DataChunkPtr FileParser::SequentialEssenceSource::GetEssenceData(size_t Size /*=
 }
 
 
+//! Seek so that the next data read is the nearest edit point at or before the given edit unit
+/*! Files before the one holding the requested edit unit are stepped over without reading their essence,
+ *  provided that their sources report their duration with GetEssenceDuration().
+ *  \note It is not possible to seek back into a file earlier than the current one
+ */
+bool FileParser::SequentialEssenceSource::SeekToEditUnit(Position EditUnit)
+{
+	if(!ValidSource()) return false;
+
+	// We can't move back into an earlier file
+	if(EditUnit < static_cast<Position>(PreviousLength)) return false;
+
+	for(;;)
+	{
+		Position Target = EditUnit - static_cast<Position>(PreviousLength);
+
+		// If the requested edit unit is in a later file, step over this one without reading it
+		Length Duration = CurrentSource->GetEssenceDuration();
+		if((Duration >= 0) && (Target >= Duration))
+		{
+			if(!Outer->GetNextSource()) return false;
+
+			PreviousLength += Duration;
+			continue;
+		}
+
+		if(!CurrentSource->CanSeek()) return false;
+
+		return CurrentSource->SeekToEditUnit(Target);
+	}
+}
+
+
 //! Return the sequential EssenceSource for the main stream (already aquired internally, so no need to use the stream ID)
 EssenceSourcePtr FileParser::GetEssenceSource(UInt32 Stream) 
 {
@@ -5058,8 +5837,12 @@ void RangedEssenceSource::LocateStart(void)
 	// Calculate the end point if a duration has been requested
 	if(RequestedDuration >= 0) RequestedEnd = RequestedStart + RequestedDuration - 1;
 
-	// Start pre-charging from 0
-	PreChargeStart = 0;
+	// If the source supports it, jump straight to the edit point at or before the requested start
+	if((RequestedStart > 0) && Base->CanSeek()) Base->SeekToEditUnit(RequestedStart);
+
+	// Start pre-charging from wherever the source now is
+	// DRAGONS: A failed seek may still have moved the source on, for example by stepping over whole files in a sequence
+	PreChargeStart = Base->GetCurrentPosition();
 
 	// Skip forwards until we reach the requested start
 	Position Pos;
@@ -5069,6 +5852,15 @@ void RangedEssenceSource::LocateStart(void)
 		Base->GetEssenceDataSize();
 		DataChunkPtr ThisData = Base->GetEssenceData();
 
+		// Stop if the source ends before the requested start, there is nothing to return
+		if(!ThisData)
+		{
+			PreCharge.clear();
+			PreChargeStart = RequestedStart;
+			Ended = true;
+			break;
+		}
+
 		// If we have found an edit point, clear the pre-charge buffer
 		if(Base->IsEditPoint())
 		{
@@ -5173,6 +5965,307 @@ void RangedEssenceSubSource::LocateStart(void)
 	Started = true;
 }
 
+//! The worker thread of a PrefetchEssenceSource and its mutexes and condition
+struct PrefetchEssenceSource::ThreadState
+{
+	Thread WorkerThread;								//!< The worker thread
+	Mutex QueueMutex;									//!< Mutex protecting the queue and worker flags
+	Mutex BaseMutex;									//!< Mutex serializing all access to the base source
+	CondVar QueueChanged;								//!< Signalled whenever an entry is added or removed, or a stop requested
+
+	//! Thread entry point
+	static void Entry(void *Param) { static_cast<PrefetchEssenceSource*>(Param)->Worker(); }
+};
+
+
+//! Construct a prefetching source
+/*! \param Base The source to read ahead from
+ *  \param Depth The number of chunks to read ahead (edit units when frame wrapping)
+ *  \param MaxSize The MaxSize to use when reading from the base until the consumer requests a specific limit, 0 to let the base decide
+ */
+PrefetchEssenceSource::PrefetchEssenceSource(EssenceSourcePtr Base, int Depth /*=8*/, size_t MaxSize /*=0*/)
+	: EssenceSource(), Base(Base), QueueHead(0), QueueCount(0), QueueOffset(0), ReadMaxSize(MaxSize),
+	  Started(false), Threaded(false), StopRequested(false), WorkerDone(false),
+	  LastEndOfItem(true), LastEditPoint(true), LastPosition(0)
+{
+	// We always need room for at least one entry
+	if(Depth < 1) Depth = 1;
+	Queue.resize(Depth);
+
+	Sync = new ThreadState;
+}
+
+
+//! Stop the worker thread and clean up
+PrefetchEssenceSource::~PrefetchEssenceSource()
+{
+	if(Threaded)
+	{
+		LockQueue();
+		StopRequested = true;
+		SignalQueue();
+		UnlockQueue();
+
+		Sync->WorkerThread.Join();
+	}
+
+	delete Sync;
+}
+
+
+//! Start reading, running the worker thread if this is possible
+void PrefetchEssenceSource::Start(void)
+{
+	if(Started) return;
+	Started = true;
+
+	// DRAGONS: Sources that index feed the index manager from inside GetEssenceData(), and the index manager
+	//          is also updated by the writer, so we can't safely read these sources on another thread
+	if(Base->CanIndex() && Base->GetIndexManager()) return;
+
+	// Take the consumer's view of the base before any read-ahead
+	LastEndOfItem = Base->EndOfItem();
+	LastEditPoint = Base->IsEditPoint();
+	LastPosition = Base->GetCurrentPosition();
+
+	Threaded = Sync->WorkerThread.Start(ThreadState::Entry, this);
+
+	if(!Threaded) warning("Unable to start read-ahead thread for %s - reading directly\n", Base->Name().c_str());
+}
+
+
+//! The body of the worker thread
+void PrefetchEssenceSource::Worker(void)
+{
+	for(;;)
+	{
+		// Wait for space in the queue
+		LockQueue();
+		while((QueueCount == Queue.size()) && !StopRequested) WaitQueue();
+		size_t MaxSize = ReadMaxSize;
+		bool Stop = StopRequested;
+		UnlockQueue();
+
+		if(Stop) break;
+
+		// Read the next chunk, and the state that goes with it, without holding up the consumer
+		PrefetchEntry Entry;
+		LockBase();
+		Entry.DataSize = Base->GetEssenceDataSize();
+		Entry.SizeEditPoint = Base->IsEditPoint();
+		Entry.SizePosition = Base->GetCurrentPosition();
+		Entry.Data = Base->GetEssenceData(0, MaxSize);
+		Entry.EndOfItem = Base->EndOfItem();
+		Entry.EditPoint = Base->IsEditPoint();
+		Entry.CurrentPosition = Base->GetCurrentPosition();
+		UnlockBase();
+
+		// Add it to the queue
+		LockQueue();
+		size_t Tail = (QueueHead + QueueCount) % Queue.size();
+		Queue[Tail] = Entry;
+		QueueCount++;
+		if(!Entry.Data) WorkerDone = true;
+		SignalQueue();
+		UnlockQueue();
+
+		// Nothing more to read after the end of the data
+		if(!Entry.Data) return;
+	}
+
+	// We have been stopped early
+	LockQueue();
+	WorkerDone = true;
+	SignalQueue();
+	UnlockQueue();
+}
+
+
+//! Wait until there is an entry at the head of the queue
+/*! DRAGONS: Must be called with the queue mutex held */
+void PrefetchEssenceSource::WaitForEntry(void)
+{
+	while((QueueCount == 0) && !WorkerDone) WaitQueue();
+}
+
+
+//! Get the size of the essence data in bytes
+/*! \note There is intentionally no support for an "unknown" response */
+size_t PrefetchEssenceSource::GetEssenceDataSize(void)
+{
+	if(!Started) Start();
+
+	if(!Threaded)
+	{
+		BaseAccess Access(this);
+		return Base->GetEssenceDataSize();
+	}
+
+	LockQueue();
+	WaitForEntry();
+
+	size_t Ret = 0;
+	if(QueueCount)
+	{
+		PrefetchEntry &Entry = Queue[QueueHead];
+
+		// Reduce the size by whatever has already been returned of a split chunk
+		if(Entry.DataSize > QueueOffset) Ret = Entry.DataSize - QueueOffset;
+
+		// Some sources update their state when asked for the size, so mirror that for the consumer
+		if(Entry.Data && (QueueOffset == 0))
+		{
+			LastEditPoint = Entry.SizeEditPoint;
+			LastPosition = Entry.SizePosition;
+		}
+	}
+
+	UnlockQueue();
+
+	return Ret;
+}
+
+
+//! Get the next "installment" of essence data
+DataChunkPtr PrefetchEssenceSource::GetEssenceData(size_t Size /*=0*/, size_t MaxSize /*=0*/)
+{
+	if(!Started)
+	{
+		// Start reading with the consumer's limit if one is given
+		if(MaxSize) ReadMaxSize = MaxSize;
+		Start();
+	}
+
+	if(!Threaded)
+	{
+		BaseAccess Access(this);
+		return Base->GetEssenceData(Size, MaxSize);
+	}
+
+	// Work out the largest chunk we may return
+	size_t Limit = MaxSize;
+	if(Size && ((Limit == 0) || (Size < Limit))) Limit = Size;
+
+	LockQueue();
+
+	// Use this limit for future reads
+	if(MaxSize) ReadMaxSize = MaxSize;
+
+	WaitForEntry();
+
+	// The worker stopped without reaching the end - nothing more to return
+	if(QueueCount == 0)
+	{
+		UnlockQueue();
+		return NULL;
+	}
+
+	PrefetchEntry &Entry = Queue[QueueHead];
+
+	// At the end of the data we leave the end entry in place so that all subsequent reads also return NULL
+	if(!Entry.Data)
+	{
+		UnlockQueue();
+		return NULL;
+	}
+
+	DataChunkPtr Ret;
+	size_t Remaining = Entry.Data->Size - QueueOffset;
+
+	// Only the first part of a split chunk can be the start of an edit point
+	LastEditPoint = (QueueOffset == 0) ? Entry.EditPoint : false;
+
+	if(Limit && (Remaining > Limit))
+	{
+		// Return only part of this chunk - the rest will follow as part of the same wrapping unit
+		Ret = new DataChunk(Limit, &Entry.Data->Data[QueueOffset]);
+		QueueOffset += Limit;
+		LastEndOfItem = false;
+
+		UnlockQueue();
+		return Ret;
+	}
+
+	if(QueueOffset == 0) Ret = Entry.Data;
+	else Ret = new DataChunk(Remaining, &Entry.Data->Data[QueueOffset]);
+
+	LastEndOfItem = Entry.EndOfItem;
+	LastPosition = Entry.CurrentPosition;
+
+	// Remove this entry from the queue and let the worker know there is space
+	Entry.Data = NULL;
+	QueueHead = (QueueHead + 1) % Queue.size();
+	QueueCount--;
+	QueueOffset = 0;
+	SignalQueue();
+
+	UnlockQueue();
+
+	return Ret;
+}
+
+
+//! Is all data exhasted?
+bool PrefetchEssenceSource::EndOfData(void)
+{
+	if(!Threaded)
+	{
+		BaseAccess Access(this);
+		return Base->EndOfData();
+	}
+
+	LockQueue();
+	WaitForEntry();
+	bool Ret = (QueueCount == 0) || (!Queue[QueueHead].Data);
+	UnlockQueue();
+
+	return Ret;
+}
+
+
+//! Lock the base mutex
+void PrefetchEssenceSource::LockBase(void)
+{
+	Sync->BaseMutex.Lock();
+}
+
+
+//! Unlock the base mutex
+void PrefetchEssenceSource::UnlockBase(void)
+{
+	Sync->BaseMutex.Unlock();
+}
+
+
+//! Lock the queue mutex
+void PrefetchEssenceSource::LockQueue(void)
+{
+	Sync->QueueMutex.Lock();
+}
+
+
+//! Unlock the queue mutex
+void PrefetchEssenceSource::UnlockQueue(void)
+{
+	Sync->QueueMutex.Unlock();
+}
+
+
+//! Wait for the queue to change
+/*! DRAGONS: Must be called with the queue mutex held */
+void PrefetchEssenceSource::WaitQueue(void)
+{
+	Sync->QueueChanged.Wait(Sync->QueueMutex);
+}
+
+
+//! Signal that the queue has changed
+void PrefetchEssenceSource::SignalQueue(void)
+{
+	Sync->QueueChanged.Broadcast();
+}
+
+
 
 //! Initialize an index manager if required
 void BodyStream::InitIndexManager(void)
@@ -32,6 +32,7 @@
 
 #include <map>
 #include <list>
+#include <vector>
 
 
 // Forward refs
@@ -406,6 +407,23 @@ namespace mxflib
 		 */
 		virtual bool EnableVBRIndexMode(void) { return false; }
 
+		//! Can this source seek directly to a given edit unit with SeekToEditUnit()?
+		virtual bool CanSeek(void) { return false; }
+
+		//! Seek so that the next data read is the nearest edit point at or before the given edit unit
+		/*! This allows a ranged read to start without reading all the preceding essence.
+		 *  If the seek succeeds GetCurrentPosition() will return the edit unit that will be read next,
+		 *  which may be earlier than requested if the essence requires pre-charge from the previous edit point.
+		 *  \return true if the seek succeeded, false if not supported or the position is not available
+		 */
+		virtual bool SeekToEditUnit(Position EditUnit) { return false; }
+
+		//! Get the number of edit units in this source, if this is known without reading the essence
+		/*! This allows a seek to step over whole source files in a sequence.
+		 *  \return The duration in GetEditRate() sized edit units, or -1 if not known
+		 */
+		virtual Length GetEssenceDuration(void) { return -1; }
+
 		//! Set a length-to-send value
 		void SetLenToSend( Length newVal ) { LenToSend=newVal; }
 
@@ -820,6 +838,110 @@ namespace mxflib
 	};
 
 
+	//! Shared read-once view of the start (and end) of an essence file used during essence identification
+	/*! EssenceParser::IdentifyEssence() builds one of these per file and hands it to every sub-parser, so the head
+	 *  of the file is read once rather than once per registered parser (and again by each descriptor builder).
+	 *  The tail of the file is only read if a parser asks for data near the end.
+	 *  The probe keeps its own read position and mimics the FileSeek() / FileRead() family of functions; any read
+	 *  that falls outside the buffered regions is passed through to the file itself.
+	 *  \note The file position of the underlying file is undefined after using the probe
+	 */
+	class EssenceProbe : public RefCount<EssenceProbe>
+	{
+	public:
+		//! Number of bytes read from the start of the file by default
+		static const size_t DefaultHeadSize = 64 * 1024;
+
+		//! Number of bytes read from the end of the file (when first required)
+		static const size_t DefaultTailSize = 64 * 1024;
+
+	protected:
+		FileHandle File;						//!< The file being probed
+		DataChunk Head;							//!< Buffered bytes from the start of the file
+		DataChunk Tail;							//!< Buffered bytes from the end of the file, empty until first required
+		Position TailStart;						//!< File position of the first byte in Tail
+		bool TailRead;							//!< Set once an attempt has been made to read the tail
+		Int64 FileSize;							//!< Total size of the file, -1 if unknown or not yet determined
+		bool SizeKnown;							//!< Set once an attempt has been made to determine the file size
+		Position CurrentPos;					//!< Current read position within the file
+		bool AtEOF;								//!< Set when the last read was stopped by the end of the file
+
+	public:
+		//! Construct a probe for a given file, reading the head of the file immediately
+		EssenceProbe(FileHandle InFile, size_t HeadSize = DefaultHeadSize);
+
+		//! Get the handle of the file being probed
+		FileHandle GetFile(void) { return File; }
+
+		//! Get the size of the file being probed, or -1 if it cannot be determined (for example if the source is not seekable)
+		Int64 GetSize(void);
+
+		//! Get a pointer to the buffered start of the file
+		/*! \return The number of bytes available at *pData, which may be less than requested if the file is short
+		 */
+		size_t GetHead(const UInt8 **pData) { *pData = Head.Data; return Head.Size; }
+
+		//! Set the read position (equivalent to FileSeek)
+		/*! \return 0 if OK, -1 if the position is beyond the end of the file, in which case the read position is left at the end of the file
+		 */
+		int Seek(Position Pos);
+
+		//! Set the read position to the end of the file (equivalent to FileSeekEnd)
+		/*! \return 0 if OK, -1 if the size of the file is not known */
+		int SeekEnd(void)
+		{
+			Int64 Size = GetSize();
+			if(Size < 0) return -1;
+			CurrentPos = Size;
+			return 0;
+		}
+
+		//! Get the current read position (equivalent to FileTell)
+		Position Tell(void) { return CurrentPos; }
+
+		//! Has the end of file been reached (equivalent to FileEof)
+		/*! \note This is also true after an attempt to seek beyond the end of the file */
+		bool Eof(void) { return AtEOF; }
+
+		//! Read bytes from the current position (equivalent to FileRead)
+		size_t Read(UInt8 *Dest, size_t Size);
+
+		//! Read bytes from the current position into a new DataChunk (equivalent to FileReadChunk)
+		DataChunkPtr ReadChunk(size_t Size);
+
+		//! Read a UInt8 from the current position (equivalent to ReadU8), or 0 if not possible
+		UInt8 ReadU8(void) { UInt8 Buffer[1]; if(Read(Buffer, 1) == 1) return GetU8(Buffer); else return 0; }
+
+		//! Read a big-endian UInt16 from the current position (equivalent to ReadU16), or 0 if not possible
+		UInt16 ReadU16(void) { UInt8 Buffer[2]; if(Read(Buffer, 2) == 2) return GetU16(Buffer); else return 0; }
+
+		//! Read a big-endian UInt32 from the current position (equivalent to ReadU32), or 0 if not possible
+		UInt32 ReadU32(void) { UInt8 Buffer[4]; if(Read(Buffer, 4) == 4) return GetU32(Buffer); else return 0; }
+
+		//! Read a little-endian UInt32 from the current position (equivalent to ReadU32_LE), or 0 if not possible
+		UInt32 ReadU32_LE(void) { UInt8 Buffer[4]; if(Read(Buffer, 4) == 4) return GetU32_LE(Buffer); else return 0; }
+
+		//! Read a big-endian UInt64 from the current position (equivalent to ReadU64), or 0 if not possible
+		UInt64 ReadU64(void) { UInt8 Buffer[8]; if(Read(Buffer, 8) == 8) return GetU64(Buffer); else return 0; }
+
+		//! Read a big-endian Int64 from the current position (equivalent to ReadI64), or 0 if not possible
+		Int64 ReadI64(void) { return (Int64)ReadU64(); }
+
+		//! Read an IFF chunk header from the current position (equivalent to ReadIFFHeader)
+		U32Pair ReadIFFHeader(bool BigEndian = true);
+
+		//! Read a RIFF chunk header from the current position (equivalent to ReadRIFFHeader)
+		U32Pair ReadRIFFHeader(void) { return ReadIFFHeader(false); }
+
+	protected:
+		//! Read the tail of the file into Tail, if not already done
+		void LoadTail(void);
+	};
+
+	//! Smart pointer to an EssenceProbe
+	typedef SmartPtr<EssenceProbe> EssenceProbePtr;
+
+
 	//! Base class for any EssenceSubParserFactory classes
 	class EssenceSubParserFactory : public RefCount<EssenceSubParserFactory>
 	{
@@ -849,7 +971,13 @@ namespace mxflib
 		//! The essence descriptor describing this essence (if known) else NULL
 		MDObjectPtr EssenceDescriptor;
 
+		//! Set while the default probe version of IdentifyEssence() is calling the FileHandle version
+		/*! DRAGONS: Stops the two default versions calling each other forever if a sub-parser overrides neither */
+		bool InProbeFallback;
+
 	public:
+		//! Base constructor
+		EssenceSubParser() : InProbeFallback(false) {};
 
 		//! Base class for essence parser EssenceSource objects
 		/*! Still abstract as there is no generic way to determine the data size */
@@ -1023,6 +1151,24 @@ namespace mxflib
 					return " Parser";
 			}
 
+			//! Can this source seek directly to a given edit unit with SeekToEditUnit()?
+			virtual bool CanSeek(void) { return Caller->CanSeek(); }
+
+			//! Seek so that the next data read is the nearest edit point at or before the given edit unit
+			virtual bool SeekToEditUnit(Position EditUnit)
+			{
+				if(!Caller->SeekToEditUnit(File, EditUnit)) return false;
+
+				// Discard any part-read data from the previous position
+				RemainingData = NULL;
+				AtEndOfData = false;
+
+				return true;
+			}
+
+			//! Get the number of edit units in this source, if this is known without reading the essence
+			virtual Length GetEssenceDuration(void) { return Caller->GetEssenceDuration(File); }
+
 			//! Set the essence descriptor
 			virtual void SetDescriptor(MDObjectPtr Descriptor) { Caller->EssenceDescriptor = Descriptor; }
 
@@ -1045,12 +1191,28 @@ namespace mxflib
 
 		//! Examine the open file and return a list of essence descriptors
 		/*! This function should fail as fast as possible if the essence if not identifyable by this object 
+		 *  Sub-parsers that support probe buffers need not override this as the default builds a probe for the file and calls the probe version.
 		 *	\return A list of EssenceStreamDescriptors where each essence stream identified in the input file has
 		 *			an identifier (to allow it to be referenced later) and an MXF File Descriptor
 		 */
 		virtual EssenceStreamDescriptorList IdentifyEssence(FileHandle InFile)
 		{
-			EssenceStreamDescriptorList Ret;
+			if(InProbeFallback) return EssenceStreamDescriptorList();
+
+			EssenceProbePtr Probe = new EssenceProbe(InFile);
+			return IdentifyEssence(Probe);
+		}
+
+		//! Examine an essence file via a shared probe buffer and return a list of essence descriptors
+		/*! This version is called by EssenceParser::IdentifyEssence() so that all sub-parsers share a single read of the file.
+		 *  Sub-parsers that do not support probe buffers need not override this as the default calls the FileHandle version.
+		 */
+		virtual EssenceStreamDescriptorList IdentifyEssence(EssenceProbePtr &Probe)
+		{
+			InProbeFallback = true;
+			EssenceStreamDescriptorList Ret = IdentifyEssence(Probe->GetFile());
+			InProbeFallback = false;
+
 			return Ret;
 		}
 
@@ -1126,6 +1288,19 @@ namespace mxflib
 		 */
 		virtual Position GetCurrentPosition(void) = 0;
 
+		//! Does this essence parser support SeekToEditUnit()
+		virtual bool CanSeek(void) { return false; }
+
+		//! Seek so that the next read is the nearest edit point at or before the given edit unit
+		/*! \param EditUnit The required edit unit, in SetEditRate() sized edit units
+		 *  \return true if the seek succeeded, in which case GetCurrentPosition() gives the edit unit that will be read next
+		 */
+		virtual bool SeekToEditUnit(FileHandle InFile, Position EditUnit) { return false; }
+
+		//! Get the number of edit units in the essence, if this is known without reading it
+		/*! \return The duration in SetEditRate() sized edit units, or -1 if not known */
+		virtual Length GetEssenceDuration(FileHandle InFile) { return -1; }
+
 		//! Set the IndexManager for this essence stream (and the stream ID if we are not the main stream)
 		virtual void SetIndexManager(IndexManagerPtr &TheManager, int StreamID = 0)
 		{
@@ -1631,9 +1806,25 @@ namespace mxflib
 		Position RangeEnd;						//!< The requested last edit unit, or -1 if using RequestedDuration
 		Length RangeDuration;					//!< The requested duration, or -1 if using RequestedEnd
 
+		//! A file being opened ahead of time by a background thread
+		/*! This holds the platform specific thread handle, so is only defined in essence.cpp */
+		struct LookAheadFile;
+		friend struct LookAheadFile;
+
+		//! List of files being opened ahead of time, in the order they will be required
+		typedef std::list<LookAheadFile *> LookAheadFileList;
+
+		int LookAhead;							//!< The number of files to open ahead of time, 0 to open each file only when required
+		size_t LookAheadPreRead;				//!< The number of bytes to read from the start of each file opened ahead of time to warm any cache
+		LookAheadFileList LookAheadFiles;		//!< The files currently being opened ahead of time
+
 	public:
+		//! The maximum number of files that may be being opened ahead of time at once, across all lists
+		/*! Any further files are opened when they are required */
+		static const int MaxLookAheadThreads = 16;
+
 		//! Construct a ListOfFiles and optionally set a single source filename pattern
-		ListOfFiles(std::string FileName = "") : ExternalEssence(false), RangeStart(-1), RangeEnd(-1), RangeDuration(-1)
+		ListOfFiles(std::string FileName = "") : ExternalEssence(false), RangeStart(-1), RangeEnd(-1), RangeDuration(-1), LookAhead(0), LookAheadPreRead(0)
 		{
 			AtEOF = false;
 
@@ -1650,7 +1841,7 @@ namespace mxflib
 		}
 
 		//! Virtual destructor to allow polymorphism
-		virtual ~ListOfFiles() {}
+		virtual ~ListOfFiles() { ClearLookAhead(); }
 
 		//! Set a single source filename pattern
 		void SetFileName(std::string &FileName) 
@@ -1703,6 +1894,21 @@ namespace mxflib
 		//! Get the current filename
 		std::string FileName(void) { return CurrentFileName; }
 
+		//! Set the number of following files in a numbered list to open on background threads ahead of time
+		/*! Each file is opened, its size read and the first PreRead bytes read (then the file rewound), so that
+		 *  open and metadata latency on slow file systems overlaps with processing of the current file.
+		 *  Files are only opened ahead within the current filename pattern, and a file opened ahead is only used
+		 *  if the new-file handler leaves its name unchanged.
+		 *  \param Count The number of files to open ahead, 0 to disable, limited to MaxLookAheadThreads
+		 *  \param PreRead The number of bytes to read from the start of each file, 0 for none
+		 */
+		void SetLookAhead(int Count, size_t PreRead = 64 * 1024)
+		{
+			LookAhead = (Count > MaxLookAheadThreads) ? MaxLookAheadThreads : Count;
+			LookAheadPreRead = PreRead;
+			if(Count <= 0) ClearLookAhead();
+		}
+
 		//! Open the current file (any new-file handler will already have been called)
 		/*! This function must be supplied by the derived class 
 		 *  \return true if file open succeeded
@@ -1734,6 +1940,24 @@ namespace mxflib
 
 		//! Process an ampersand separated list of sub-file names
 		virtual void ProcessSubNames(std::string SubNames) {};
+
+		//! Build the name of a file in the list from the current filename pattern
+		std::string BuildFileName(int Number);
+
+		//! Start opening the files following the current file, and drop any that are no longer required
+		void StartLookAhead(void);
+
+		//! Take a file already opened ahead of time, if there is one for this name
+		/*! If the file is still being opened this will wait for the open to complete.
+		 *  \return true if File has been set to the handle of the file, false if the file has not been opened ahead (or failed to open)
+		 */
+		bool TakeLookAheadFile(std::string Name, FileHandle &File);
+
+		//! Wait for all files being opened ahead of time and close them
+		void ClearLookAhead(void);
+
+		//! Wait for the background open of a file to complete
+		static void JoinLookAheadFile(LookAheadFile *Item);
 	};
 
 	
@@ -2207,6 +2431,303 @@ namespace mxflib
 		virtual void LocateStart(void);
 	};
 
+	//! Filter-style source that reads ahead from another EssenceSource on a worker thread
+	/*! The worker thread calls GetEssenceDataSize() and GetEssenceData() on the base source up to a
+	 *  configurable number of chunks ahead of the consumer, so that slow essence parsing can overlap with
+	 *  writing. Each chunk is handed over through a bounded single-producer/single-consumer queue along
+	 *  with the base source's EndOfItem(), IsEditPoint() and GetCurrentPosition() values after the read,
+	 *  so the consumer sees exactly what it would have seen reading the base directly.
+	 *  DRAGONS: This source owns its source, so will keep it alive while we exist
+	 *  DRAGONS: The base source must not be read by anything else (including sub-sources slaved to it) once
+	 *           reading has started, as this would race with the worker thread
+	 *  \note If the base source is feeding an index manager at the time of the first read, the worker thread
+	 *        is not started and all reads are made directly, as the index manager is not thread safe
+	 *  \note Any other calls to the base source are serialized with the worker's reads
+	 */
+	class PrefetchEssenceSource : public EssenceSource
+	{
+	protected:
+		EssenceSourcePtr Base;								//!< The source being read ahead
+
+		//! A chunk read by the worker thread, with the state of the base source after it was read
+		struct PrefetchEntry
+		{
+			DataChunkPtr Data;								//!< The data read, or NULL at the end of the data
+			size_t DataSize;								//!< The value of GetEssenceDataSize() before the read
+			bool SizeEditPoint;								//!< The value of IsEditPoint() after GetEssenceDataSize()
+			Position SizePosition;							//!< The value of GetCurrentPosition() after GetEssenceDataSize()
+			bool EndOfItem;									//!< The value of EndOfItem() after the read
+			bool EditPoint;									//!< The value of IsEditPoint() after the read
+			Position CurrentPosition;						//!< The value of GetCurrentPosition() after the read
+		};
+
+		std::vector<PrefetchEntry> Queue;					//!< Ring buffer of chunks read ahead
+		size_t QueueHead;									//!< Index of the next entry to be consumed
+		size_t QueueCount;									//!< Number of entries currently queued
+		size_t QueueOffset;									//!< Bytes of the entry at QueueHead already returned by a partial read
+
+		size_t ReadMaxSize;									//!< MaxSize to use for reads from the base (the last non-zero MaxSize requested)
+
+		bool Started;										//!< Set true once the first read has been requested
+		bool Threaded;										//!< Set true if the worker thread is running (or has run)
+		bool StopRequested;									//!< Set true to ask the worker thread to stop
+		bool WorkerDone;									//!< Set true by the worker once it has queued the end of the data (or stopped)
+
+		bool LastEndOfItem;									//!< EndOfItem() value for the last chunk returned to the consumer
+		bool LastEditPoint;									//!< IsEditPoint() value for the last chunk returned to the consumer
+		Position LastPosition;								//!< GetCurrentPosition() value after the last chunk returned to the consumer
+
+		//! The worker thread and its mutexes and condition
+		/*! These are platform specific, so this is only defined in essence.cpp */
+		struct ThreadState;
+		friend struct ThreadState;
+
+		ThreadState *Sync;									//!< The worker thread and its synchronization objects
+
+		//! Holds the base mutex for the lifetime of this object
+		class BaseAccess
+		{
+		protected:
+			PrefetchEssenceSource *Owner;
+		public:
+			BaseAccess(PrefetchEssenceSource *Owner) : Owner(Owner) { Owner->LockBase(); }
+			~BaseAccess() { Owner->UnlockBase(); }
+		};
+
+		friend class BaseAccess;
+
+	private:
+		//! Prevent a default constructor
+		PrefetchEssenceSource();
+
+		//! Prevent copy construction
+		PrefetchEssenceSource(const PrefetchEssenceSource &);
+
+	public:
+		//! Construct a prefetching source
+		/*! \param Base The source to read ahead from
+		 *  \param Depth The number of chunks to read ahead (edit units when frame wrapping)
+		 *  \param MaxSize The MaxSize to use when reading from the base until the consumer requests a specific limit, 0 to let the base decide
+		 */
+		PrefetchEssenceSource(EssenceSourcePtr Base, int Depth = 8, size_t MaxSize = 0);
+
+		//! Stop the worker thread and clean up
+		virtual ~PrefetchEssenceSource();
+
+		//! Get the size of the essence data in bytes
+		/*! \note There is intentionally no support for an "unknown" response */
+		virtual size_t GetEssenceDataSize(void);
+
+		//! Get the next "installment" of essence data
+		/*! This will attempt to return an entire wrapping unit (e.g. a full frame for frame-wrapping) but will return it in
+		 *  smaller chunks if this would break the MaxSize limit. If a Size is specified then the chunk returned will end at
+		 *  the first wrapping unit end encountered before Size. On no account will portions of two or more different wrapping
+		 *  units be returned together. The mechanism for selecting a type of wrapping (e.g. frame, line or clip) is not 
+		 *  (currently) part of the common EssenceSource interface.
+		 *  \return Pointer to a data chunk holding the next data or a NULL pointer when no more remains
+		 *	\note If there is more data to come but it is not currently available the return value will be a pointer to an empty data chunk
+		 *	\note If Size = 0 the object will decide the size of the chunk to return
+		 *	\note On no account will the returned chunk be larger than MaxSize (if MaxSize > 0)
+		 *  \note Chunks read ahead with a larger MaxSize are split to honour MaxSize
+		 */
+		virtual DataChunkPtr GetEssenceData(size_t Size = 0, size_t MaxSize = 0);
+
+		//! Did the last call to GetEssenceData() return the end of a wrapping item
+		virtual bool EndOfItem(void)
+		{
+			if(!Threaded) { BaseAccess Access(this); return Base->EndOfItem(); }
+			return LastEndOfItem;
+		}
+
+		//! Is all data exhasted?
+		/*! \return true if a call to GetEssenceData() will return some valid essence data
+		 *  \note Once reading has started this may block until the worker has read the next chunk
+		 */
+		virtual bool EndOfData(void);
+
+		//! Get data to write as padding after all real essence data has been processed
+		virtual DataChunk *GetPadding(void) { BaseAccess Access(this); return Base->GetPadding(); }
+
+		//! Get the GCEssenceType to use when wrapping this essence in a Generic Container
+		virtual UInt8 GetGCEssenceType(void) { BaseAccess Access(this); return Base->GetGCEssenceType(); }
+
+		//! Get the GCEssenceType to use when wrapping this essence in a Generic Container
+		virtual UInt8 GetGCElementType(void) { BaseAccess Access(this); return Base->GetGCElementType(); }
+
+		//! Is the last data read the start of an edit point?
+		virtual bool IsEditPoint(void)
+		{
+			if(!Threaded) { BaseAccess Access(this); return Base->IsEditPoint(); }
+			return LastEditPoint;
+		}
+
+		//! Get the edit rate of this wrapping of the essence
+		virtual Rational GetEditRate(void) { BaseAccess Access(this); return Base->GetEditRate(); }
+
+		//! Get the current position in GetEditRate() sized edit units
+		/*! This is the position as seen by the consumer, not how far the worker thread has read ahead */
+		virtual Position GetCurrentPosition(void)
+		{
+			if(!Threaded) { BaseAccess Access(this); return Base->GetCurrentPosition(); }
+			return LastPosition;
+		}
+
+		//! Get the preferred BER length size for essence KLVs written from this source, 0 for auto
+		virtual int GetBERSize(void) { BaseAccess Access(this); return Base->GetBERSize(); }
+
+		//! Set a wrapping option for future Read and Write calls
+		virtual bool Use(WrappingOptionPtr &UseWrapping) { BaseAccess Access(this); return Base->Use(UseWrapping); }
+
+		//! Set a non-native edit rate
+		virtual bool SetEditRate(Rational EditRate) { BaseAccess Access(this); return Base->SetEditRate(EditRate); }
+
+		//! Set a source type or parser specific option
+		/*! \return true if the option was successfully set */
+		virtual bool SetOption(std::string Option, Int64 Param = 0) { BaseAccess Access(this); return Base->SetOption(Option, Param); } ;
+
+		//! Get BytesPerEditUnit if Constant, else 0
+		virtual UInt32 GetBytesPerEditUnit(UInt32 KAGSize = 1) { BaseAccess Access(this); return Base->GetBytesPerEditUnit(KAGSize); }
+
+		//! Can this stream provide indexing
+		virtual bool CanIndex() { BaseAccess Access(this); return Base->CanIndex(); }
+
+		//! Set the index manager to use for building index tables for this essence
+		virtual void SetIndexManager(IndexManagerPtr &Manager, int StreamID) 
+		{ 
+			BaseAccess Access(this);
+			Base->SetIndexManager(Manager, StreamID); 
+		}
+
+		//! Get the index manager
+		virtual IndexManagerPtr &GetIndexManager(void) { BaseAccess Access(this); return Base->GetIndexManager(); }
+
+		//! Get the index manager sub-stream ID
+		virtual int GetIndexStreamID(void) { BaseAccess Access(this); return Base->GetIndexStreamID(); }
+
+		//! Override the default essence key
+		virtual void SetKey(DataChunkPtr &Key, bool NonGC = false)
+		{
+			BaseAccess Access(this);
+			Base->SetKey(Key, NonGC);
+		}
+
+		//! Get the current overridden essence key
+		virtual DataChunkPtr &GetKey(void) { BaseAccess Access(this); return Base->GetKey(); }
+
+		//! Get true if the default essence key has been overriden with  a key that does not use GC track number mechanism
+		virtual bool GetNonGC(void) { BaseAccess Access(this); return Base->GetNonGC(); }
+
+		/* Essence type identification */
+
+		//! Is this picture essence?
+		virtual bool IsPictureEssence(void) { BaseAccess Access(this); return Base->IsPictureEssence(); }
+
+		//! Is this sound essence?
+		virtual bool IsSoundEssence(void) { BaseAccess Access(this); return Base->IsSoundEssence(); }
+
+		//! Is this data essence?
+		virtual bool IsDataEssence(void) { BaseAccess Access(this); return Base->IsDataEssence(); }
+
+		//! Is this compound essence?
+		virtual bool IsCompoundEssence(void) { BaseAccess Access(this); return Base->IsCompoundEssence(); }
+
+		//! An indication of the relative write order to use for this stream
+		virtual Int32 RelativeWriteOrder(void) { BaseAccess Access(this); return Base->RelativeWriteOrder(); }
+
+		//! The type for relative write-order positioning if RelativeWriteOrder() != 0
+		virtual int RelativeWriteOrderType(void) { BaseAccess Access(this); return Base->RelativeWriteOrderType(); }
+
+		//! Get the origin value to use for this essence specifically to take account of pre-charge
+		virtual Length GetPrechargeSize(void) { BaseAccess Access(this); return Base->GetPrechargeSize(); }
+
+		//! Get the range start position
+		virtual Position GetRangeStart(void) { BaseAccess Access(this); return Base->GetRangeStart(); }
+
+		//! Get the range end position
+		virtual Position GetRangeEnd(void) { BaseAccess Access(this); return Base->GetRangeEnd(); }
+
+		//! Get the range duration
+		virtual Length GetRangeDuration(void) { BaseAccess Access(this); return Base->GetRangeDuration(); }
+
+		//! Get the name of this essence source (used for error messeges)
+		virtual std::string Name(void) { BaseAccess Access(this); return "PrefetchEssenceSource based on " + Base->Name(); }
+
+		//! Enable VBR indexing, even in clip-wrap mode, by allowing each edit unit to be returned individually
+		/*! \note This is only possible before reading starts, as chunks may already have been read ahead */
+		virtual bool EnableVBRIndexMode(void)
+		{
+			if(Started) return false;
+			BaseAccess Access(this);
+			return Base->EnableVBRIndexMode();
+		}
+
+		//! Can this source seek directly to a given edit unit with SeekToEditUnit()?
+		/*! \note Seeking is only possible before reading starts */
+		virtual bool CanSeek(void)
+		{
+			if(Started) return false;
+			BaseAccess Access(this);
+			return Base->CanSeek();
+		}
+
+		//! Seek so that the next data read is the nearest edit point at or before the given edit unit
+		virtual bool SeekToEditUnit(Position EditUnit)
+		{
+			if(Started) return false;
+			BaseAccess Access(this);
+			return Base->SeekToEditUnit(EditUnit);
+		}
+
+		//! Get the number of edit units in this source, if this is known without reading the essence
+		virtual Length GetEssenceDuration(void)
+		{
+			BaseAccess Access(this);
+			return Base->GetEssenceDuration();
+		}
+
+		//! Set the essence descriptor
+		virtual void SetDescriptor(MDObjectPtr Descriptor)
+		{
+			EssenceDescriptor = Descriptor;
+			BaseAccess Access(this);
+			Base->SetDescriptor(Descriptor);
+		}
+
+		//! Get a pointer to the essence descriptor for this source (if known) otherwise NULL
+		virtual MDObjectPtr GetDescriptor(void) { BaseAccess Access(this); return Base->GetDescriptor(); }
+
+	protected:
+		//! Start reading, running the worker thread if this is possible
+		void Start(void);
+
+		//! Wait until there is an entry at the head of the queue
+		/*! DRAGONS: Must be called with the queue mutex held */
+		void WaitForEntry(void);
+
+		//! The body of the worker thread
+		void Worker(void);
+
+		//! Lock the base mutex
+		void LockBase(void);
+
+		//! Unlock the base mutex
+		void UnlockBase(void);
+
+		//! Lock the queue mutex
+		void LockQueue(void);
+
+		//! Unlock the queue mutex
+		void UnlockQueue(void);
+
+		//! Wait for the queue to change
+		/*! DRAGONS: Must be called with the queue mutex held */
+		void WaitQueue(void);
+
+		//! Signal that the queue has changed
+		void SignalQueue(void);
+	};
+
+
 
 	//! File parser - parse essence from a sequential set of files
 	class FileParser : public ListOfFiles, public RefCount<FileParser>
@@ -2335,7 +2856,9 @@ namespace mxflib
 		 */
 		bool OpenFile(void)
 		{
-			CurrentFile = FileOpenRead(CurrentFileName.c_str());
+			// The name "-" selects the standard input
+			if(CurrentFileName == "-") CurrentFile = FileOpenStdin();
+			else if(!TakeLookAheadFile(CurrentFileName, CurrentFile)) CurrentFile = FileOpenRead(CurrentFileName.c_str());
 			CurrentFileOpen = FileValid(CurrentFile);
 			return CurrentFileOpen;
 		}
@@ -2573,6 +3096,16 @@ namespace mxflib
 			/*! DRAGONS: This is currently a non-ideal fudge - do not assume this method will last long!!! */
 			virtual void AttachSystem(BodyStream *Stream)  { if(ValidSource()) CurrentSource->AttachSystem(Stream); }
 
+			//! Can this source seek directly to a given edit unit with SeekToEditUnit()?
+			virtual bool CanSeek(void) { if(ValidSource()) return CurrentSource->CanSeek(); else return false; }
+
+			//! Seek so that the next data read is the nearest edit point at or before the given edit unit
+			/*! Files before the one holding the requested edit unit are stepped over without reading their essence,
+			 *  provided that their sources report their duration with GetEssenceDuration().
+			 *  \note It is not possible to seek back into a file earlier than the current one
+			 */
+			virtual bool SeekToEditUnit(Position EditUnit);
+
 		protected:
 			//! Ensure that CurrentSource is valid and ready for reading - if not select the next source file
 			/*! \return true if all OK, false if no EssenceSource available
@@ -2638,6 +3171,22 @@ namespace mxflib
 
 		std::map<UInt32, GCReadHandlerPtr> Handlers;	//!< Map of read handlers indexed by track number
 
+		size_t ReadBlockSize;							//!< Size of each coalesced read, or zero to read each KLV individually
+		MXFFilePtr BlockFile;							//!< Memory file holding the most recent coalesced read (NULL if none)
+		Position BlockStart;							//!< File offset of the first byte held in BlockFile
+		Position BlockEnd;								//!< File offset of the byte following the last byte held in BlockFile
+
+		bool SkipUnhandled;								//!< True if KLVs that no handler would receive are skipped without reading their values
+
+		IndexTablePtr ReadAheadIndex;					//!< Index table used to predict the location of upcoming edit units, or NULL for no read-ahead
+		int ReadAheadEditUnits;							//!< Number of edit units beyond the current position to read ahead
+		Position ReadAheadStart;						//!< Stream offset at which the most recent read-ahead was requested
+		Position ReadAheadNext;							//!< Stream offset at which the next read-ahead should be requested
+		Position ReadAheadEnd;							//!< Stream offset of the end of the most recent read-ahead
+
+		bool Follow;									//!< True if reading stops before any KLV not yet completely written - see SetFollow()
+		Length FollowSize;								//!< Size of the file when last checked in follow mode
+
 	public:
 		//! Create a new GCReader, optionally with a given default item handler and filler handler
 		/*! \note The default handler receives all KLVs without a specific handler (except fillers)
@@ -2687,6 +3236,53 @@ namespace mxflib
 			}
 		}
 
+		//! Set the size of coalesced reads
+		/*! When non-zero the file is read in blocks of this many bytes, aligned to a multiple of the size, and each
+		 *  KLVObject is sliced out of the block without further I/O. Setting a size of a content package or more reduces the reading
+		 *  of a frame-wrapped file to about one read per package. Any KLV with a value that extends beyond
+		 *  the end of a block has its value read from the file itself, and only when requested by the handler.
+		 *  \note The default of zero reads the key, length and value of each KLV separately
+		 *  \note Non-zero sizes smaller than a key and the longest BER length (25 bytes) are increased to that size
+		 */
+		void SetReadBlockSize(size_t Size)
+		{
+			ReadBlockSize = ((Size > 0) && (Size < MaxKLSize)) ? MaxKLSize : Size;
+			BlockFile = NULL;
+		}
+
+		//! Set whether KLVs that no handler would receive are skipped
+		/*! When set only the key and length of each KLV are read until one is found that would be passed to
+		 *  a handler. The rest are stepped over by offset, so no KLVObject is built and no value bytes are read
+		 *  (other than any that fall inside a coalesced read block). This allows one track to be extracted from
+		 *  a multi-track file at the cost of little more than the bytes of that track.
+		 *  \note The decision uses the handlers set when each KLV is reached, so setting a default handler disables skipping
+		 */
+		void SetSkipUnhandled(bool Skip = true) { SkipUnhandled = Skip; }
+
+		//! Enable index-driven read-ahead
+		/*! As the stream is read the index table is used to locate the next EditUnits edit units and the operating
+		 *  system is asked to start reading them in the background (with posix_fadvise() where available). Requests
+		 *  are batched - a new request is made once half of the previous one has been read.
+		 *  \param Index The index table for this stream, or NULL to disable read-ahead
+		 *  \param EditUnits Number of edit units to read ahead
+		 */
+		void SetReadAhead(IndexTablePtr Index, int EditUnits = 25)
+		{
+			ReadAheadIndex = Index;
+			ReadAheadEditUnits = EditUnits;
+			ReadAheadStart = -1;
+			ReadAheadNext = -1;
+			ReadAheadEnd = -1;
+		}
+
+		//! Enable or disable follow mode for files that are still being written
+		/*! In follow mode ReadFromFile() returns false, without moving past it, on reaching a KLV that has not yet been
+		 *  completely written. Once the file has grown a further call continues from the same point
+		 *  \note The file size is only re-checked when a KLV appears to extend beyond the last known size, but the key
+		 *        and length of each KLV are read an extra time unless coalesced reads are used - see SetReadBlockSize()
+		 */
+		void SetFollow(bool Enable = true) { Follow = Enable; FollowSize = -1; }
+
 		//! Read from file - and specify a start location
 		/*! All KLVs are dispatched to handlers
 		 *  Stops reading at the next partition pack unless SingleKLV is true when only one KLV is dispatched
@@ -2755,6 +3351,32 @@ namespace mxflib
 
 		//! Get the offset of the start of the current KLV within this GC stream
 		Position GetStreamOffset(void) { return StreamOffset; };
+
+	protected:
+		//! Read the key and length of the KLV at FileOffset, from the current coalesced read block if used
+		/*! \return NULL if no more valid KLVs
+		 */
+		KLVObjectPtr ReadKLV(void);
+
+		//! Ensure that the KL at FileOffset is wholly within the current coalesced read block, reading a new block if required
+		/*! \return false if no more data could be read
+		 */
+		bool LoadBlock(void);
+
+		//! Advance FileOffset past any KLVs that would not be dispatched to a handler
+		/*! Only the key and length of each skipped KLV are read
+		 *  \return false if no more valid KLVs
+		 */
+		bool SkipToHandled(void);
+
+		//! Determine if a KLV with the given key would be dispatched to a handler by HandleData()
+		bool IsHandled(const UInt8 *Key);
+
+		//! Request read-ahead of the next few edit units if the current position is beyond the previous request
+		void ReadAhead(void);
+
+		//! Determine if the KLV at FileOffset has been completely written (used in follow mode)
+		bool IsKLVAvailable(void);
 	};
 }
 
@@ -2763,6 +3385,10 @@ namespace mxflib
 namespace mxflib
 {
 	//! BodyReader class - reads from an MXF file (reads data is "pulled" from the file)
+	/*! \note All reads are positional and the reader tracks its own position, so the file pointer is neither used nor moved.
+	 *        Callers that mix a BodyReader with MXFFile::Tell(), Seek() or ReadKLV() must position the file themselves,
+	 *        using BodyReader::Tell() or KLVObject::GetLocation() for the current read position
+	 */
 	class BodyReader : public RefCount<BodyReader>
 	{
 	protected:
@@ -2779,9 +3405,17 @@ namespace mxflib
 		GCReadHandlerPtr GCRDefaultHandler;		//!< Default handler to use for new GCReaders
 		GCReadHandlerPtr GCRFillerHandler;		//!< Filler handler to use for new GCReaders
 		GCReadHandlerPtr GCREncryptionHandler;	//!< Encryption handler to use for new GCReaders
+		size_t GCRReadBlockSize;				//!< Coalesced read size to use for new GCReaders
+		bool GCRSkipUnhandled;					//!< True if new GCReaders should skip KLVs that no handler would receive
 
 		std::map<UInt32, GCReaderPtr> Readers;	//!< Map of GCReaders indexed by BodySID
 
+		bool Follow;							//!< True if following a file that is still being written - see SetFollow()
+		Length FollowSize;						//!< Size of the file when last checked in follow mode
+		Position FollowPartitionPos;			//!< Location of the last partition pack recorded in follow mode, or -1 if none
+		PartitionPtr FollowPack;				//!< The partition pack read by IsKLVAvailable(), kept so that it is not read again by each poll or by ReadFromFile()
+		std::map<UInt32, IndexTablePtr> FollowIndexes;	//!< Index tables built in follow mode, indexed by IndexSID
+
 	public:
 		//! Construct a body reader and associate it with an MXF file
 		BodyReader(MXFFilePtr File);
@@ -2819,6 +3453,47 @@ namespace mxflib
 		 */
 		void SetEncryptionHandler(GCReadHandlerPtr EncryptionHandler = NULL) { GCREncryptionHandler = EncryptionHandler; };
 
+		//! Set the coalesced read size for all GCReaders
+		/*! Applies to all existing GCReaders and any created later - see GCReader::SetReadBlockSize()
+		 */
+		void SetReadBlockSize(size_t Size);
+
+		//! Set whether KLVs that no handler would receive are skipped by all GCReaders
+		/*! Applies to all existing GCReaders and any created later - see GCReader::SetSkipUnhandled()
+		 *  \note Skipping is disabled for any GCReader that has a default handler
+		 */
+		void SetSkipUnhandled(bool Skip = true);
+
+		//! Enable index-driven read-ahead for a given BodySID
+		/*! \return false if there is no GCReader for this BodySID - see GCReader::SetReadAhead()
+		 */
+		bool SetReadAhead(UInt32 BodySID, IndexTablePtr Index, int EditUnits = 25)
+		{
+			GCReaderPtr Reader = GetGCReader(BodySID);
+			if(!Reader) return false;
+
+			Reader->SetReadAhead(Index, EditUnits);
+			return true;
+		}
+
+		//! Enable or disable follow mode for files that are still being written
+		/*! In follow mode reading stops before any KLV, or partition pack with its header metadata and index, that has
+		 *  not yet been completely written. Tell() is left at that KLV boundary and Eof() returns true until more
+		 *  complete data is available, so polling by repeating the usual read loop resumes where the previous
+		 *  poll stopped and only reads the data added since.
+		 *
+		 *  Each partition pack read is added to the file's RIP (so Seek(BodySID, Pos) works without scanning the file)
+		 *  and any index table segments it contains are added to the table returned by GetFollowIndex()
+		 *  \note Applies to all existing GCReaders and any created later - see GCReader::SetFollow()
+		 */
+		void SetFollow(bool Enable = true);
+
+		//! Get the index table built from the segments found so far in follow mode for a given IndexSID
+		/*! An empty table is created if no segments have yet been found, so this may be called before reading
+		 *  starts (for example to pass to SetReadAhead()) and the table will fill as the file is read
+		 */
+		IndexTablePtr GetFollowIndex(UInt32 IndexSID);
+
 		//! Make a GCReader for the specified BodySID
 		/*! \return true on success, false on error (such as there is already a GCReader for this BodySID)
 		 */
@@ -2846,7 +3521,7 @@ namespace mxflib
 		bool ReadFromFile(bool SingleKLV = false);
 
 		//! Resync after possible loss or corruption of body data
-		/*! Searches for the next partition pack and moves file pointer to that point
+		/*! Searches for the next partition pack and moves the current position to that point
 		 *  \return false if an error (or EOF found)
 		 */
 		bool ReSync();
@@ -2871,6 +3546,17 @@ namespace mxflib
 		 *  \return False if seeking could not be initialized (perhaps because the file is not seekable)
 		 */
 		bool InitSeek(void);
+
+		//! Determine if the file currently extends at least as far as a given position (used in follow mode)
+		bool IsAvailable(Position End);
+
+		//! Determine if the KLV at a given position has been completely written (used in follow mode)
+		/*! For partition packs this includes any header metadata and index table segments that follow
+		 */
+		bool IsKLVAvailable(Position Pos);
+
+		//! Record a newly read partition in the RIP and add any index table segments to the follow mode index tables
+		void FollowPartition(PartitionPtr ThisPartition);
 	};
 
 	//! Smart pointer to a BodyReader
@@ -2911,7 +3597,10 @@ namespace mxflib
 	void RegisterGCSystemKey(DataChunkPtr &Key);
 
 	//! Get a GCElementKind structure from a key
-	GCElementKind GetGCElementKind(const ULPtr TheUL);
+	GCElementKind GetGCElementKind(const UInt8 *Key);
+
+	//! Get a GCElementKind structure from a key
+	inline GCElementKind GetGCElementKind(const ULPtr TheUL) { return GetGCElementKind(TheUL->GetValue()); }
 
 	//! Determine if this is a system item
 	bool IsGCSystemItem(const ULPtr TheUL);
@@ -2919,7 +3608,12 @@ namespace mxflib
 	//! Get the track number of this essence key (if it is a GC Key)
 	/*! \return 0 if not a valid GC Key
 	 */
-	UInt32 GetGCTrackNumber(ULPtr TheUL);
+	UInt32 GetGCTrackNumber(const UInt8 *Key);
+
+	//! Get the track number of this essence key (if it is a GC Key)
+	/*! \return 0 if not a valid GC Key
+	 */
+	inline UInt32 GetGCTrackNumber(ULPtr TheUL) { return GetGCTrackNumber(TheUL->GetValue()); }
 }
 
 
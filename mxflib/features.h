@@ -60,6 +60,7 @@ namespace mxflib
 
 	const UInt64 FeatureVersion1KLVFill = UINT64_C(1) << 0;		//!< MXFLib feature: Write KLVFill items with the version 1 key
 	const UInt64 FeatureUnknownsByUL2Name = UINT64_C(1) << 1;	//!< MXFLib feature: If an unknown UL is converted to a name during MDObject construction, using UL2NameFunc, check if this name is a known type
+	const UInt64 FeatureLazyDictionary = UINT64_C(1) << 2;		//!< MXFLib feature: Index most dictionary definitions when loaded, and only build each type or class the first time it is found
 
 	/* This sub-range is currently used by temporary fixes (bits 16 to 30) */
 
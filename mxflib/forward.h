@@ -69,6 +69,11 @@ namespace mxflib
 	typedef std::list<IndexSegmentPtr> IndexSegmentList;
 
 
+	/* Primer forward declaration (the smart pointer types are in primer.h) */
+
+	class Primer;
+
+
 	/* SymbolSpace pointer types */
 
 	class SymbolSpace;
@@ -92,6 +97,22 @@ namespace mxflib
 	extern SymbolSpacePtr MXFLibSymbols;
 
 
+	/* DictionaryOverlay pointer types */
+
+	class DictionaryOverlay;
+
+	//! A smart pointer to a DictionaryOverlay object
+	typedef SmartPtr<DictionaryOverlay> DictionaryOverlayPtr;
+
+
+	/* BuiltMetadict pointer types */
+
+	class BuiltMetadict;
+
+	//! A smart pointer to a BuiltMetadict object
+	typedef SmartPtr<BuiltMetadict> BuiltMetadictPtr;
+
+
 	//! FIXME: Horrible fudge to fix unknown array size problem
 	extern int IndexFudge_NSL;
 
@@ -158,6 +179,7 @@ namespace mxflib
 		MDObjectPtr operator[](const MDTypePtr &ChildType) const;
 		MDObjectPtr operator[](int Index) const;
 		MDObjectPtr operator[](const UL &ChildType) const;
+		MDObjectPtr operator[](const ULConst &ChildType) const;
 		MDObjectPtr operator[](const ULPtr &ChildType) const;
 	};
 
@@ -294,6 +294,228 @@ DataChunkPtr mxflib::FileReadChunk(FileHandle InFile, size_t Size)
 }
 
 
+#ifndef MXFLIB_NO_FILE_IO
+
+#if !defined(_MSC_VER) && (defined(__GLIBC__) || defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__))
+#define MXFLIB_FILE_WINDOW_SUPPORTED
+#endif
+
+#ifdef MXFLIB_FILE_WINDOW_SUPPORTED
+namespace
+{
+	//! A seekable window over a non-seekable source, used to implement FileOpenWindowed()
+	/*! The most recently read bytes are held in a ring buffer. Data before the current read position is
+	 *  only discarded when space is needed for new data, so the look-back window is as large as possible.
+	 */
+	class FileWindow
+	{
+	protected:
+		FileHandle Source;					//!< The underlying non-seekable source
+		UInt8 *Buffer;						//!< Ring buffer holding the current window
+		size_t Capacity;					//!< Size of the ring buffer
+		size_t Head;						//!< Index in Buffer of the byte at WindowStart
+		size_t Used;						//!< Number of valid bytes in Buffer
+		UInt64 WindowStart;					//!< Source offset of the oldest byte held
+		UInt64 Pos;							//!< Current read position (may be beyond the data held)
+		bool SourceEOF;						//!< Set once the source has been exhausted
+
+		//! Largest single read from the source, also the most that is discarded in one go
+		static const size_t FillChunk = 64 * 1024;
+
+	public:
+		FileWindow(FileHandle Source, size_t WindowSize)
+			: Source(Source), Capacity(WindowSize), Head(0), Used(0), WindowStart(0), Pos(0), SourceEOF(false)
+		{
+			if(Capacity < FillChunk) Capacity = FillChunk;
+			Buffer = new UInt8[Capacity];
+		}
+
+		~FileWindow()
+		{
+			delete[] Buffer;
+			FileClose(Source);
+		}
+
+		//! Read from the current position
+		size_t Read(UInt8 *Dest, size_t Size)
+		{
+			size_t Done = 0;
+			while(Done < Size)
+			{
+				UInt64 FillEnd = WindowStart + Used;
+				if(Pos < FillEnd)
+				{
+					// Copy as much as we can from the (contiguous part of the) ring
+					size_t Index = (Head + static_cast<size_t>(Pos - WindowStart)) % Capacity;
+					size_t Bytes = static_cast<size_t>(FillEnd - Pos);
+					if(Bytes > (Capacity - Index)) Bytes = Capacity - Index;
+					if(Bytes > (Size - Done)) Bytes = Size - Done;
+
+					memcpy(&Dest[Done], &Buffer[Index], Bytes);
+					Done += Bytes;
+					Pos += Bytes;
+				}
+				else if(!Fill()) break;
+			}
+
+			return Done;
+		}
+
+		//! Move the read position, returning false if the new position is outside the window
+		bool Seek(Int64 Offset, int Whence)
+		{
+			Int64 Target;
+			if(Whence == SEEK_SET) Target = Offset;
+			else if(Whence == SEEK_CUR) Target = static_cast<Int64>(Pos) + Offset;
+			else
+			{
+				// We can only find the end if the rest of the source fits without discarding anything
+				while((!SourceEOF) && (Used < Capacity)) Fill();
+				if(!SourceEOF) return false;
+
+				Target = static_cast<Int64>(WindowStart + Used) + Offset;
+			}
+
+			if((Target < 0) || (static_cast<UInt64>(Target) < WindowStart))
+			{
+				warning("Attempted to seek to 0x%s in a windowed input, but the window starts at 0x%s\n",
+						Int64toHexString(Target, 8).c_str(), Int64toHexString(WindowStart, 8).c_str());
+				return false;
+			}
+
+			Pos = static_cast<UInt64>(Target);
+			return true;
+		}
+
+		//! Get the current read position
+		UInt64 Tell(void) const { return Pos; }
+
+	protected:
+		//! Read the next chunk from the source, discarding old data if required
+		/*! \return false if no more data could be added to the window */
+		bool Fill(void)
+		{
+			if(SourceEOF) return false;
+
+			if(Used == Capacity)
+			{
+				// Discard the oldest data, but never anything at or after the read position
+				UInt64 FillEnd = WindowStart + Used;
+				UInt64 Keep = (Pos < FillEnd) ? Pos : FillEnd;
+				size_t Discard = static_cast<size_t>(Keep - WindowStart);
+				if(Discard > FillChunk) Discard = FillChunk;
+				if(Discard == 0) return false;
+
+				Head = (Head + Discard) % Capacity;
+				Used -= Discard;
+				WindowStart += Discard;
+			}
+
+			// Read into the contiguous free space after the current data
+			size_t Tail = (Head + Used) % Capacity;
+			size_t Space = Capacity - Used;
+			if(Space > (Capacity - Tail)) Space = Capacity - Tail;
+			if(Space > FillChunk) Space = FillChunk;
+
+			size_t Bytes = FileRead(Source, &Buffer[Tail], Space);
+			if(Bytes == static_cast<size_t>(-1)) Bytes = 0;
+			if(Bytes < Space) SourceEOF = true;
+
+			Used += Bytes;
+			return Bytes != 0;
+		}
+	};
+
+#ifdef __GLIBC__
+	ssize_t FileWindowRead(void *Cookie, char *Buffer, size_t Size)
+	{
+		return static_cast<ssize_t>(static_cast<FileWindow*>(Cookie)->Read(reinterpret_cast<UInt8*>(Buffer), Size));
+	}
+
+	int FileWindowSeek(void *Cookie, off64_t *Offset, int Whence)
+	{
+		FileWindow *Window = static_cast<FileWindow*>(Cookie);
+		if(!Window->Seek(*Offset, Whence)) return -1;
+		*Offset = static_cast<off64_t>(Window->Tell());
+		return 0;
+	}
+#else // __GLIBC__
+	int FileWindowRead(void *Cookie, char *Buffer, int Size)
+	{
+		return static_cast<int>(static_cast<FileWindow*>(Cookie)->Read(reinterpret_cast<UInt8*>(Buffer), static_cast<size_t>(Size)));
+	}
+
+	fpos_t FileWindowSeek(void *Cookie, fpos_t Offset, int Whence)
+	{
+		FileWindow *Window = static_cast<FileWindow*>(Cookie);
+		if(!Window->Seek(static_cast<Int64>(Offset), Whence)) return -1;
+		return static_cast<fpos_t>(Window->Tell());
+	}
+#endif // __GLIBC__
+
+	int FileWindowClose(void *Cookie)
+	{
+		delete static_cast<FileWindow*>(Cookie);
+		return 0;
+	}
+}
+#endif // MXFLIB_FILE_WINDOW_SUPPORTED
+
+
+//! Wrap a non-seekable source (such as a pipe) to give a handle that can seek within a bounded window
+/*! The returned handle holds the most recently read WindowSize bytes of the source in a ring buffer.
+ *  Seeks to any position within that window, or forwards to any later position, will succeed.
+ *  Seeks back before the start of the window will fail, as will FileSeekEnd() unless the whole
+ *  of the remaining source fits in the window.
+ *	\param Source The open source handle, which is closed when the returned handle is closed
+ *	\return The new handle, or an invalid handle if windowed files are not supported on this platform
+ */
+FileHandle mxflib::FileOpenWindowed(FileHandle Source, size_t WindowSize /*=DefaultFileWindowSize*/)
+{
+#ifdef MXFLIB_FILE_WINDOW_SUPPORTED
+	if(!FileValid(Source)) return Source;
+
+	FileWindow *Window = new FileWindow(Source, WindowSize);
+
+#ifdef __GLIBC__
+	cookie_io_functions_t Functions;
+	Functions.read = FileWindowRead;
+	Functions.write = NULL;
+	Functions.seek = FileWindowSeek;
+	Functions.close = FileWindowClose;
+
+	FileHandle Ret = fopencookie(Window, "rb", Functions);
+#else // __GLIBC__
+	FileHandle Ret = funopen(Window, FileWindowRead, NULL, FileWindowSeek, FileWindowClose);
+#endif // __GLIBC__
+
+	// If we failed, don't leave the source open
+	if(!FileValid(Ret)) delete Window;
+
+	return Ret;
+#else // MXFLIB_FILE_WINDOW_SUPPORTED
+	error("Windowed input files are not supported on this platform\n");
+
+	FileClose(Source);
+	return FileInvalid();
+#endif // MXFLIB_FILE_WINDOW_SUPPORTED
+}
+
+
+//! Open the standard input as a windowed file
+FileHandle mxflib::FileOpenStdin(size_t WindowSize /*=DefaultFileWindowSize*/)
+{
+#ifdef _MSC_VER
+	_setmode(0, _O_BINARY);
+	return FileOpenWindowed(_dup(0), WindowSize);
+#else // _MSC_VER
+	return FileOpenWindowed(stdin, WindowSize);
+#endif // _MSC_VER
+}
+
+#endif // MXFLIB_NO_FILE_IO
+
+
 //! Set a data chunk from a hex string
 DataChunkPtr mxflib::Hex2DataChunk(std::string Hex)
 {
@@ -482,8 +704,8 @@ bool mxflib::IsPartitionKey(const UInt8 *Key)
 	const UInt8 DegeneratePartition[13] = { 0x06, 0x0E, 0x2B, 0x34, 0x02, 0x05, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01 };
 	if( memcmp(Key, DegeneratePartition, 13) == 0 )
 	{
-		// Treat all matches as partition packs EXCEPT the RIP
-		return Key[13] != 0x11;
+		// Only header, body and footer partition packs match - not the primer pack or the RIP
+		return (Key[13] >= 0x02) && (Key[13] <= 0x04);
 	}
 
 	return false;
@@ -912,7 +1134,8 @@ namespace mxflib
 		if(!Array) return Ret;
 
 		// Build a working string
-		static MDTypePtr ValType = MDType::Find("UTF16String");
+		// DRAGONS: The type is located each time rather than held in a local static, which would not be initialized safely if first used on several threads at once
+		MDTypePtr ValType = MDType::Find("UTF16String");
 		MDObjectPtr Value = ValType ? new MDObject(ValType) : NULL;
 		if(!Value)
 		{
@@ -972,7 +1195,8 @@ namespace mxflib
 		if(Strings.empty()) return;
 
 		// Build a working string
-		static MDTypePtr ValType = MDType::Find("UTF16String");
+		// DRAGONS: Not a local static, for the same reason as in SplitStringArray()
+		MDTypePtr ValType = MDType::Find("UTF16String");
 		MDObjectPtr Value = ValType ? new MDObject(ValType) : NULL;
 		if(!Value)
 		{
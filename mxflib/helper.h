@@ -167,6 +167,26 @@ namespace mxflib
 	DataChunkPtr FileReadChunk(FileHandle InFile, size_t Size);
 
 
+#ifndef MXFLIB_NO_FILE_IO
+	//! Default size of the look-back window used by FileOpenWindowed()
+	const size_t DefaultFileWindowSize = 16 * 1024 * 1024;
+
+	//! Wrap a non-seekable source (such as a pipe) to give a handle that can seek within a bounded window
+	/*! The returned handle holds the most recently read WindowSize bytes of the source in a ring buffer.
+	 *  Seeks to any position within that window, or forwards to any later position, will succeed.
+	 *  Seeks back before the start of the window will fail, as will FileSeekEnd() unless the whole
+	 *  of the remaining source fits in the window.
+	 *	\param Source The open source handle, which is closed when the returned handle is closed
+	 *	\return The new handle, or an invalid handle if windowed files are not supported on this platform
+	 */
+	FileHandle FileOpenWindowed(FileHandle Source, size_t WindowSize = DefaultFileWindowSize);
+
+	//! Open the standard input as a windowed file
+	/*! \see FileOpenWindowed() */
+	FileHandle FileOpenStdin(size_t WindowSize = DefaultFileWindowSize);
+#endif // MXFLIB_NO_FILE_IO
+
+
 	//! Read an IFF chunk header (from an open file)
 	/*! The Chunk ID is read as a big-endian UInt32 and returned as the first
 	 *	part of the returned pair. The chunk size is read as a specified-endian
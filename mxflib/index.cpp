@@ -360,6 +360,63 @@ IndexPosPtr IndexTable::Lookup(Position EditUnit, int SubItem /* =0 */, bool Reo
 
 
 
+namespace
+{
+	//! Read the entries of a DeltaEntryArray from an "IndexSegment" MDObject
+	/*! \return A new array of entries, to be deleted by the caller, or NULL if there are none
+	 */
+	DeltaEntry *ReadDeltaEntries(MDObjectPtr &DeltaArray, int &Count)
+	{
+		DeltaEntry *Ret = NULL;
+		Count = 0;
+
+		// Read the raw 6-byte entries in a single pass if we can
+		DataChunk Buffer;
+		const UInt8 *pEntry;
+		size_t EntryCount;
+		if(DeltaArray->GetArrayData(6, pEntry, EntryCount, Buffer))
+		{
+			if(EntryCount == 0) return NULL;
+
+			Count = static_cast<int>(EntryCount);
+			Ret = new DeltaEntry[Count];
+
+			int Delta;
+			for(Delta = 0; Delta < Count; Delta++)
+			{
+				Ret[Delta].PosTableIndex = static_cast<Int8>(*pEntry);
+				Ret[Delta].Slice = pEntry[1];
+				memcpy(Ret[Delta].ElementDelta, &pEntry[2], 4);
+
+				pEntry += 6;
+			}
+
+			return Ret;
+		}
+
+		// Otherwise read each entry through its traits
+		Count = static_cast<int>(DeltaArray->size());
+		if(Count == 0) return NULL;
+
+		Ret = new DeltaEntry[Count];
+
+		int Delta = 0;
+		MDObjectULList::iterator it = DeltaArray->begin();
+		while(it != DeltaArray->end())
+		{
+			Ret[Delta].PosTableIndex = (*it).second[0]->GetInt();
+			Ret[Delta].Slice = (*it).second[1]->GetUInt();
+			PutU32((*it).second[2]->GetUInt(), Ret[Delta].ElementDelta);
+
+			it++;
+			Delta++;
+		}
+
+		return Ret;
+	}
+}
+
+
 //! Add an index table segment from an "IndexSegment" MDObject
 /*! DRAGONS: Not the most efficient way to do this */
 IndexSegmentPtr IndexTable::AddSegment(MDObjectPtr Segment)
@@ -397,24 +454,7 @@ IndexSegmentPtr IndexTable::AddSegment(MDObjectPtr Segment)
 			// Free any old delta array
 			if(BaseDeltaCount) delete[] BaseDeltaArray; 
 
-			BaseDeltaCount = static_cast<int>(Ptr->size());
-			BaseDeltaArray = new DeltaEntry[BaseDeltaCount];
-
-			int Delta = 0;
-			MDObjectULList::iterator it = Ptr->begin();
-			while(it != Ptr->end())
-			{
-				BaseDeltaArray[Delta].PosTableIndex = (*it).second[0]->GetInt();
-				BaseDeltaArray[Delta].Slice = (*it).second[1]->GetUInt();
-				PutU32((*it).second[2]->GetUInt(), BaseDeltaArray[Delta].ElementDelta);
-
-				it++;
-				Delta++;
-			}
-			if(Delta != BaseDeltaCount)
-			{
-				error("Malformed DeltaEntryArray in %s at %s\n", Segment->FullName().c_str(), Segment->GetSourceLocation().c_str());
-			}
+			BaseDeltaArray = ReadDeltaEntries(Ptr, BaseDeltaCount);
 		}
 	}
 	else // VBR
@@ -429,25 +469,7 @@ IndexSegmentPtr IndexTable::AddSegment(MDObjectPtr Segment)
 		}
 		else
 		{
-			Ret->DeltaCount = static_cast<int>(Ptr->Value->size());
-
-			Ret->DeltaArray = new DeltaEntry[Ret->DeltaCount];
-			
-			int Delta = 0;
-			MDObjectULList::iterator it = Ptr->begin();
-			while(it != Ptr->end())
-			{
-				Ret->DeltaArray[Delta].PosTableIndex = (*it).second[0]->GetInt();
-				Ret->DeltaArray[Delta].Slice = (*it).second[1]->GetUInt();
-				PutU32((*it).second[2]->GetUInt(), Ret->DeltaArray[Delta].ElementDelta);
-
-				it++;
-				Delta++;
-			}
-			if(Delta != Ret->DeltaCount)
-			{
-				error("Malformed DeltaEntryArray in %s at %s\n", Segment->FullName().c_str(), Segment->GetSourceLocation().c_str());
-			}
+			Ret->DeltaArray = ReadDeltaEntries(Ptr, Ret->DeltaCount);
 		}
 
 		// Copy index entry bits...
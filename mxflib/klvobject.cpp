@@ -34,6 +34,12 @@
 
 using namespace mxflib;
 
+//! Base destructor
+KLVReadHandler_Base::~KLVReadHandler_Base()
+{
+}
+
+
 //! Build a new KLVObject
 KLVObject::KLVObject(ULPtr ObjectUL)
 {
@@ -75,18 +81,52 @@ Int32 KLVObject::Base_ReadKL(void)
 		return 0;
 	}
 
-	// Read the key
-	Source.File->Seek(Source.Offset);
-	TheUL = Source.File->ReadKey();
+	// Read the key and the longest BER length that MXF permits in one go, as MXFFile::ReadKL() does
+	// DRAGONS: This uses a positional read so that several threads may read KLVs from the same file
+	UInt8 Buffer[MaxKLSize];
+	size_t Bytes = Source.File->ReadAt(Source.Offset, Buffer, sizeof(Buffer));
 
 	// Abort now if now valid key
-	if(!TheUL) return 0;
+	if(Bytes < 16)
+	{
+		TheUL = NULL;
+		return 0;
+	}
+
+	// Share the UL of known keys rather than allocating one for each KLV read
+	TheUL = Source.File->InternKey(Buffer);
 
-	// Read the length
-	ValueLength = Dest.OuterLength = Source.OuterLength = Source.File->ReadBER();
+	// Decode the length
+	UInt32 KLSize = 17;
+	Length Len = -1;
+	if(Bytes > 16)
+	{
+		Len = Buffer[16];
+		if(Len >= 0x80)
+		{
+			UInt32 i = static_cast<UInt32>(Len) & 0x7f;
+			if((KLSize + i) > Bytes) Len = -1;
+			else
+			{
+				UInt8 *p = &Buffer[KLSize];
+				KLSize += i;
+
+				Len = 0;
+				while(i--) Len = ((Len<<8) + *(p++));
+			}
+		}
+	}
+
+	if(Len < 0)
+	{
+		error("Incomplete or over-long BER length in file \"%s\" at 0x%s\n", Source.File->Name.c_str(), Int64toHexString(Source.Offset + 16, 8).c_str());
+		KLSize = static_cast<UInt32>(Bytes);
+	}
+
+	ValueLength = Dest.OuterLength = Source.OuterLength = Len;
 
-	// Work out the size of the key and length
-	Source.KLSize = (UInt32)(Source.File->Tell() - Source.Offset);
+	// Record the size of the key and length
+	Source.KLSize = KLSize;
 	
 	// Initially set the destination KLSize target to match the source
 	Dest.KLSize = Source.KLSize;
@@ -142,17 +182,14 @@ size_t KLVObject::Base_ReadDataFrom(DataChunk &Buffer, Position Offset, size_t S
 		return 0;
 	}
 
-	// Seek to the start of the requested data
-	Source.File->Seek(Source.Offset + Source.KLSize + Offset);
-
 	// Resize the chunk
 	// Discarding old data first (by setting Size to 0) prevents old data being 
 	// copied needlessly if the buffer is reallocated to increase its size
 	Buffer.Size = 0;
 	Buffer.Resize(static_cast<size_t>(BytesToRead));
 
-	// Read into the buffer (only as big as the buffer is!)
-	size_t Bytes = Source.File->Read(Buffer.Data, Buffer.Size);
+	// Read into the buffer (only as big as the buffer is!) from the start of the requested data
+	size_t Bytes = Source.File->ReadAt(Source.Offset + Source.KLSize + Offset, Buffer.Data, Buffer.Size);
 
 	// Resize the buffer if something odd happened (such as an early end-of-file)
 	if(Bytes != static_cast<size_t>(BytesToRead)) Buffer.Resize(Bytes);
@@ -51,6 +51,146 @@ SymbolSpaceMap SymbolSpace::AllSymbolSpaces;
 //! Global SymbolSpace for all MXFLib's normal symbols
 SymbolSpacePtr mxflib::MXFLibSymbols = new SymbolSpace("http://www.freemxf.org/MXFLibSymbols");
 
+//! The dictionary overlay active on this thread
+MXFLIB_THREAD_LOCAL DictionaryOverlay *DictionaryOverlay::Current = NULL;
+
+
+//! Construct a new symbol space
+/*! \note If the dictionary is frozen the new symbol space belongs to the current DictionaryOverlay
+ */
+SymbolSpace::SymbolSpace(std::string Name) : SymName(Name), Local(false)
+{
+	// DRAGONS: The list of all symbol spaces is part of the shared dictionary so is not updated once frozen
+	if(MDOType::IsFrozen())
+	{
+		Local = true;
+
+		DictionaryOverlay *Overlay = DictionaryOverlay::GetCurrent();
+		if(Overlay) Overlay->SymbolSpaces.insert(SymbolSpaceMap::value_type(Name, this));
+		else error("Symbol space \"%s\" built while the dictionary is frozen, but no dictionary overlay is active\n", Name.c_str());
+
+		return;
+	}
+
+	SymbolSpaceMap::iterator it = AllSymbolSpaces.find(Name);
+
+	if(it != AllSymbolSpaces.end())
+	{
+		error("Duplicate symbol space name \"%s\"\n", Name.c_str());
+	}
+
+	AllSymbolSpaces.insert(SymbolSpaceMap::value_type(Name, this));
+}
+
+
+//! Construct a new symbol space, which is only added to the list of all symbol spaces if not local
+SymbolSpace::SymbolSpace(std::string Name, bool IsLocal) : SymName(Name), Local(IsLocal)
+{
+	if(!Local) AllSymbolSpaces.insert(SymbolSpaceMap::value_type(Name, this));
+}
+
+
+//! Add a new symbol to this symbol space
+/*! \return true if added OK, else false (most likely a duplicate symbol name)
+ */
+bool SymbolSpace::AddSymbol(std::string Symbol, ULPtr &UL)
+{
+	iterator it = find(Symbol);
+	if(it != end()) return false;
+
+	// Shared symbol spaces are not modified once the dictionary is frozen, the symbol is added to the overlay's copy instead
+	if(!Local && MDOType::IsFrozen())
+	{
+		DictionaryOverlay *Overlay = DictionaryOverlay::GetCurrent();
+		if(!Overlay) return false;
+
+		return Overlay->GetSymbolSpace(SymName)->AddSymbol(Symbol, UL);
+	}
+
+	insert(value_type(Symbol, UL));
+
+	return true;
+}
+
+
+//! Locate the given symbol in this symbol space, optionally check all other spaces too
+ULPtr SymbolSpace::Find(std::string Symbol, bool SearchAll /*=false*/)
+{
+	iterator it = find(Symbol);
+
+	if(it != end()) return (*it).second;
+
+	DictionaryOverlay *Overlay = DictionaryOverlay::GetCurrent();
+
+	// Check any symbols added to this shared symbol space in the current overlay
+	if(Overlay && !Local)
+	{
+		SymbolSpaceMap::iterator map_it = Overlay->SymbolSpaces.find(SymName);
+		if(map_it != Overlay->SymbolSpaces.end())
+		{
+			it = (*map_it).second->find(Symbol);
+			if(it != (*map_it).second->end()) return (*it).second;
+		}
+	}
+
+	if(SearchAll)
+	{
+		SymbolSpaceMap::iterator map_it = AllSymbolSpaces.begin();
+		while(map_it != AllSymbolSpaces.end())
+		{
+			it = (*map_it).second->find(Symbol);
+			if(it != (*map_it).second->end()) return (*it).second;
+
+			map_it++;
+		}
+
+		if(Overlay)
+		{
+			map_it = Overlay->SymbolSpaces.begin();
+			while(map_it != Overlay->SymbolSpaces.end())
+			{
+				it = (*map_it).second->find(Symbol);
+				if(it != (*map_it).second->end()) return (*it).second;
+
+				map_it++;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+
+//! Find the symbol space with a given name
+SymbolSpacePtr SymbolSpace::FindSymbolSpace(std::string Name)
+{
+	SymbolSpaceMap::iterator it = AllSymbolSpaces.find(Name);
+
+	if(it != AllSymbolSpaces.end()) return (*it).second;
+
+	DictionaryOverlay *Overlay = DictionaryOverlay::GetCurrent();
+	if(Overlay)
+	{
+		it = Overlay->SymbolSpaces.find(Name);
+		if(it != Overlay->SymbolSpaces.end()) return (*it).second;
+	}
+
+	return NULL;
+}
+
+
+//! Get the local symbol space with a given name, building it if required
+SymbolSpacePtr DictionaryOverlay::GetSymbolSpace(const std::string &Name)
+{
+	SymbolSpaceMap::iterator it = SymbolSpaces.find(Name);
+	if(it != SymbolSpaces.end()) return (*it).second;
+
+	SymbolSpacePtr Ret = new SymbolSpace(Name, true);
+	SymbolSpaces.insert(SymbolSpaceMap::value_type(Name, Ret));
+
+	return Ret;
+}
+
 //! Translator function to translate unknown ULs to object names
 MDObject::ULTranslator MDObject::UL2NameFunc = NULL;
 
@@ -79,6 +219,9 @@ PrimerPtr MDOType::MakeBuiltInPrimer(bool SetStatic /*=false*/)
  */
 PrimerPtr MDOType::MakePrimer(bool SetStatic /*=false*/)
 {
+	// DRAGONS: The static primer is part of the shared dictionary so is not replaced once frozen
+	if(SetStatic && Frozen) return StaticPrimer;
+
 	PrimerPtr Ret = new Primer;
 
 	// DRAGONS: Some debug!
@@ -104,6 +247,9 @@ PrimerPtr MDOType::MakePrimer(bool SetStatic /*=false*/)
 		it++;
 	}
 
+	// Add the tags of any classes not yet built by lazy dictionary loading
+	mxflib_deftypes::AddLazyTags(Ret.GetPtr());
+
 	// Replace existing StaticPrimer if requested
 	if(SetStatic) StaticPrimer = Ret;
 
@@ -111,6 +257,32 @@ PrimerPtr MDOType::MakePrimer(bool SetStatic /*=false*/)
 }
 
 
+//! Determine if a class is part of the frozen dictionary, and so must not be modified
+bool MDOType::IsShared(const MDOType *Type)
+{
+	if(!Frozen || !Type->TypeUL) return false;
+
+	const MDOTypePtr *Found = ULLookup.Find(*Type->TypeUL);
+	return Found && ((*Found).GetPtr() == Type);
+}
+
+
+//! Freeze the dictionary so that it may be shared by parsers running on several threads
+void MDOType::Freeze(void)
+{
+	if(Frozen) return;
+
+	// Complete any lazy initialization now, as it cannot be done once frozen
+	if(!InternalsDefined) DefineInternals();
+	BuildLazyDictionary();
+
+	// The static primer will no longer have tags added as it may be in use on several threads
+	GetStaticPrimer()->Freeze();
+
+	Frozen = true;
+}
+
+
 //! Builds an MDOType
 /*! This constructor is private so the ONLY way to create
  *	new MDOTypes from outside this class is via member methods
@@ -171,31 +343,66 @@ MDOTypePtr MDOType::Find(std::string BaseType, SymbolSpacePtr &SymSpace, bool Se
  */
 MDOTypePtr MDOType::Find(const UL& BaseUL)
 {
-	MDOTypePtr theType;
+	// Look for an exact match, or failing that a version-less match for SMPTE ULs
+	const MDOTypePtr *theType = ULLookup.FindVersionless(BaseUL);
+	if(theType) return *theType;
 
-	std::map<UL, MDOTypePtr>::iterator it = ULLookup.find(BaseUL);
-
-	if(it != ULLookup.end())
+	// Try any classes defined in the current overlay
+	DictionaryOverlay *Overlay = DictionaryOverlay::GetCurrent();
+	if(Overlay)
 	{
-		theType = (*it).second;
+		theType = Overlay->ClassLookup.FindVersionless(BaseUL);
+		if(theType) return *theType;
 	}
-	else
+
+	// Nothing can be built once frozen, or if nothing is held by lazy dictionary loading
+	if(Frozen || !mxflib_deftypes::HasLazyClasses()) return NULL;
+
+	// Build the class if it is held by lazy dictionary loading
+	MDOTypeList::iterator Last = AllTypes.end();
+	if(!AllTypes.empty()) Last--;
+
+	LazyBuildDepth++;
+	bool Built = mxflib_deftypes::BuildLazyClass(BaseUL);
+	LazyBuildDepth--;
+
+	if(Built)
 	{
-		// If the exact match is not found try a version-less lookup by changing the version number to 1
-		if((BaseUL.GetValue()[0] == 0x06) && (BaseUL.GetValue()[1] == 0x0e) && (BaseUL.GetValue()[2] == 0x2b) && (BaseUL.GetValue()[3] == 0x34))
-		{
-			UL Ver1UL = BaseUL;
-			Ver1UL.Set(7, 1);
+		/* Locate reference targets for the classes just built, including any built while building this one.
+		 * DRAGONS: This is not done for nested builds as the targets may be classes that are part-built,
+		 *          and errors are not reported as targets may be loaded later - LocateRefTypes() reports them
+		 */
+		if(!LazyBuildDepth) LocateRefTypes((Last == AllTypes.end()) ? AllTypes.begin() : ++Last, AllTypes.end(), false);
 
-			std::map<UL, MDOTypePtr>::iterator it2 = ULLookupVer1.find(Ver1UL);
-			if(it2 != ULLookupVer1.end())
-			{
-				theType = (*it2).second;
-			}
-		}
+		theType = ULLookup.FindVersionless(BaseUL);
+		if(theType) return *theType;
 	}
 
-	return theType;
+	return NULL;
+}
+
+
+//! Get the shared UL of the type whose UL exactly matches the given 16 bytes
+/*! This allows keys read from a file to share the dictionary's UL rather than allocating a new one for each
+ *  \return The UL held by the type, or NULL if no type has exactly this UL
+ *  \note The shared UL must not be modified
+ */
+ULPtr MDOType::InternUL(const UInt8 *Key)
+{
+	ULPtr Ret;
+
+	// DRAGONS: Until the dictionary is frozen lazy building may add to the table on another thread, after that it is never changed
+	bool Locked = !IsFrozen();
+	if(Locked) InternMutex.Lock();
+
+	const ULPtr *Found = InternedULs.Find(Key);
+
+	// DRAGONS: The type's UL could have been changed since it was added to the table, so check it still matches
+	if(Found && (memcmp((*Found)->GetValue(), Key, 16) == 0)) Ret = *Found;
+
+	if(Locked) InternMutex.Unlock();
+
+	return Ret;
 }
 
 
@@ -888,6 +1095,24 @@ MDObjectPtr MDObject::AddChild(const UL &ChildType, bool Replace /*=true*/)
 	// Return smart pointer to the new object
 	return Ret;
 }
+
+
+//! Add a new child MDObject of the specified type, only building a UL if a new child is added
+MDObjectPtr MDObject::AddChild(const ULConst &ChildType, bool Replace /*=true*/)
+{
+	if(Replace)
+	{
+		MDObjectPtr Ret = Child(ChildType);
+		if(Ret)
+		{
+			SetModified(true);
+			return Ret;
+		}
+	}
+
+	return AddChild(UL(ChildType), false);
+}
+
 		
 //! Add a new child MDObject to a vector
 /*! \note The type of the object added is automatic. 
@@ -1177,6 +1402,26 @@ MDObjectPtr MDObject::operator[](const UL &ChildType) const
 }
 
 
+//! Access sub-item of the specified constant UL type within a compound MDObject
+/*! If the child does not exist in this item then NULL is returned
+ *  even if it is a valid child to have in this type of container
+ */
+MDObjectPtr MDObject::operator[](const ULConst &ChildType) const
+{
+	MDObjectULList::const_iterator it = begin();
+	while(it != end())
+	{
+		if((*it).first.Matches(ChildType))
+		{
+			return (*it).second;
+		}
+		it++;
+	}
+
+	return NULL;
+}
+
+
 //! Locate a numerically indexed child
 /*! DRAGONS: If the type is not numerically indexed then the index will be treated as a 0-based ChildList index */
 MDObjectPtr MDObject::operator[](int Index) const
@@ -1660,7 +1905,8 @@ warning("Entered dead code for reading old-style batches/arrays for %s\n", FullN
 					else if(Type->GetKeyFormat() == DICT_KEY_AUTO)
 					{
 						mxflib_assert(Key.Size == 16);
-						ULPtr ThisUL = new UL(Key.Data);
+						ULPtr ThisUL = MDOType::InternUL(Key.Data);
+						if(!ThisUL) ThisUL = new UL(Key.Data);
 
 						NewItem = new MDObject(ThisUL);
 					}
@@ -2095,7 +2341,8 @@ DataChunkPtr MDObject::PutData(PrimerPtr UsePrimer /* =NULL */) const
 	else
 	{
 		// Compounds must be written in the correct order
-		if(ValueType->EffectiveClass() == COMPOUND)
+		// DRAGONS: Sub-items built from a value type, such as the items of an array, have no child types - their parts are built in order
+		if((ValueType->EffectiveClass() == COMPOUND) && !Type->GetChildList().empty())
 		{
 			MDOTypeList::const_iterator it = Type->GetChildList().begin();
 			while(it != Type->GetChildList().end())
@@ -2138,6 +2385,175 @@ DataChunkPtr MDObject::PutData(PrimerPtr UsePrimer /* =NULL */) const
 };
 
 
+namespace
+{
+	//! Get the item type of an array or batch of fixed-size items that each hold their own data, or NULL if this is not one
+	MDTypePtr FixedArrayItemType(const MDTypePtr &ValueType, size_t ItemSize)
+	{
+		if((!ValueType) || (ValueType->EffectiveClass() != TYPEARRAY)) return NULL;
+
+		MDTypePtr ItemType = ValueType->EffectiveBase();
+		if((!ItemType) || (ItemType->EffectiveSize() != ItemSize)) return NULL;
+
+		// Basic items, and those handled as a whole by their traits (such as ULs), hold all their data
+		if((ItemType->EffectiveClass() == BASIC) || ItemType->HandlesSubdata()) return ItemType;
+
+		// Compounds of basic items (such as delta entries) hold their data in their parts, in order
+		if(ItemType->EffectiveClass() != COMPOUND) return NULL;
+
+		MDTypeList::const_iterator it = ItemType->EffectiveType()->GetChildList().begin();
+		while(it != ItemType->EffectiveType()->GetChildList().end())
+		{
+			if(((*it)->EffectiveClass() != BASIC) && (!(*it)->HandlesSubdata())) return NULL;
+			it++;
+		}
+
+		return ItemType;
+	}
+}
+
+
+//! Get the raw data of all items in an array or batch of fixed-size items
+/*! The data held by each item is read directly, rather than through the item's traits.
+ *  \param ItemSize The size of each item in bytes
+ *  \param ItemData Set to point to the big-endian data of all the items
+ *  \param Count Set to the number of items
+ *  \param Buffer Used to gather the data of the items if it is not held by this object as a whole
+ *  \return true if read, false if this is not an array or batch of fixed-size items of ItemSize bytes
+ */
+bool MDObject::GetArrayData(size_t ItemSize, const UInt8 *&ItemData, size_t &Count, DataChunk &Buffer) const
+{
+	if((ItemSize == 0) || (!ValueType) || (ValueType->EffectiveClass() != TYPEARRAY)) return false;
+
+	// If there are no sub items the data is held by this object as a whole
+	if(empty() || HandlesSubdata())
+	{
+		if((Data.Size % ItemSize) || (!FixedArrayItemType(ValueType, ItemSize))) return false;
+
+		ItemData = Data.Data;
+		Count = Data.Size / ItemSize;
+		return true;
+	}
+
+	/* Otherwise gather the data of each item
+	 * DRAGONS: The item type is not checked here, as that costs more than gathering a short array, but the raw data is only used
+	 *          if each item, or each part of a compound item, holds its own data and these add up to exactly ItemSize bytes
+	 */
+	Buffer.Resize(size() * ItemSize, false);
+	UInt8 *pBuffer = Buffer.Data;
+
+	MDObject::const_iterator it = begin();
+	while(it != end())
+	{
+		const MDObject *ThisItem = (*it).second;
+		if(ThisItem->empty())
+		{
+			if(ThisItem->Data.Size != ItemSize) return false;
+
+			memcpy(pBuffer, ThisItem->Data.Data, ItemSize);
+			pBuffer += ItemSize;
+		}
+		else
+		{
+			// Gather the parts of a compound item
+			size_t Remaining = ItemSize;
+			MDObject::const_iterator Part_it = ThisItem->begin();
+			while(Part_it != ThisItem->end())
+			{
+				const DataChunk &PartData = (*Part_it).second->Data;
+				if((PartData.Size > Remaining) || (!(*Part_it).second->empty())) return false;
+
+				memcpy(pBuffer, PartData.Data, PartData.Size);
+				pBuffer += PartData.Size;
+				Remaining -= PartData.Size;
+				Part_it++;
+			}
+
+			if(Remaining) return false;
+		}
+		it++;
+	}
+
+	ItemData = Buffer.Data;
+	Count = size();
+	return true;
+}
+
+
+//! Set all items of an array or batch of fixed-size items from raw data
+/*! Each item is built directly from the data, rather than through the item's traits.
+ *  \return true if set, false if this is not an array or batch of fixed-size items of ItemSize bytes, or too many items are given for a fixed-size array
+ */
+bool MDObject::SetArrayData(size_t ItemSize, size_t Count, const UInt8 *ItemData)
+{
+	MDTypePtr ItemType = FixedArrayItemType(ValueType, ItemSize);
+	if(!ItemType) return false;
+
+	// The number of items in a fixed size array, or zero if variable
+	UInt32 MaxItems = ValueType->Size;
+	if(MaxItems && (Count > MaxItems)) return false;
+
+	if(HandlesSubdata())
+	{
+		Data.Set(Count * ItemSize, ItemData);
+	}
+	else
+	{
+		// Start with no children in the object
+		clear();
+
+		while(Count--)
+		{
+			MDObjectPtr NewItem = new MDObject(ItemType);
+			if(NewItem->empty())
+			{
+				NewItem->Data.Set(ItemSize, ItemData);
+			}
+			else
+			{
+				// Set each part of a compound item, which are built at their fixed sizes
+				const UInt8 *PartData = ItemData;
+				MDObject::iterator Part_it = NewItem->begin();
+				while(Part_it != NewItem->end())
+				{
+					DataChunk &ThisPart = (*Part_it).second->Data;
+					ThisPart.Set(ThisPart.Size, PartData);
+					PartData += ThisPart.Size;
+					Part_it++;
+				}
+			}
+			AddChild(NewItem);
+
+			ItemData += ItemSize;
+		}
+
+		// Force padding to be added if this is a fixed size array
+		if(MaxItems) Resize(MaxItems);
+	}
+
+	SetModified(true);
+	return true;
+}
+
+
+//! Is this an array or batch of basic integer items of ItemSize bytes?
+/*! DRAGONS: Floating point types are basic types that are never byte-swapped, so multi-byte basic types that are not
+ *           byte-swapped are not taken as integers
+ */
+bool MDObject::HasIntegerItems(size_t ItemSize) const
+{
+	if((!ValueType) || (ValueType->EffectiveClass() != TYPEARRAY)) return false;
+
+	MDTypePtr ItemType = ValueType->EffectiveBase();
+	if((!ItemType) || (ItemType->EffectiveClass() != BASIC) || (ItemType->EffectiveSize() != ItemSize)) return false;
+
+	const MDType *BasicType = ItemType->EffectiveType();
+	if(BasicType->IsCharacter()) return false;
+
+	return (ItemSize == 1) || BasicType->GetEndian();
+}
+
+
 //! Write this object, and any strongly linked sub-objects, to a memory buffer
 /*! The object must be at the outer or top KLV level. 
  *	The objects are appended to the buffer
@@ -2519,9 +2935,14 @@ UInt32 MDObject::WriteKey(DataChunkPtr &Buffer, DictKeyFormat Format, PrimerPtr
 			}
 
 
-			Tag UseTag;
-			if(UsePrimer) UseTag = UsePrimer->Lookup(TheUL, TheTag);
-			else UseTag = MDOType::GetStaticPrimer()->Lookup(TheUL, TheTag);
+			PrimerPtr ThisPrimer = UsePrimer ? UsePrimer : MDOType::GetStaticPrimer();
+			Tag UseTag = ThisPrimer->Lookup(TheUL, TheTag);
+
+			// DRAGONS: A frozen primer, such as the static primer once the dictionary is frozen, cannot allocate dynamic tags
+			if((UseTag == 0) && ThisPrimer->IsFrozen())
+			{
+				error("Unable to write %s as it needs a dynamic tag, which cannot be allocated in a frozen primer - supply a per-file primer\n", FullName().c_str());
+			}
 
 			UInt8 Buff[2];
 			PutU16(UseTag, Buff);
@@ -2775,7 +3196,7 @@ void MDOType::Derive(MDOTypePtr &BaseEntry)
 	{
 		// Add the base types children
 		insert(*it);
-		NameLookup[RootName + DictName + "/" + (*it)->Name()] = *it;
+		if(!Frozen) NameLookup[RootName + DictName + "/" + (*it)->Name()] = *it;
 		it++;
 	}
 
@@ -2878,6 +3299,22 @@ bool MDObject::IsA(const UL &BaseType) const
 
 	return false;
 }
+
+
+//! Determine if this object is derived from a specified constant UL type (directly or indirectly)
+bool MDObject::IsA(const ULConst &BaseType) const
+{
+	MDOTypePtr TestType = Type;
+
+	while(TestType)
+	{
+		const ULPtr &TestUL = TestType->GetTypeUL();
+		if((*TestUL).Matches(BaseType)) return true;
+		TestType = TestType->Base;
+	}
+
+	return false;
+}
 		
 
 //! Determine if this type is derived from a specified type (directly or indirectly)
@@ -2951,8 +3388,25 @@ bool MDOType::HasA(const ULPtr &ChildType) const
 //! Locate reference target types for any types not yet located
 void mxflib::MDOType::LocateRefTypes(void)
 {
-	MDOTypeList::iterator it = MDOType::AllTypes.begin();
-	while(it != MDOType::AllTypes.end())
+	// Once the dictionary is frozen only classes in the current overlay can be updated
+	MDOTypeList *Types = &AllTypes;
+	if(Frozen)
+	{
+		DictionaryOverlay *Overlay = DictionaryOverlay::GetCurrent();
+		if(!Overlay) return;
+		Types = &Overlay->Classes;
+	}
+
+	LocateRefTypes(Types->begin(), Types->end(), true);
+}
+
+
+//! Locate reference target types for any types in a range that are not yet located
+/*! \param ReportErrors - If false, targets that cannot yet be found are left to a later call
+ */
+void mxflib::MDOType::LocateRefTypes(MDOTypeList::iterator it, MDOTypeList::iterator End, bool ReportErrors)
+{
+	while(it != End)
 	{
 		// Locate the reference target if the name exists, but not the type
 		if((*it)->RefTargetName.size() && !(*it)->RefTarget)
@@ -2969,7 +3423,7 @@ void mxflib::MDOType::LocateRefTypes(void)
 			// Still not found?
 			if(!Target)
 			{
-				error("Type %s specifies an unknown reference target type of %s\n", (*it)->Name().c_str(), (*it)->RefTargetName.c_str());
+				if(ReportErrors) error("Type %s specifies an unknown reference target type of %s\n", (*it)->Name().c_str(), (*it)->RefTargetName.c_str());
 			}
 			else
 			{
@@ -3102,6 +3556,24 @@ MDOTypePtr MDOType::DefineClass(ClassRecordPtr &ThisClass, SymbolSpacePtr Defaul
 	// If no parent was specified, inherit from the definition
 	if(!Parent) Parent = MDOType::Find(ThisClass->Parent);
 
+	// Once the dictionary is frozen new classes can only be added to the current overlay
+	DictionaryOverlay *Overlay = NULL;
+	if(Frozen)
+	{
+		Overlay = DictionaryOverlay::GetCurrent();
+		if(!Overlay)
+		{
+			error("Unable to define class %s as the dictionary is frozen and no dictionary overlay is active\n", ThisClass->Name.c_str());
+			return NULL;
+		}
+
+		if(Parent && IsShared(Parent))
+		{
+			error("Unable to add %s to class %s as the dictionary is frozen\n", ThisClass->Name.c_str(), Parent->FullName().c_str());
+			return NULL;
+		}
+	}
+
 	// Does this entry have a valid UL (rather than a UUID)
 	bool ValidUL = false;
 
@@ -3151,6 +3623,22 @@ MDOTypePtr MDOType::DefineClass(ClassRecordPtr &ThisClass, SymbolSpacePtr Defaul
 	// Are we extending an existing definition?
 	if(Ret)
 	{
+		// Classes in a frozen dictionary are not changed - the shared definition is used as it is
+		if(IsShared(Ret))
+		{
+			debug("Not extending %s as the dictionary is frozen\n", Ret->FullName().c_str());
+
+			// It may still be added to a secondary parent that belongs to the overlay (such as InstanceUID in a new set)
+			if(Parent && (Parent != Ret->Parent) && (!Parent->Child(TypeUL)))
+			{
+				Parent->insert(Ret);
+
+				debug("Adding %s to secondary parent %s\n", Ret->FullName().c_str(), Parent->FullName().c_str());
+			}
+
+			return Ret;
+		}
+
 		Extending = true;
 
 		// If we extend an "item" then we will replace it
@@ -3236,7 +3724,7 @@ MDOTypePtr MDOType::DefineClass(ClassRecordPtr &ThisClass, SymbolSpacePtr Defaul
 				Ret->Use = ThisClass->Usage;
 
 				// Set the name lookup - UL lookup set when key set
-				NameLookup[RootName + ThisClass->Name] = Ret;
+				if(!Frozen) NameLookup[RootName + ThisClass->Name] = Ret;
 			}
 		}
 		else if(ThisClass->Class == ClassArray)
@@ -3541,32 +4029,34 @@ MDOTypePtr MDOType::DefineClass(ClassRecordPtr &ThisClass, SymbolSpacePtr Defaul
 	/* Add this new class to the lookups - this is done after building children so we can fail safely if children not built */
 	if(!Extending)
 	{
-		ULLookup[*TypeUL] = Ret;
-
-		// Add the name and UL to the symbol space
-		ThisSymbolSpace->AddSymbol(Ret->FullName(), TypeUL);
-
-		/* Add a version 1 UL for versionless compares */
-
-		// Only add the version 1 lookup for SMPTE ULs (other labels may have other version rules)
-		if((TypeUL->GetValue()[0] == 0x06) && (TypeUL->GetValue()[1] == 0x0e) && (TypeUL->GetValue()[2] == 0x2b) && (TypeUL->GetValue()[3] == 0x34))
+		if(Overlay)
 		{
-			// Make a version 1 copy of this UL
-			ULPtr Ver1 = new UL(TypeUL);
-			Ver1->Set(7,1);
-
-			// Insert it into the version 1 lookup
-			ULLookupVer1[*Ver1] = Ret;
+			// DRAGONS: This lookup also serves versionless compares for SMPTE ULs
+			Overlay->ClassLookup.Set(*TypeUL, Ret);
+			Overlay->Classes.push_back(Ret);
 		}
-
-		if(!Parent)
+		else
 		{
-			// If it is a top level type then add it to TopTypes as well
-			TopTypes.push_back(Ret);
+			// DRAGONS: This lookup also serves versionless compares for SMPTE ULs
+			ULLookup.Set(*TypeUL, Ret);
+
+			// Share this class's UL with keys read from files
+			InternMutex.Lock();
+			InternedULs.Set(*TypeUL, TypeUL);
+			InternMutex.Unlock();
+
+			if(!Parent)
+			{
+				// If it is a top level type then add it to TopTypes as well
+				TopTypes.push_back(Ret);
+			}
+
+			// Add to the list of all types
+			AllTypes.push_back(Ret);
 		}
 
-		// Add to the list of all types
-		AllTypes.push_back(Ret);
+		// Add the name and UL to the symbol space
+		ThisSymbolSpace->AddSymbol(Ret->FullName(), TypeUL);
 	}
 
 	/* We need to ensure that any extension to a set or pack is also performed for all derived items,
@@ -3574,8 +4064,11 @@ MDOTypePtr MDOType::DefineClass(ClassRecordPtr &ThisClass, SymbolSpacePtr Defaul
 	 */
 	if(Extending && ThisClass->ExtendSubs && (Ret->size() != 0))
 	{
-		MDOTypeList::iterator it = AllTypes.begin();
-		while(it != AllTypes.end())
+		// DRAGONS: Shared classes cannot be derived from classes in an overlay, so only the overlay needs checking once frozen
+		MDOTypeList &Types = Overlay ? Overlay->Classes : AllTypes;
+
+		MDOTypeList::iterator it = Types.begin();
+		while(it != Types.end())
 		{
 			// Extend any types that are derived from our use (carefully not adding again to our use)
 			if(((*it) != Ret) && ((*it)->IsA(Ret))) (*it)->ReDerive(Ret);
@@ -3595,11 +4088,20 @@ MDOTypePtr MDOType::DefineClass(ClassRecordPtr &ThisClass, SymbolSpacePtr Defaul
 MDOTypeList MDOType::AllTypes;	//!< All types managed by the MDOType class
 MDOTypeList MDOType::TopTypes;	//!< The top-level types managed by the MDOType class
 
-//! Map for UL lookups
-std::map<UL, MDOTypePtr> MDOType::ULLookup;
-		
-//! Map for UL version-less lookups
-std::map<UL, MDOTypePtr> MDOType::ULLookupVer1;
+//! Flag to show that the dictionary has been frozen and may be shared between threads
+bool MDOType::Frozen = false;
+
+//! Number of classes currently being built by lazy dictionary loading, one inside another
+int MDOType::LazyBuildDepth = 0;
+
+//! Hash table for UL lookups, both exact and version-less
+ULHashMap<MDOTypePtr> MDOType::ULLookup;
+
+//! The shared UL of each type in the dictionary, by its exact UL
+ULHashMap<ULPtr> MDOType::InternedULs;
+
+//! Mutex protecting InternedULs until the dictionary is frozen
+Mutex MDOType::InternMutex;
 		
 //! Map for reverse lookups based on type name
 std::map<std::string, MDOTypePtr> MDOType::NameLookup;
@@ -41,6 +41,7 @@
 #include <string>
 #include <list>
 #include <map>
+#include <vector>
 
 
 
@@ -54,70 +55,34 @@ namespace mxflib
 
 		std::string SymName;									//!< The name of this symbol space
 
+		bool Local;												//!< True if this symbol space belongs to a DictionaryOverlay rather than being shared
+
 	private:
  		//! Prevent copy construction by NOT having an implementation to this copy constructor
 		SymbolSpace(const SymbolSpace &rhs);
 
 	public:
 		//! Construct a new symbol space
-		SymbolSpace(std::string Name) : SymName(Name)
-		{
-			SymbolSpaceMap::iterator it = AllSymbolSpaces.find(Name);
-
-			if(it != AllSymbolSpaces.end())
-			{
-				error("Duplicate symbol space name \"%s\"\n");
-			}
-
-			AllSymbolSpaces.insert(SymbolSpaceMap::value_type(Name, this));
-		};
+		/*! \note If the dictionary is frozen the new symbol space belongs to the current DictionaryOverlay */
+		SymbolSpace(std::string Name);
 
+		//! Construct a new symbol space, which is only added to the list of all symbol spaces if not local
+		/*! Local symbol spaces are used by DictionaryOverlay objects */
+		SymbolSpace(std::string Name, bool IsLocal);
 
 		//! Add a new symbol to this symbol space
 		/*! \return true if added OK, else false (most likely a duplicate symbol name)
+		 *  \note If the dictionary is frozen, symbols added to a shared symbol space are held in the current DictionaryOverlay
 		 */
-		bool AddSymbol(std::string Symbol, ULPtr &UL)
-		{
-			iterator it = find(Symbol);
-			if(it != end()) return false;
-
-			insert(value_type(Symbol, UL));
-
-			return true;
-		}
-
+		bool AddSymbol(std::string Symbol, ULPtr &UL);
 
 		//! Locate the given symbol in this symbol space, optionally check all other spaces too
-		ULPtr Find(std::string Symbol, bool SearchAll = false)
-		{
-			iterator it = find(Symbol);
-
-			if(it != end()) return (*it).second;
-
-			if(SearchAll)
-			{
-				SymbolSpaceMap::iterator map_it = AllSymbolSpaces.begin();
-				while(map_it != AllSymbolSpaces.end())
-				{
-					it = (*map_it).second->find(Symbol);
-					if(it != (*map_it).second->end()) return (*it).second;
-
-					map_it++;
-				}
-			}
-
-			return NULL;
-		}
+		/*! Any symbols held for this symbol space in the current DictionaryOverlay are also found */
+		ULPtr Find(std::string Symbol, bool SearchAll = false);
 
 		//! Find the symbol space with a given name
-		static SymbolSpacePtr FindSymbolSpace(std::string Name)
-		{
-			SymbolSpaceMap::iterator it = AllSymbolSpaces.find(Name);
-
-			if(it != AllSymbolSpaces.end()) return (*it).second;
-
-			return NULL;
-		}
+		/*! Symbol spaces in the current DictionaryOverlay are found if there is no shared symbol space of that name */
+		static SymbolSpacePtr FindSymbolSpace(std::string Name);
 
 		//! Get the name of this symbol space
 		const std::string &Name(void) const { return SymName; }
@@ -228,7 +193,8 @@ namespace mxflib
 			else TypeName = Name;
 
 			// Set the name lookup - UL lookup set when key set
-			NameLookup[RootName + Name] = this;
+			// DRAGONS: The name lookup is part of the shared dictionary so is not updated once frozen
+			if(!Frozen) NameLookup[RootName + Name] = this;
 
 			// Start of with no referencing details
 			RefType = ClassRefNone;
@@ -312,6 +278,9 @@ namespace mxflib
 		//! Find a type with a given UL
 		static MDOTypePtr Find(const UL& BaseUL);
 
+		//! Get the shared UL of the type whose UL exactly matches the given 16 bytes
+		static ULPtr InternUL(const UInt8 *Key);
+
 		//! Find a type via a tag
 		static MDOTypePtr Find(Tag BaseTag, PrimerPtr BasePrimer);
 
@@ -479,6 +448,10 @@ namespace mxflib
 		//! Build a primer from the current dictionary, optionally set as the static primer
 		static PrimerPtr MakePrimer(bool SetStatic = false);
 
+	protected:
+		//! Locate reference target types for any types in a range that are not yet located
+		static void LocateRefTypes(MDOTypeList::iterator it, MDOTypeList::iterator End, bool ReportErrors);
+
 
 		/* Interface IMDDict */
 		/*********************/
@@ -547,11 +520,14 @@ namespace mxflib
 		static MDOTypeList	AllTypes;	//!< All types managed by this object
 		static MDOTypeList	TopTypes;	//!< The top-level types managed by this object
 
-		//! Map for UL lookups
-		static std::map<UL, MDOTypePtr> ULLookup;
-		
-		//! Map for UL lookups - ignoring the version number (all entries use version = 1)
-		static std::map<UL, MDOTypePtr> ULLookupVer1;
+		//! Hash table for UL lookups, both exact and ignoring the version number
+		static ULHashMap<MDOTypePtr> ULLookup;
+
+		//! The shared UL of each type in the dictionary, by its exact UL, used by InternUL()
+		static ULHashMap<ULPtr> InternedULs;
+
+		//! Mutex protecting InternedULs until the dictionary is frozen, as keys may be interned on several threads while classes are built lazily
+		static Mutex InternMutex;
 
 		//! Map for reverse lookups based on type name
 		static MDOTypeMap NameLookup;
@@ -559,6 +535,12 @@ namespace mxflib
 		//! Flag to show when we have loaded types and classes required for internal use
 		static bool InternalsDefined;
 
+		//! Flag to show that the dictionary has been frozen and may be shared between threads
+		static bool Frozen;
+
+		//! Number of classes currently being built by lazy dictionary loading, one inside another
+		static int LazyBuildDepth;
+
 	public:
 		//! Bit masks for items that are to be set for this definition in BuildTypeFromDict
 		/*! This allows some values to be inherited from the base class,
@@ -596,14 +578,32 @@ namespace mxflib
 			AllTypes.clear();
 			TopTypes.clear();
 			ULLookup.clear();
-			ULLookupVer1.clear();
 			NameLookup.clear();
+
+			InternMutex.Lock();
+			InternedULs.clear();
+			InternMutex.Unlock();
+			mxflib_deftypes::ClearLazyClasses();
 			InternalsDefined = false;
 		}
 
 		//! Load types and classes required for internal use 
 		static void DefineInternals(void);
 
+		//! Freeze the dictionary so that it may be shared by parsers running on several threads
+		/*! Any lazy initialization is completed first, after which the shared dictionary is not modified.
+		 *  Classes and types defined after freezing, such as from a file's metadictionary, are held in the
+		 *  DictionaryOverlay that is active on the defining thread.
+		 *  \note This must be called before any other threads start using the dictionary
+		 */
+		static void Freeze(void);
+
+		//! Determine if the dictionary has been frozen
+		static bool IsFrozen(void) { return Frozen; }
+
+		//! Determine if a class is part of the frozen dictionary, and so must not be modified
+		static bool IsShared(const MDOType *Type);
+
 		//! Determine if there is a valid MXF dictionary loaded
 		/*! \return true if there is an MXF dictionary loaded */
 		static bool IsDictLoaded(void)
@@ -623,6 +623,64 @@ namespace mxflib
 }
 
 
+namespace mxflib
+{
+	//! Per-file additions to a frozen dictionary
+	/*! Once MDOType::Freeze() has been called the shared dictionary is not modified, so any classes, types or symbols
+	 *  defined while reading a file (such as those loaded from its metadictionary) are held in an overlay instead.
+	 *  Lookups made on a thread search the shared dictionary first and then the overlay active on that thread.
+	 *  \note Partition::ReadMetadata() activates the overlay of the file being read, other code that needs to find 
+	 *         the file's extra definitions should do the same with a DictionaryOverlay::Scope
+	 */
+	class DictionaryOverlay : public RefCount<DictionaryOverlay>
+	{
+	public:
+		// Allow Scope to set the current overlay
+		class Scope;
+		friend class Scope;
+
+		ULHashMap<MDOTypePtr> ClassLookup;		//!< Classes defined in this overlay, both exact and ignoring the version number
+		MDOTypeList Classes;					//!< All classes defined in this overlay
+		ULHashMap<MDTypePtr> TypeLookup;		//!< Types defined in this overlay, both exact and ignoring the version number
+		SymbolSpaceMap SymbolSpaces;			//!< Local symbol spaces, including additions to shared symbol spaces of the same name
+		int Generation;							//!< Incremented each time types or classes are built into this overlay
+
+	protected:
+		//! The overlay active on this thread, or NULL if none
+		static MXFLIB_THREAD_LOCAL DictionaryOverlay *Current;
+
+	public:
+		DictionaryOverlay() : Generation(0) {}
+
+		//! Get the overlay active on this thread, or NULL if none
+		static DictionaryOverlay *GetCurrent(void) { return Current; }
+
+		//! Get the local symbol space with a given name, building it if required
+		SymbolSpacePtr GetSymbolSpace(const std::string &Name);
+
+		//! Make an overlay active on this thread for the lifetime of the Scope object
+		/*! If the overlay is NULL then any currently active overlay remains active
+		 */
+		class Scope
+		{
+		protected:
+			DictionaryOverlay *Previous;		//!< The overlay that was active before this scope, restored on destruction
+
+		private:
+			//! Prevent copy construction by NOT having an implementation to this copy constructor
+			Scope(const Scope &rhs);
+
+		public:
+			//! Activate an overlay
+			Scope(DictionaryOverlay *Overlay) : Previous(Current) { if(Overlay) Current = Overlay; }
+
+			//! Restore the previously active overlay
+			~Scope() { Current = Previous; }
+		};
+	};
+}
+
+
 namespace mxflib
 {
 	//! A parent pointer to an MDObject object (with operator[] overloads)
@@ -646,6 +704,7 @@ namespace mxflib
 		MDObjectPtr operator[](const MDTypePtr &ChildType) const;
 		MDObjectPtr operator[](int Index) const;
 		MDObjectPtr operator[](const UL &ChildType) const;
+		MDObjectPtr operator[](const ULConst &ChildType) const;
 		MDObjectPtr operator[](const ULPtr &ChildType) const;
 	};
 
@@ -1060,6 +1119,12 @@ error("UNSUPPORTED: Trying to determine ref target of %s\n", FullName().c_str())
 		//! Locate a child by UL
 		MDObjectPtr operator[](const UL &ChildType) const;
 
+		//! Locate a child by constant UL, without building a UL to compare with
+		MDObjectPtr Child(const ULConst &ChildType) const { return operator[](ChildType); }
+
+		//! Locate a child by constant UL, without building a UL to compare with
+		MDObjectPtr operator[](const ULConst &ChildType) const;
+
 		//! Locate a child by object type
 		MDObjectPtr Child(const MDOTypePtr &ChildType) const { return operator[](ChildType); }
 
@@ -1096,6 +1161,9 @@ error("UNSUPPORTED: Trying to determine ref target of %s\n", FullName().c_str())
 
 		//! Add a new child MDObject of the specified type
 		MDObjectPtr AddChild(const UL &ChildType, bool Replace = true);
+
+		//! Add a new child MDObject of the specified type, only building a UL if a new child is added
+		MDObjectPtr AddChild(const ULConst &ChildType, bool Replace = true);
 		
 		//! Add a new child MDObject of the specified type
 		MDObjectPtr AddChild(ULPtr &ChildType, bool Replace = true) { return AddChild(*ChildType, Replace); }
@@ -1286,6 +1354,54 @@ error("UNSUPPORTED: Trying to determine ref target of %s\n", FullName().c_str())
 		//! Build a data chunk with all this items data (including child data)
 		DataChunkPtr PutData(PrimerPtr UsePrimer = NULL) const;
 
+		//! Get the raw data of all items in an array or batch of fixed-size items
+		/*! The data held by each item is read directly, rather than through the item's traits.
+		 *  Items may be basic, handled as a whole by their traits (such as ULs), or compounds of these (such as delta entries).
+		 *  \param ItemSize The size of each item in bytes
+		 *  \param ItemData Set to point to the big-endian data of all the items
+		 *  \param Count Set to the number of items
+		 *  \param Buffer Used to gather the data of the items if it is not held by this object as a whole
+		 *  \return true if read, false if this is not an array or batch of fixed-size items of ItemSize bytes
+		 */
+		bool GetArrayData(size_t ItemSize, const UInt8 *&ItemData, size_t &Count, DataChunk &Buffer) const;
+
+		//! Set all items of an array or batch of fixed-size items from raw data
+		/*! Each item is built directly from the data, rather than through the item's traits.
+		 *  \return true if set, false if this is not an array or batch of fixed-size items of ItemSize bytes, or too many items are given for a fixed-size array
+		 */
+		bool SetArrayData(size_t ItemSize, size_t Count, const UInt8 *ItemData);
+
+		//! Get the values of all items in an array or batch of integers, such as slice offsets or track IDs
+		/*! The values are decoded in bulk, rather than calling the traits of each item.
+		 *  \return true if read, false if this is not an array or batch of integers the size of T
+		 */
+		template<class T> bool GetArray(std::vector<T> &Values) const
+		{
+			DataChunk Buffer;
+			const UInt8 *ItemData;
+			size_t Count;
+			if((!HasIntegerItems(sizeof(T))) || (!GetArrayData(sizeof(T), ItemData, Count, Buffer))) return false;
+
+			Values.resize(Count);
+			if(Count) GetArrayItems(&Values[0], ItemData, Count);
+
+			return true;
+		}
+
+		//! Set all items in an array or batch of integers
+		/*! The values are encoded in bulk, rather than calling the traits of each item.
+		 *  \return true if set, false if this is not an array or batch of integers the size of T, or too many items are given for a fixed-size array
+		 */
+		template<class T> bool SetArray(const std::vector<T> &Values)
+		{
+			if(!HasIntegerItems(sizeof(T))) return false;
+
+			DataChunk Buffer(Values.size() * sizeof(T));
+			if(!Values.empty()) PutArrayItems(&Values[0], Buffer.Data, Values.size());
+
+			return SetArrayData(sizeof(T), Values.size(), Buffer.Data);
+		}
+
 
 		/* Misc value getting methods */
 
@@ -1725,6 +1841,9 @@ error("UNSUPPORTED: Trying to determine ref target of %s\n", FullName().c_str())
 		 */
 		MDObjectPtr AddChildInternal(MDObjectPtr ChildObject, bool Replace = false);
 
+		//! Is this an array or batch of basic integer items of ItemSize bytes?
+		bool HasIntegerItems(size_t ItemSize) const;
+
 		//! Write any items strongly linked from sub-items
 		size_t WriteLinkedSubObjects(DataChunkPtr &Buffer, PrimerPtr UsePrimer);
 
@@ -1865,6 +1984,9 @@ error("UNSUPPORTED: Trying to determine ref target of %s\n", FullName().c_str())
 		//! Determine if this object is derived from a specified type (directly or indirectly)
 		bool IsA(const UL &BaseType) const;
 
+		//! Determine if this object is derived from a specified constant UL type (directly or indirectly)
+		bool IsA(const ULConst &BaseType) const;
+
 		//! Determine if this object is derived from a specified type (directly or indirectly)
 		bool IsA(ULPtr &BaseType) const { return IsA(*BaseType); }
 
@@ -2169,6 +2291,12 @@ namespace mxflib
 		//! Locate a child by UL
 		MDObjectPtr operator[](const UL &ChildType) const { return Object->operator[](ChildType); }
 
+		//! Locate a child by constant UL
+		MDObjectPtr Child(const ULConst &ChildType) const { return Object->operator[](ChildType); }
+
+		//! Locate a child by constant UL
+		MDObjectPtr operator[](const ULConst &ChildType) const { return Object->operator[](ChildType); }
+
 		//! Locate a child by object type
 		MDObjectPtr Child(const MDOTypePtr &ChildType) const { return Object->operator[](ChildType); }
 
@@ -2205,6 +2333,9 @@ namespace mxflib
 
 		//! Add a new child MDObject of the specified type
 		MDObjectPtr AddChild(const UL &ChildType, bool Replace = true) { return Object->AddChild(ChildType, Replace); }
+
+		//! Add a new child MDObject of the specified type
+		MDObjectPtr AddChild(const ULConst &ChildType, bool Replace = true) { return Object->AddChild(ChildType, Replace); }
 		
 		//! Add a new child MDObject of the specified type
 		MDObjectPtr AddChild(ULPtr &ChildType, bool Replace = true) { return Object->AddChild(*ChildType, Replace); }
@@ -2328,6 +2459,18 @@ namespace mxflib
 		//! Build a data chunk with all this items data (including child data)
 		DataChunkPtr PutData(PrimerPtr UsePrimer = NULL) const { return Object->PutData(); }
 
+		//! Get the raw data of all items in an array or batch of fixed-size items
+		bool GetArrayData(size_t ItemSize, const UInt8 *&ItemData, size_t &Count, DataChunk &Buffer) const { return Object->GetArrayData(ItemSize, ItemData, Count, Buffer); }
+
+		//! Set all items of an array or batch of fixed-size items from raw data
+		bool SetArrayData(size_t ItemSize, size_t Count, const UInt8 *ItemData) { return Object->SetArrayData(ItemSize, Count, ItemData); }
+
+		//! Get the values of all items in an array or batch of integers
+		template<class T> bool GetArray(std::vector<T> &Values) const { return Object->GetArray(Values); }
+
+		//! Set all items in an array or batch of integers
+		template<class T> bool SetArray(const std::vector<T> &Values) { return Object->SetArray(Values); }
+
 
 		/* Misc value getting methods */
 
@@ -2655,6 +2798,9 @@ namespace mxflib
 		//! Determine if this object is derived from a specified type (directly or indirectly)
 		bool IsA(const UL &BaseType) { return Object->IsA(BaseType); }
 
+		//! Determine if this object is derived from a specified constant UL type (directly or indirectly)
+		bool IsA(const ULConst &BaseType) { return Object->IsA(BaseType); }
+
 		//! Determine if this object is derived from a specified type (directly or indirectly)
 		bool IsA(ULPtr &BaseType) { return Object->IsA(*BaseType); }
 	};
@@ -2682,12 +2828,14 @@ inline MDObjectPtr MDObjectPtr::operator[](const char *ChildName) const { return
 inline MDObjectPtr MDObjectPtr::operator[](const MDOTypePtr &ChildType) const { return GetPtr()->operator[](ChildType); }
 inline MDObjectPtr MDObjectPtr::operator[](const MDTypePtr &ChildType) const { return GetPtr()->operator[](ChildType); }
 inline MDObjectPtr MDObjectPtr::operator[](const UL &ChildType) const { return GetPtr()->operator[](ChildType); }
+inline MDObjectPtr MDObjectPtr::operator[](const ULConst &ChildType) const { return GetPtr()->operator[](ChildType); }
 inline MDObjectPtr MDObjectPtr::operator[](const ULPtr &ChildType) const { return GetPtr()->operator[](ChildType); }
 inline MDObjectPtr MDObjectPtr::operator[](int Index) const { return GetPtr()->operator[](Index); }
 inline MDObjectPtr MDObjectParent::operator[](const char *ChildName) const { return GetPtr()->operator[](ChildName); }
 inline MDObjectPtr MDObjectParent::operator[](const MDOTypePtr &ChildType) const { return GetPtr()->operator[](ChildType); }
 inline MDObjectPtr MDObjectParent::operator[](const MDTypePtr &ChildType) const { return GetPtr()->operator[](ChildType); }
 inline MDObjectPtr MDObjectParent::operator[](const UL &ChildType) const { return GetPtr()->operator[](ChildType); }
+inline MDObjectPtr MDObjectParent::operator[](const ULConst &ChildType) const { return GetPtr()->operator[](ChildType); }
 inline MDObjectPtr MDObjectParent::operator[](const ULPtr &ChildType) const { return GetPtr()->operator[](ChildType); }
 inline MDObjectPtr MDObjectParent::operator[](int Index) const { return GetPtr()->operator[](Index); }
 }
@@ -58,24 +58,21 @@ MDType::TraitsULMapType MDType::TraitsULMap;
 //! Add a given type to the lookups
 void MDType::AddType(MDTypePtr &Type, ULPtr &TypeUL)
 {
-	// Add the name to the name lookup
-	NameLookup[Type->TypeName] = Type;
-
-	// Add the UL to the UL lookup
-	ULLookup[*TypeUL] = Type;
-
-	/* Add a version 1 UL for versionless compares */
-
-	// Only add the version 1 lookup for SMPTE ULs (other labels may have other version rules)
-	if((TypeUL->GetValue()[0] == 0x06) && (TypeUL->GetValue()[1] == 0x0e) && (TypeUL->GetValue()[2] == 0x2b) && (TypeUL->GetValue()[3] == 0x34))
+	// Once the dictionary is frozen new types can only be added to the current overlay
+	if(MDOType::IsFrozen())
 	{
-		// Make a version 1 copy of this UL
-		ULPtr Ver1UL = new UL(TypeUL);
-		Ver1UL->Set(7,1);
+		DictionaryOverlay *Overlay = DictionaryOverlay::GetCurrent();
+		if(Overlay) Overlay->TypeLookup.Set(*TypeUL, Type);
+		else error("Unable to add type %s as the dictionary is frozen and no dictionary overlay is active\n", Type->TypeName.c_str());
 
-		// Insert it into the version 1 lookup
-		ULLookupVer1[*Ver1UL] = Type;
+		return;
 	}
+
+	// Add the name to the name lookup
+	NameLookup[Type->TypeName] = Type;
+
+	// Add the UL to the UL lookup - this also serves versionless compares for SMPTE ULs
+	ULLookup.Set(*TypeUL, Type);
 }
 
 
@@ -377,31 +374,36 @@ MDTypePtr MDType::Find(std::string TypeName, SymbolSpacePtr &SymSpace, bool Sear
  */
 MDTypePtr MDType::Find(const UL& BaseUL)
 {
-	MDTypePtr theType;
-
-	std::map<UL, MDTypePtr>::iterator it = ULLookup.find(BaseUL);
+	// Look for an exact match, or failing that a version-less match for SMPTE ULs
+	const MDTypePtr *theType = ULLookup.FindVersionless(BaseUL);
+	if(theType) return *theType;
 
-	if(it != ULLookup.end())
+	// Try any types defined in the current overlay
+	DictionaryOverlay *Overlay = DictionaryOverlay::GetCurrent();
+	if(Overlay)
 	{
-		theType = (*it).second;
+		theType = Overlay->TypeLookup.FindVersionless(BaseUL);
+		if(theType) return *theType;
 	}
-	else
-	{
-		// If the exact match is not found try a version-less lookup by changing the version number to 1
-		if((BaseUL.GetValue()[0] == 0x06) && (BaseUL.GetValue()[1] == 0x0e) && (BaseUL.GetValue()[2] == 0x2b) && (BaseUL.GetValue()[3] == 0x34))
-		{
-			UL Ver1UL = BaseUL;
-			Ver1UL.Set(7, 1);
 
-			std::map<UL, MDTypePtr>::iterator it2 = ULLookupVer1.find(Ver1UL);
-			if(it2 != ULLookupVer1.end())
-			{
-				theType = (*it2).second;
-			}
-		}
+	// Build the type if it is held by lazy dictionary loading
+	if(mxflib_deftypes::BuildLazyType(BaseUL))
+	{
+		theType = ULLookup.FindVersionless(BaseUL);
+		if(theType) return *theType;
 	}
 
-	return theType;
+	return NULL;
+}
+
+
+//! Determine if a type is part of the frozen dictionary, and so must not be modified
+bool MDType::IsShared(const MDType *Type)
+{
+	if(!MDOType::IsFrozen() || !Type->TypeUL) return false;
+
+	const MDTypePtr *Found = ULLookup.Find(*Type->TypeUL);
+	return Found && ((*Found).GetPtr() == Type);
 }
 
 
@@ -616,6 +618,13 @@ UInt32 MDType::EffectiveSizeInternal(bool OverrideSize /*=false*/, int UseSize /
 	*/
 bool MDType::AddTraitsMapping(std::string TypeName, std::string TraitsName)
 {
+	// DRAGONS: Existing types may be updated, so this is not allowed once the dictionary is frozen
+	if(MDOType::IsFrozen())
+	{
+		error("Unable to map traits %s to type %s as the dictionary is frozen\n", TraitsName.c_str(), TypeName.c_str());
+		return false;
+	}
+
 	MDTraitsPtr Traits;
 	if(!TraitsName.empty()) Traits = MDTraits::Find(TraitsName);
 	if(!Traits) Traits = DefaultTraits;
@@ -662,30 +671,40 @@ bool MDType::AddTraitsMapping(std::string TypeName, std::string TraitsName)
 	*/
 bool MDType::AddTraitsMapping(const UL &TypeUL, std::string TraitsName)
 {
+	// DRAGONS: Existing types may be updated, so this is not allowed once the dictionary is frozen
+	if(MDOType::IsFrozen())
+	{
+		error("Unable to map traits %s to type %s as the dictionary is frozen\n", TraitsName.c_str(), TypeUL.GetString().c_str());
+		return false;
+	}
+
 	MDTraitsPtr Traits;
 	if(!TraitsName.empty()) Traits = MDTraits::Find(TraitsName);
 	if(!Traits) Traits = DefaultTraits;
 
 	TraitsULMap[TypeUL] = Traits;
 
+	const UInt8 *TypeULVal = TypeUL.GetValue();
+
 	/* Apply these traits to any type that will need them */
-	std::map<UL, MDTypePtr>::iterator it = ULLookup.begin();
+	ULHashMap<MDTypePtr>::const_iterator it = ULLookup.begin();
 	while(it != ULLookup.end())
 	{
 		bool UpdateThis = false;
+		MDTypePtr ThisType = it.Value();
 
 		// Exact matches will be updated
-		if((*it).first == TypeUL) UpdateThis = true;
+		if(memcmp(it.Key(), TypeULVal, 16) == 0) UpdateThis = true;
 		else
 		{
 			// If the type is an interpretation type, and its base type matches this type UL...
-			if(((*it).second->Class == INTERPRETATION) && (*(*it).second->EffectiveType()->TypeUL == TypeUL))
+			if((ThisType->Class == INTERPRETATION) && (*ThisType->EffectiveType()->TypeUL == TypeUL))
 			{
 				// ...and it does not have a trait mapping itself, we will update it
-				TraitsULMapType::iterator ULMap_it = TraitsULMap.find((*it).second->TypeUL);
+				TraitsULMapType::iterator ULMap_it = TraitsULMap.find(ThisType->TypeUL);
 				if(ULMap_it == TraitsULMap.end())
 				{
-					TraitsMapType::iterator Map_it = TraitsMap.find((*it).second->Name());
+					TraitsMapType::iterator Map_it = TraitsMap.find(ThisType->Name());
 					if(Map_it == TraitsMap.end()) UpdateThis = true;
 				}
 			}
@@ -693,45 +712,19 @@ bool MDType::AddTraitsMapping(const UL &TypeUL, std::string TraitsName)
 
 		if(UpdateThis)
 		{
-			(*it).second->SetTraits(Traits);
+			ThisType->SetTraits(Traits);
 		}
 
-		it++;
+		++it;
 	}
 
-	/* Apply these traits to any match with a version 1 UL */
-
-	UL Ver1UL(TypeUL);
-	Ver1UL.Set(7,1);
+	/* Apply these traits to the newest type with any version of a SMPTE version 1 UL */
 
-	it = ULLookupVer1.begin();
-	while(it != ULLookupVer1.end())
+	// DRAGONS: Only the type added last is updated, not every version, so older versions keep their own traits
+	if((TypeULVal[0] == 0x06) && (TypeULVal[1] == 0x0e) && (TypeULVal[2] == 0x2b) && (TypeULVal[3] == 0x34) && (TypeULVal[7] == 1))
 	{
-		bool UpdateThis = false;
-
-		// Exact matches will be updated
-		if((*it).first == TypeUL) UpdateThis = true;
-		else
-		{
-			// If the type is an interpretation type, and its base type matches this type UL...
-			if(((*it).second->Class == INTERPRETATION) && (*(*it).second->EffectiveType()->TypeUL == TypeUL))
-			{
-				// ...and it does not have a trait mapping itself, we will update it
-				TraitsULMapType::iterator ULMap_it = TraitsULMap.find((*it).second->TypeUL);
-				if(ULMap_it == TraitsULMap.end())
-				{
-					TraitsMapType::iterator Map_it = TraitsMap.find((*it).second->Name());
-					if(Map_it == TraitsMap.end()) UpdateThis = true;
-				}
-			}
-		}
-
-		if(UpdateThis)
-		{
-			(*it).second->SetTraits(Traits);
-		}
-
-		it++;
+		MDTypePtr *Newest = ULLookup.FindNewestVersion(TypeULVal);
+		if(Newest) (*Newest)->SetTraits(Traits);
 	}
 
 	return true;
@@ -867,11 +860,8 @@ MDTraitsPtr MDType::LookupTraitsMapping(const UL &TypeUL, std::string DefaultTra
 
 MDTypeList MDType::Types;	//!< All types managed by the MDType class
 
-//! Map for UL lookups
-std::map<UL, MDTypePtr> MDType::ULLookup;
-
-//! Map for UL lookups - ignoring the version number (all entries use version = 1)
-std::map<UL, MDTypePtr> MDType::ULLookupVer1;
+//! Hash table for UL lookups, both exact and ignoring the version number
+ULHashMap<MDTypePtr> MDType::ULLookup;
 
 //! Map for reverse lookups based on type name
 MDTypeMap MDType::NameLookup;
@@ -294,6 +294,9 @@ namespace mxflib
 		//! Find a type by ULPtr
 		static MDTypePtr Find(ULPtr &BaseUL) { return Find(*BaseUL); }
 
+		//! Determine if a type is part of the frozen dictionary, and so must not be modified
+		static bool IsShared(const MDType *Type);
+
 
 		/* Interface IMDTypeSet */
 		/************************/
@@ -479,11 +482,8 @@ namespace mxflib
 	protected:
 		static MDTypeList Types;		//!< All types managed by this object
 
-		//! Map for UL lookups
-		static std::map<UL, MDTypePtr> ULLookup;
-		
-		//! Map for UL lookups - ignoring the version number (all entries use version = 1)
-		static std::map<UL, MDTypePtr> ULLookupVer1;
+		//! Hash table for UL lookups, both exact and ignoring the version number
+		static ULHashMap<MDTypePtr> ULLookup;
 
 		//! Map for reverse lookups based on type name
 		static MDTypeMap NameLookup;
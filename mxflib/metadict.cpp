@@ -378,6 +378,130 @@ namespace
 }
 
 
+namespace
+{
+	//! Get the 64-bit FNV-1a hash of a block of bytes
+	UInt64 HashBytes(const UInt8 *Data, size_t Size)
+	{
+		UInt64 Hash = UINT64_C(0xcbf29ce484222325);
+		while(Size--)
+		{
+			Hash ^= *(Data++);
+			Hash *= UINT64_C(0x100000001b3);
+		}
+
+		return Hash;
+	}
+
+
+	//! Append a count to a canonical metadictionary serialization
+	void AppendCount(DataChunk &Buffer, size_t Count)
+	{
+		UInt8 Temp[4];
+		PutU32(static_cast<UInt32>(Count), Temp);
+		Buffer.Append(4, Temp);
+	}
+
+
+	//! Append the content of a metadictionary object, and of all objects that it strongly references, to a canonical serialization
+	/*! Instance and extension scheme identifiers are not included, as these differ between otherwise identical metadictionaries.
+	 *  Weak references are included as the identification of the definition they reference.
+	 *  Each value and each list of children is preceded by its size, so different trees cannot give the same bytes.
+	 */
+	void SerializeMetadictObject(DataChunk &Buffer, const MDObject *Object)
+	{
+		const ULPtr &ObjectUL = Object->GetUL();
+		if(ObjectUL)
+		{
+			if((*ObjectUL == InstanceUID_UL) || (*ObjectUL == ExtensionSchemeID_UL) || (*ObjectUL == SymbolSpaceURI_UL)) return;
+
+			Buffer.Append(ObjectUL->Size(), ObjectUL->GetValue());
+		}
+		else
+		{
+			UInt8 NoUL[16];
+			memset(NoUL, 0, 16);
+			Buffer.Append(16, NoUL);
+		}
+
+		MDObjectPtr TargetID;
+		MDObjectParent Target = Object->GetRef();
+		if(Target)
+		{
+			if(Object->GetRefType() == TypeRefStrong)
+			{
+				SerializeMetadictObject(Buffer, Target);
+				return;
+			}
+
+			TargetID = Target->Child(MetaDefinitionIdentification_UL);
+			if(TargetID) Object = TargetID;
+		}
+
+		if(Object->IsAValue())
+		{
+			DataChunkPtr Data = Object->PutData();
+			if(Data)
+			{
+				AppendCount(Buffer, Data->Size);
+				Buffer.Append(*Data);
+			}
+			else AppendCount(Buffer, 0);
+		}
+		else
+		{
+			AppendCount(Buffer, Object->size());
+
+			MDObject::const_iterator it = Object->begin();
+			while(it != Object->end())
+			{
+				SerializeMetadictObject(Buffer, (*it).second);
+				it++;
+			}
+		}
+	}
+
+
+	//! Maximum number of loaded metadictionaries remembered by LoadMetadictionary()
+	/*! The least recently used is forgotten when this is exceeded, so that reading many files with differing metadictionaries does not grow the cache */
+	const size_t LoadedMetadictLimit = 16;
+
+	//! List of the content hashes of loaded metadictionaries, most recently used first
+	typedef std::list<UInt64> LoadedMetadictOrder;
+
+	//! A metadictionary that has been loaded by LoadMetadictionary()
+	struct LoadedMetadict
+	{
+		DataChunkPtr Content;						//!< The canonical serialization of the metadictionary, compared on each hit as the hash alone may collide
+		ULPtr ClassUL;								//!< The UL of the first class loaded from it, used to check that it is still loaded
+		ULPtr TypeUL;								//!< The UL of the first type loaded from it, used to check that it is still loaded
+		std::map<std::string, ULPtr> Symbols;		//!< The names its definitions added to the symbol space, added again to the symbol space of each later copy
+		LoadedMetadictOrder::iterator Order;		//!< The position of this entry in LoadedOrder
+	};
+
+	//! Map of successfully loaded metadictionaries, by the hash of their content
+	typedef std::map<UInt64, LoadedMetadict> LoadedMetadictMap;
+
+	//! Metadictionaries already loaded, so that files carrying the same metadictionary (such as those written by the same application) can skip loading it
+	LoadedMetadictMap LoadedMetadicts;
+
+	//! The hashes of the entries in LoadedMetadicts, most recently used first
+	LoadedMetadictOrder LoadedOrder;
+
+	//! Mutex protecting LoadedMetadicts and LoadedOrder, as several threads may each be reading the metadictionary of a file
+	Mutex LoadedMetadictMutex;
+
+
+	//! Forget a loaded metadictionary
+	/*! \note LoadedMetadictMutex must be locked by the caller */
+	void ForgetLoadedMetadict(LoadedMetadictMap::iterator it)
+	{
+		LoadedOrder.erase((*it).second.Order);
+		LoadedMetadicts.erase(it);
+	}
+}
+
+
 //! Load classes and types from a Metadictionary object
 /*! At the point where this function is called, you need to have all the component parts loaded and
  *  all the strong references within the metadictionary need to be satisfied
@@ -389,6 +513,57 @@ bool mxflib::LoadMetadictionary(MDObjectPtr &Meta, SymbolSpacePtr &SymSpace)
 	// Is this a KLV Encoded Extension Syntax extension rather than a Metadictionary?
 	bool KXSMetadict = Meta->IsA(ExtensionScheme_UL);
 
+	/* Skip loading if the same metadictionary has already been loaded, and its definitions are still known
+	 * DRAGONS: Once the dictionary is frozen each file's definitions are held in its own overlay, so all are loaded
+	 * DRAGONS: Each file has its own symbol space, so the names added by the first load are added to this file's symbol space
+	 */
+	DataChunkPtr Content;
+	UInt64 ContentHash = 0;
+	bool UseCache = !MDOType::IsFrozen();
+	if(UseCache)
+	{
+		Content = new DataChunk;
+		SerializeMetadictObject(*Content, Meta);
+		ContentHash = HashBytes(Content->Data, Content->Size);
+
+		LoadedMetadictMutex.Lock();
+
+		LoadedMetadictMap::iterator it = LoadedMetadicts.find(ContentHash);
+		if(it != LoadedMetadicts.end())
+		{
+			// Only a hit if the content really is the same, and the dictionary has not been cleared since it was loaded
+			if(   (*(*it).second.Content == *Content)
+			   && ((!(*it).second.ClassUL) || MDOType::Find(*(*it).second.ClassUL))
+			   && ((!(*it).second.TypeUL) || MDType::Find(*(*it).second.TypeUL)))
+			{
+				std::map<std::string, ULPtr>::iterator Sym_it = (*it).second.Symbols.begin();
+				while(Sym_it != (*it).second.Symbols.end())
+				{
+					SymSpace->AddSymbol((*Sym_it).first, (*Sym_it).second);
+					Sym_it++;
+				}
+
+				// Move to the front of the list of most recently used
+				LoadedOrder.splice(LoadedOrder.begin(), LoadedOrder, (*it).second.Order);
+
+				LoadedMetadictMutex.Unlock();
+				return true;
+			}
+
+			ForgetLoadedMetadict(it);
+		}
+
+		LoadedMetadictMutex.Unlock();
+	}
+
+	//! Record of this load, used to skip loading the same metadictionary again
+	LoadedMetadict ThisLoad;
+	ThisLoad.Content = Content;
+
+	//! The names already in the symbol space, so that those added by this load can be recorded
+	std::map<std::string, ULPtr> OldSymbols;
+	if(UseCache) OldSymbols = *SymSpace;
+
 	/* First we load any types */
 	MDObjectPtr TypeDefList;
 
@@ -425,8 +600,10 @@ bool mxflib::LoadMetadictionary(MDObjectPtr &Meta, SymbolSpacePtr &SymSpace)
 			it++;
 		}
 
+		if(!TypeList.empty()) ThisLoad.TypeUL = TypeList.front()->UL;
+
 		// Load the types and update the running status
-		if(!LoadTypes(TypeList, SymSpace)) Ret = false;
+		if(LoadTypes(TypeList, SymSpace) != 0) Ret = false;
 	}
 
 
@@ -598,8 +775,35 @@ bool mxflib::LoadMetadictionary(MDObjectPtr &Meta, SymbolSpacePtr &SymSpace)
 			it++;
 		}
 
+		if(!ClassList.empty()) ThisLoad.ClassUL = ClassList.front()->UL;
+
 		// Load the classes and update the running status
-		if(!LoadClasses(ClassList, SymSpace)) Ret = false;
+		if(LoadClasses(ClassList, SymSpace) != 0) Ret = false;
+	}
+
+	// Only a successful load is skipped next time, so that any errors are reported for each file
+	if(UseCache && Ret)
+	{
+		SymbolSpace::iterator it = SymSpace->begin();
+		while(it != SymSpace->end())
+		{
+			if(OldSymbols.find((*it).first) == OldSymbols.end()) ThisLoad.Symbols.insert(*it);
+			it++;
+		}
+
+		LoadedMetadictMutex.Lock();
+
+		// Replace any entry with the same hash, keeping the order list in step with the map
+		LoadedMetadictMap::iterator Old_it = LoadedMetadicts.find(ContentHash);
+		if(Old_it != LoadedMetadicts.end()) ForgetLoadedMetadict(Old_it);
+
+		ThisLoad.Order = LoadedOrder.insert(LoadedOrder.begin(), ContentHash);
+		LoadedMetadicts[ContentHash] = ThisLoad;
+
+		// Forget the least recently used if there are now too many
+		if(LoadedOrder.size() > LoadedMetadictLimit) ForgetLoadedMetadict(LoadedMetadicts.find(LoadedOrder.back()));
+
+		LoadedMetadictMutex.Unlock();
 	}
 
 	return Ret;
@@ -663,7 +867,7 @@ namespace
 
 	//! List of classes that are required for the metadictionary - used to add these to the metadictionary which has not got them otherwise!
 	//  DRAGONS: It is vitally important that this list remains in step with the bit values defined below that index the entries
-	UL const *MetadictClasses[] = 
+	ULConst const *MetadictClasses[] = 
 	{
 		&DataDefinition_UL,								// 0x00000001
 		&ContainerDefinition_UL,						// 0x00000002
@@ -891,7 +1095,7 @@ namespace
 			while(DefineMetadictClasses != 0)
 			{
 				int Mask = 1;
-				UL const **pClassUL = MetadictClasses;
+				ULConst const **pClassUL = MetadictClasses;
 				while(*pClassUL)
 				{
 					if(DefineMetadictClasses & Mask) 
@@ -2111,11 +2315,43 @@ namespace
 
 
 
+namespace
+{
+	//! Add the ULs of all entries in a map by UL to a metadictionary cache key
+	template<class MapType> void AddULsToKey(std::string &Key, const MapType &Map)
+	{
+		Key += UInt2String(static_cast<int>(Map.size())) + ":";
+
+		typename MapType::const_iterator it = Map.begin();
+		while(it != Map.end())
+		{
+			Key.append(reinterpret_cast<const char *>((*it).first.GetValue()), (*it).first.Size());
+			it++;
+		}
+	}
+
+	//! Build the key used to cache a metadictionary defining the items listed in a given MetaDictInfo
+	std::string BuildMetadictKey(MetaDictInfo &Info)
+	{
+		// The kind of metadictionary being built
+		std::string Ret = Feature(FeatureKXSMetadict) ? "K" : "M";
+		Ret += Feature(FeatureUsedMetadict) ? "U" : "S";
+
+		AddULsToKey(Ret, Info.Classes);
+		AddULsToKey(Ret, Info.Properties);
+		AddULsToKey(Ret, Info.TypeMap);
+
+		return Ret;
+	}
+}
+
+
 //! Build a metadictionary from current classes and types used in a given list of metadata trees
 /*! If Meta is supplied, then all classes in the trees strongly linked from it are written to the metadictionary, 
  *  including all properties of those classes (whether used or not) and any types used by those properties
+ *  \param LastBuilt If not NULL, the metadictionary last built for the same file, returned again if it still matches
  */
-MDObjectPtr mxflib::BuildMetadictionary(MDObjectList &MetaList, Primer *UsePrimer)
+MDObjectPtr mxflib::BuildMetadictionary(MDObjectList &MetaList, Primer *UsePrimer, BuiltMetadictPtr *LastBuilt /*=NULL*/)
 {
 	// Build an info structure to keep track of the process of building the metadictionary
 	MetaDictInfo Info(MetaList, UsePrimer);
@@ -2126,6 +2362,20 @@ MDObjectPtr mxflib::BuildMetadictionary(MDObjectList &MetaList, Primer *UsePrime
 	// Did we fail to find anything to build?
 	if(Info.Classes.empty() && Info.Properties.empty() && Info.TypeMap.empty()) return NULL;
 
+	/* Reuse the metadictionary last built for this file if it was built for the same classes, properties and types,
+	 * and the dictionary has not changed since
+	 */
+	std::string CacheKey;
+	if(LastBuilt)
+	{
+		CacheKey = BuildMetadictKey(Info);
+
+		if(*LastBuilt && ((*LastBuilt)->Key == CacheKey) && ((*LastBuilt)->Generation == GetDictionaryGeneration()))
+		{
+			return (*LastBuilt)->MetaDict;
+		}
+	}
+
 	// Build the container object
 	if(Feature(FeatureKXSMetadict))
 	{
@@ -2166,6 +2416,15 @@ MDObjectPtr mxflib::BuildMetadictionary(MDObjectList &MetaList, Primer *UsePrime
 		return NULL;
 	}
 
+	// Hold this metadictionary for reuse by later headers of the same file
+	if(LastBuilt)
+	{
+		*LastBuilt = new BuiltMetadict;
+		(*LastBuilt)->Key = CacheKey;
+		(*LastBuilt)->MetaDict = Info.MetaDict;
+		(*LastBuilt)->Generation = GetDictionaryGeneration();
+	}
+
 	return Info.MetaDict;
 }
 
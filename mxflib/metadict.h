@@ -40,14 +40,31 @@ namespace mxflib
 	//! Load classes and types from a Metadictionary object
 	/*! At the point where this function is called, you need to have all the component parts loaded and
 	 *  all the strong references within the metadictionary need to be satisfied
+	 *  \note A metadictionary with the same content as one already loaded is not loaded again, unless the dictionary is frozen,
+	 *        but the names of its definitions are still added to SymSpace
 	 */
 	bool LoadMetadictionary(MDObjectPtr &Meta, SymbolSpacePtr &SymSpace);
 
+	//! A metadictionary built by BuildMetadictionary() for one file, held so that later headers of that file can reuse it
+	class BuiltMetadict : public RefCount<BuiltMetadict>
+	{
+	public:
+		BuiltMetadict() : Generation(0) {};
+
+		std::string Key;							//!< Key made from the classes, properties and types that it defines
+		int Generation;								//!< The dictionary generation when it was built
+		MDObjectPtr MetaDict;						//!< The metadictionary that was built
+	};
+
 	//! Build a metadictionary from current classes and types used in a given list of metadata trees
 	/*! If Meta is supplied, then all classes in the trees strongly linked from it are written to the metadictionary, 
 	 *  including all properties of those classes (whether used or not) and any types used by those properties
+	 *  \param LastBuilt If not NULL, the metadictionary last built for the same file. This is returned again if it defines
+	 *                   the same classes, properties and types and the dictionary has not changed since, otherwise it is
+	 *                   replaced by the newly built metadictionary
+	 *  DRAGONS: Only pass LastBuilt for rewrites of the same file, as the returned object keeps its InstanceUIDs
 	 */
-	MDObjectPtr BuildMetadictionary(MDObjectList &MetaList, Primer *UsePrimer);
+	MDObjectPtr BuildMetadictionary(MDObjectList &MetaList, Primer *UsePrimer, BuiltMetadictPtr *LastBuilt = NULL);
 }
 
 #endif // MXFLIB__METADICT_H
@@ -52,6 +52,9 @@ bool mxflib::MXFFile::Open(std::string FileName, bool ReadOnly /* = false */ )
 	// Record the name
 	Name = FileName;
 
+	// Record the access mode
+	isReadOnly = ReadOnly;
+
 	if(ReadOnly)
 	{
 		Handle = FileOpenRead(FileName.c_str());
@@ -63,6 +66,16 @@ bool mxflib::MXFFile::Open(std::string FileName, bool ReadOnly /* = false */ )
 
 	if(!FileValid(Handle)) return false;
 
+	HasReadAtHandle = false;
+#ifndef MXFLIB_NO_FILE_IO
+	// Read-only files are read at given positions through their own handle so the file pointer is never moved
+	if(isReadOnly)
+	{
+		PositionalHandle = FileOpenReadAt(Handle);
+		HasReadAtHandle = FileReadAtValid(PositionalHandle);
+	}
+#endif // MXFLIB_NO_FILE_IO
+
 	isOpen = true;
 
 	return ReadRunIn();
@@ -77,6 +90,8 @@ bool mxflib::MXFFile::OpenNew(std::string FileName)
 	// Set to be a normal file
 	isMemoryFile = false;
 	isHandleFile = false;
+	isReadOnly = false;
+	HasReadAtHandle = false;
 
 	// Record the name
 	Name = FileName;
@@ -101,6 +116,8 @@ bool mxflib::MXFFile::OpenMemory(DataChunkPtr Buff /*=NULL*/, Position Offset /*
 	// Set to be a memory file
 	isMemoryFile = true;
 	isHandleFile = false;
+	isReadOnly = false;
+	HasReadAtHandle = false;
 	Name = "Memory File";
 
 	// No run-in currently allowed on memory files
@@ -130,8 +147,11 @@ bool mxflib::MXFFile::OpenFromHandle(FileHandle Handle)
 	if(isOpen) Close();
 
 	// Set to be a normal file, but with external handle management
+	// DRAGONS: We don't know how the handle was opened, so treat it as writable
 	isMemoryFile = false;
 	isHandleFile = true;
+	isReadOnly = false;
+	HasReadAtHandle = false;
 
 	// Record the name
 	Name = "Existing Open File";
@@ -212,11 +232,19 @@ bool mxflib::MXFFile::Close(void)
 		}
 		else
 		{
+#ifndef MXFLIB_NO_FILE_IO
+			if(HasReadAtHandle) FileCloseReadAt(PositionalHandle);
+#endif // MXFLIB_NO_FILE_IO
 			if(!isHandleFile) FileClose(Handle);
 		}
 	}
 
 	isOpen = false;
+	isReadOnly = false;
+	HasReadAtHandle = false;
+
+	// Any metadictionary built for this file must not be reused for the next file opened with this object
+	LastMetadict = NULL;
 
 	return true;
 }
@@ -282,6 +310,61 @@ size_t mxflib::MXFFile::Read(UInt8 *Buffer, size_t Size)
 }
 
 
+//! Read data from a given position in the file into a DataChunk, without using or moving the file pointer
+/*! \note Files opened with Open(FileName, true) are read with positional I/O, so several threads may
+ *        call ReadAt() on the same file at once. Other files fall back to Seek() and Read(), restoring the
+ *        file pointer afterwards, so reads do see data written but not yet flushed. These must only be used
+ *        by one thread at a time, including any other use of the file pointer
+ */
+DataChunkPtr mxflib::MXFFile::ReadAt(Position Pos, size_t Size)
+{
+	DataChunkPtr Ret = new DataChunk(Size);
+
+	size_t Bytes = ReadAt(Pos, Ret->Data, Size);
+	if(Bytes != Size) Ret->Resize(Bytes);
+
+	return Ret;
+}
+
+
+//! Read data from a given position in the file into a supplied buffer, without using or moving the file pointer
+/*! \return The number of bytes read
+ */
+size_t mxflib::MXFFile::ReadAt(Position Pos, UInt8 *Buffer, size_t Size)
+{
+	if((!isOpen) || (Size == 0)) return 0;
+
+	size_t Ret;
+	if(isMemoryFile)
+	{
+		Ret = MemoryReadAt(Pos + RunInSize, Buffer, Size);
+	}
+#ifndef MXFLIB_NO_FILE_IO
+	else if(HasReadAtHandle)
+	{
+		Ret = FileReadAt(PositionalHandle, Pos + RunInSize, Buffer, Size);
+	}
+#endif // MXFLIB_NO_FILE_IO
+	else
+	{
+		// DRAGONS: The file pointer is put back so that callers see no difference from positional reads
+		Position OldPos = Tell();
+		Seek(Pos);
+		Ret = FileRead(Handle, Buffer, Size);
+		Seek(OldPos);
+	}
+
+	// Handle errors
+	if(Ret == static_cast<size_t>(-1))
+	{
+		error("Error reading file \"%s\" at 0x%s - %s\n", Name.c_str(), Int64toHexString(Pos, 8).c_str(), strerror(errno));
+		Ret = 0;
+	}
+
+	return Ret;
+}
+
+
 //! Get a RIP for the open MXF
 /*! The RIP is read using ReadRIP() if possible.
  *  Otherwise it is Scanned using ScanRIP().
@@ -758,30 +841,20 @@ bool mxflib::MXFFile::BuildRIP(void)
 		}
 
 		// Now scan until the next partition
-		ULPtr Key;
+		KLInfo KL;
 		for(;;)
 		{
 			Location = Tell();
-			Key = ReadKey();
-			if(!Key) break;
-
-			// Identify what we have found
-			MDOTypePtr ThisType = MDOType::Find(Key);
+			ReadKL(KL);
+			if(KL.KLSize < 16) break;
 
-			// Only check for this being a partition pack if we know the type
-			if(ThisType)
-			{
-				if(ThisType->Base)
-				{
-					if(ThisType->IsA(PartitionMetadata_UL))
-					{
-						break;
-					}
-				}
-			}
+			// Stop if we have found a partition pack
+			// DRAGONS: The key bytes are tested directly as a dictionary lookup of every essence key would be slow,
+			//          and with a lazy dictionary may not find partition classes that have not yet been built
+			if(IsPartitionKey(KL.Key)) break;
 
-			Skip = ReadBER();
-			Position NextPos = Tell() + Skip;
+			Skip = KL.ValueLength;
+			Position NextPos = KL.ValueStart() + Skip;
 
 			// Test for badly damaged file - have we ended up in a sequence of zeros?
 			if(Skip == 0)
@@ -814,7 +887,7 @@ bool mxflib::MXFFile::BuildRIP(void)
 		}
 
 		// Check if we found anything
-		if(!Key) break;
+		if(KL.KLSize < 16) break;
 		if(Eof()) break;
 
 		// By this point we have found a partition pack
@@ -834,26 +907,26 @@ bool mxflib::MXFFile::BuildRIP(void)
  */
 Length mxflib::MXFFile::ReadBER(void)
 {
-	DataChunkPtr Len = Read(1);
-	if(Len->Size < 1)
+	// DRAGONS: Read into a local buffer rather than a DataChunk as this is called for every KLV
+	UInt8 Buffer[127];
+	if(Read(Buffer, 1) < 1)
 	{
 		error("Incomplete BER length in file \"%s\" at 0x%s\n", Name.c_str(), Int64toHexString(Tell(),8).c_str());
 		return -1;
 	}
 
-	Length Ret = Len->Data[0];
+	Length Ret = Buffer[0];
 	if(Ret >= 0x80)
 	{
 		UInt32 i = (UInt32)Ret & 0x7f;
-		Len = Read(i);
-		if(Len->Size != i)
+		if(Read(Buffer, i) != i)
 		{
 			error("Incomplete BER length in file \"%s\" at 0x%s\n", Name.c_str(), Int64toHexString(Tell(),8).c_str());
 			return -1;
 		}
 
 		Ret = 0;
-		UInt8 *p = Len->Data;
+		UInt8 *p = Buffer;
 		while(i--) Ret = ((Ret<<8) + *(p++));
 	}
 
@@ -861,16 +934,49 @@ Length mxflib::MXFFile::ReadBER(void)
 }
 
 
+//! Read the key and length of the KLV at a given position, without using or moving the file pointer
+/*! No heap allocations are made and no errors are reported, so this is suitable for scanning a file
+ *  \return true if a complete key and valid length were read, otherwise false with Info.ValueLength set to -1
+ */
+bool mxflib::MXFFile::ReadKL(Position Pos, KLInfo &Info)
+{
+	// Read the key and the longest BER length that MXF permits in one go
+	UInt8 Buffer[MaxKLSize];
+	size_t Bytes = ReadAt(Pos, Buffer, sizeof(Buffer));
+
+	Info.Offset = Pos;
+	Info.ValueLength = -1;
+
+	if(Bytes < 16)
+	{
+		Info.KLSize = 0;
+		return false;
+	}
+
+	memcpy(Info.Key, Buffer, 16);
+	Info.KLSize = 16;
+
+	const UInt8 *p = &Buffer[16];
+	Length Len = mxflib::ReadBER(&p, static_cast<int>(Bytes - 16));
+	if(Len < 0) return false;
+
+	Info.ValueLength = Len;
+	Info.KLSize = static_cast<UInt32>(p - Buffer);
+
+	return true;
+}
+
+
 //! Read a Key length from the open file
 ULPtr mxflib::MXFFile::ReadKey(void)
 {
 	ULPtr Ret;
 
 //	UInt64 Location = Tell();
-	DataChunkPtr Key = Read(16);
+	UInt8 Key[16];
 
 	// If we couldn't read 16-bytes then bug out (this may be valid)
-	if(Key->Size != 16) return Ret;
+	if(Read(Key, 16) != 16) return Ret;
 
 /*
 	// Sanity check the keys
@@ -881,12 +987,45 @@ ULPtr mxflib::MXFFile::ReadKey(void)
 	}
 */
 	// Build the UL
-	Ret = new UL(Key->Data);
+	Ret = InternKey(Key);
 
 	return Ret;
 }
 
 
+namespace
+{
+	//! Maximum number of unknown keys held in the key pool of each file
+	/*! Beyond this, unknown keys are allocated individually so that a file full of random keys does not grow the pool */
+	const size_t KeyPoolLimit = 1024;
+}
+
+
+//! Get a shared UL for a key read from this file
+/*! Keys that exactly match a dictionary type share that type's UL, other keys share a UL held in a small per-file pool,
+ *  so repeated keys (such as essence element keys) do not need a new UL allocated each time they are read
+ *  \note The returned UL may be shared and so must not be modified
+ */
+ULPtr mxflib::MXFFile::InternKey(const UInt8 *Key)
+{
+	ULPtr Ret = MDOType::InternUL(Key);
+	if(Ret) return Ret;
+
+	KeyPoolMutex.Lock();
+
+	const ULPtr *Pooled = KeyPool.Find(Key);
+	if(Pooled) Ret = *Pooled;
+	else
+	{
+		Ret = new UL(Key);
+		if(KeyPool.size() < KeyPoolLimit) KeyPool.Insert(Key, Ret);
+	}
+
+	KeyPoolMutex.Unlock();
+
+	return Ret;
+}
+
 
 //! Write a partition pack to the file
 /*! The property "ThisPartition" is updated to reflect the correct location in the file
@@ -1030,7 +1169,7 @@ namespace
 
 	//! Write a metadictionary, or KXS extensions, for a given partition, into a buffer
 	// FIXME: Need to prevent adding a metadictionary to a file that has a metadictionary!
-	void WriteMetadict(DataChunkPtr &Buffer, PartitionPtr &ThisPartition, PrimerPtr &UsePrimer)
+	void WriteMetadict(DataChunkPtr &Buffer, PartitionPtr &ThisPartition, PrimerPtr &UsePrimer, BuiltMetadictPtr &LastMetadict)
 	{
 
 		if(Feature(FeatureFullMetadict))
@@ -1039,7 +1178,7 @@ namespace
 		}
 
 		// Build the metadictionary
-		MDObjectPtr MetaDict = BuildMetadictionary(ThisPartition->AllMetadata, UsePrimer);
+		MDObjectPtr MetaDict = BuildMetadictionary(ThisPartition->AllMetadata, UsePrimer, &LastMetadict);
 
 		// Return if the build failed
 		if(!MetaDict) return;
@@ -1156,7 +1295,7 @@ bool MXFFile::WritePartitionInternal(bool ReWrite, PartitionPtr ThisPartition, b
 	bool WritePreface = true;
 	if(IncludeMetadata && Feature(FeatureSaveMetadict))
 	{
-		WriteMetadict(MetadataBuffer, ThisPartition, ThisPrimer);
+		WriteMetadict(MetadataBuffer, ThisPartition, ThisPrimer, LastMetadict);
 		
 		// Disable writing of the preface set below if we wrote a metadictionary
 		if(MetadataBuffer->Size != 0) WritePreface = false;
@@ -1201,7 +1340,14 @@ bool MXFFile::WritePartitionInternal(bool ReWrite, PartitionPtr ThisPartition, b
 
 			if(SrcPtr)
 			{
-				DstPtr->SetValue(SrcPtr);
+				// Copy the labels as raw data if we can, rather than through the traits of each
+				DataChunk Buffer;
+				const UInt8 *ItemData;
+				size_t Count;
+				if(!(SrcPtr->GetArrayData(16, ItemData, Count, Buffer) && DstPtr->SetArrayData(16, Count, ItemData)))
+				{
+					DstPtr->SetValue(SrcPtr);
+				}
 			}
 		}
 	}
@@ -1632,6 +1778,58 @@ size_t MXFFile::MemoryRead(UInt8 *Data, size_t Size)
 
 
 
+//! Read a partition pack from a given position in the file, without using or moving the file pointer
+/*! \return NULL if no partition pack could be read
+ */
+PartitionPtr MXFFile::ReadPartitionAt(Position Pos)
+{
+	PartitionPtr Ret;
+
+	KLVObjectPtr Pack = new KLVObject();
+	Pack->SetSource(this, Pos);
+
+	// If we couldn't read the key then bug out
+	Int32 KLSize = Pack->ReadKL();
+	if(KLSize < 17) return Ret;
+
+	// Build the object (it may come back as an "unknown")
+	Ret = new Partition(Pack->GetUL());
+
+	Length Len = Pack->GetLength();
+	if(Len > 0)
+	{
+		// Read the actual data
+		size_t Bytes = Pack->ReadData();
+
+		if(static_cast<Length>(Bytes) != Len)
+		{
+			error("Not enough data in file for object %s at 0x%s\n", Ret->Name().c_str(), Int64toHexString(Pos,8).c_str());
+		}
+
+		MXFFilePtr This = this;
+		Ret->SetParent(This, Pos, KLSize);
+		Ret->ReadValue(Pack->GetData().Data, Pack->GetData().Size);
+	}
+
+	return Ret;
+}
+
+
+//! Read from a given position in a memory file buffer without moving the current position
+/*! \note The default version uses MemoryRead(), so any overridden read behaviour also applies to ReadAt() */
+size_t MXFFile::MemoryReadAt(Position Pos, UInt8 *Data, size_t Size)
+{
+	UInt64 OldPos = BufferCurrentPos;
+
+	BufferCurrentPos = Pos;
+	size_t Ret = MemoryRead(Data, Size);
+
+	BufferCurrentPos = OldPos;
+
+	return Ret;
+}
+
+
 //! Read a KLVObject from the file
 KLVObjectPtr MXFFile::ReadKLV(void)
 {
@@ -1641,7 +1839,11 @@ KLVObjectPtr MXFFile::ReadKLV(void)
 	Ret->SetSource(this);
 
 	// Read the key and length - returning NULL if no more valid KLVs
-	if(Ret->ReadKL() < 17) return NULL;
+	Int32 KLSize = Ret->ReadKL();
+	if(KLSize < 17) return NULL;
+
+	// Leave the file pointer at the start of the value, as the caller may read on from here
+	Seek(Ret->GetLocation() + KLSize);
 
 	return Ret;
 }
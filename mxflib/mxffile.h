@@ -46,6 +46,24 @@ namespace mxflib
 
 namespace mxflib
 {
+	//! Number of bytes needed to hold a key and the longest BER length permitted in MXF, read in one go when decoding a KL
+	const size_t MaxKLSize = 16 + 9;
+
+	//! The key and length of a KLV, as decoded by MXFFile::ReadKL() without any heap allocation
+	struct KLInfo
+	{
+		UInt8 Key[16];					//!< The key (only valid if KLSize is at least 16)
+		Length ValueLength;				//!< Length of the value, or -1 if the length could not be read or is not valid
+		UInt32 KLSize;					//!< Number of bytes in the key and length, 0 if the key could not be read or 16 if the length could not be read
+		Position Offset;				//!< Position of the start of the key in the file
+
+		//! Position of the start of the value
+		Position ValueStart(void) const { return Offset + KLSize; }
+
+		//! Position of the first byte after the value
+		Position End(void) const { return Offset + KLSize + ValueLength; }
+	};
+
 	//! Holds data relating to an MXF file
 	class MXFFile : public RefCount<MXFFile>
 	{
@@ -53,9 +71,14 @@ namespace mxflib
 		bool isOpen;					//!< True when the file is open
 		bool isMemoryFile;				//!< True is the file is a "memory file"
 		bool isHandleFile;				//!< True if the file handle is managed externally (we don't open or close it ourselves)
+		bool isReadOnly;				//!< True if the file was opened read-only
+		bool HasReadAtHandle;			//!< True if PositionalHandle is open for ReadAt() (only for read-only files, as positional reads could miss buffered writes)
 		bool TruncatedKnown;			//!< True if the state of "Truncated" has been determined
 		bool Truncated;					//!< True if we have determined that this file has been truncated
 		FileHandle Handle;				//!< File handle
+#ifndef MXFLIB_NO_FILE_IO
+		ReadAtHandle PositionalHandle;	//!< Handle used by ReadAt() for read-only files, which may be the same as Handle
+#endif // MXFLIB_NO_FILE_IO
 		UInt32 RunInSize;				//!< Size of run-in in physical file
 
 		DataChunkPtr Buffer;			//!< Memory file buffer pointer
@@ -66,6 +89,13 @@ namespace mxflib
 		Int32 BlockAlignEssenceOffset;	//!< Fixed distance from the block grid at which to align essence (+ve is after the grid, -ve before)
 		Int32 BlockAlignIndexOffset;	//!< Fixed distance from the block grid at which to align index (+ve is after the grid, -ve before)
 
+		ULHashMap<ULPtr> KeyPool;		//!< Keys read from this file that are not in the dictionary, shared by InternKey()
+		Mutex KeyPoolMutex;				//!< Mutex protecting KeyPool, as several threads may read from the same file
+
+		DictionaryOverlayPtr DictOverlay;	//!< Classes and types defined while reading this file with a frozen dictionary
+
+		BuiltMetadictPtr LastMetadict;		//!< The metadictionary last built for a header written to this file, reused by rewrites that define the same items
+
 		//DRAGONS: There should probably be a property to say that in-memory values have changed?
 		//DRAGONS: Should we have a flush() function
 	public:
@@ -73,6 +103,14 @@ namespace mxflib
 		DataChunk RunIn;
 		std::string Name;
 
+	private:
+		//! Prevent copy construction by NOT having an implementation to this copy constructor
+		/*! Copying would duplicate the file handles and the key pool mutex */
+		MXFFile(const MXFFile &rhs);
+
+		//! Prevent assignment by NOT having an implementation to this assignment operator
+		MXFFile &operator=(const MXFFile &rhs);
+
 	public:
 		MXFFile() : isOpen(false), isMemoryFile(false), TruncatedKnown(false), Truncated(false), BlockAlign(0) {};
 		~MXFFile() { if(isOpen) Close(); };
@@ -184,15 +222,63 @@ namespace mxflib
 		DataChunkPtr Read(size_t Size);
 		size_t Read(UInt8 *Buffer, size_t Size);
 
+		//! Read data from a given position in the file into a DataChunk, without using or moving the file pointer
+		/*! \note Files opened with Open(FileName, true) are read with positional I/O, so several threads may
+		 *        call ReadAt() on the same file at once. Other files fall back to Seek() and Read(), restoring the
+		 *        file pointer afterwards, so reads do see data written but not yet flushed. These must only be used
+		 *        by one thread at a time, including any other use of the file pointer
+		 */
+		DataChunkPtr ReadAt(Position Pos, size_t Size);
+
+		//! Read data from a given position in the file into a supplied buffer, without using or moving the file pointer
+		/*! \return The number of bytes read
+		 *  \note See ReadAt(Position, size_t) for thread-safety
+		 */
+		size_t ReadAt(Position Pos, UInt8 *Buffer, size_t Size);
+
+		//! Hint that a range of the file will be read soon
+		/*! This allows the operating system to start reading the data in the background, hiding the latency of
+		 *  slow (such as network) storage. It does not read any data itself and does nothing for memory files
+		 */
+		void ReadAhead(Position Pos, Length Size)
+		{
+			if((!isOpen) || isMemoryFile || (Size <= 0)) return;
+#ifndef MXFLIB_NO_FILE_IO
+			FileReadAhead(Handle, Pos + RunInSize, Size);
+#endif // MXFLIB_NO_FILE_IO
+		}
+
 //		MDObjectPtr ReadObject(void);
 //		template<class TP, class T> TP ReadObjectBase(void) { TP x; return x; };
 //		template<> MDObjectPtr ReadObjectBase<MDObjectPtr, MDObject>(void) { MDObjectPtr x; return x; };
 		MDObjectPtr ReadObject(PrimerPtr UsePrimer = NULL) { return MXFFile__ReadObjectBase<MDObjectPtr, MDObject>(this, UsePrimer); };
 		PartitionPtr ReadPartition(void) { return MXFFile__ReadObjectBase<PartitionPtr, Partition>(this); };
 
+		//! Read a partition pack from a given position in the file, without using or moving the file pointer
+		/*! \return NULL if no partition pack could be read
+		 */
+		PartitionPtr ReadPartitionAt(Position Pos);
+
 		//! Read a KLVObject from the file
 		KLVObjectPtr ReadKLV(void);
 
+		//! Read the key and length of the KLV at a given position, without using or moving the file pointer
+		/*! No heap allocations are made and no errors are reported, so this is suitable for scanning a file
+		 *  \return true if a complete key and valid length were read, otherwise false with Info.ValueLength set to -1
+		 */
+		bool ReadKL(Position Pos, KLInfo &Info);
+
+		//! Read the key and length of the KLV at the current position, leaving the file pointer at the start of the value
+		/*! \return true if a complete key and valid length were read, otherwise false with Info.ValueLength set to -1
+		 */
+		bool ReadKL(KLInfo &Info)
+		{
+			Position Pos = Tell();
+			bool Ret = ReadKL(Pos, Info);
+			Seek(Pos + Info.KLSize);
+			return Ret;
+		}
+
 		//! Write a partition pack to the file
 		void WritePartitionPack(PartitionPtr ThisPartition, PrimerPtr UsePrimer = NULL);
 
@@ -265,6 +351,18 @@ namespace mxflib
 		ULPtr ReadKey(void);
 		Length ReadBER(void);
 
+		//! Get a shared UL for a key read from this file
+		ULPtr InternKey(const UInt8 *Key);
+
+		//! Get the overlay for classes and types defined while reading this file with a frozen dictionary, building it if required
+		DictionaryOverlayPtr &GetDictionaryOverlay(void)
+		{
+			if(!DictOverlay) DictOverlay = new DictionaryOverlay;
+			return DictOverlay;
+		}
+
+	public:
+
 		//! Write a BER length
 		/*! \param Length	The length to be written
 		 *	\param Size		The total number of bytes to use for BER length (or 0 for auto)
@@ -417,6 +515,77 @@ namespace mxflib
 		//! Read from a memory file buffer
 		/*! \note This can be overridden in classes derived from MXFFile to give different memory read behaviour */
 		virtual size_t MemoryRead(UInt8 *Data, size_t Size);
+
+		//! Read from a given position in a memory file buffer without moving the current position
+		/*! \note The default version uses MemoryRead(), so any overridden read behaviour also applies to ReadAt() */
+		virtual size_t MemoryReadAt(Position Pos, UInt8 *Data, size_t Size);
+	};
+}
+
+
+namespace mxflib
+{
+	//! A view of the sequence of KLVs in a range of an MXF file, for walking a file without any per-KLV heap allocation
+	/*! Each KLV is decoded into a KLInfo with MXFFile::ReadKL(). Iteration ends at the end of the range, or at the first
+	 *  KLV whose key and length cannot be read (such as at the end of the file)
+	 *  \code
+	 *  KLVView View(File);
+	 *  for(KLVView::iterator it = View.begin(); it != View.end(); ++it) printf("%s\n", Int64toHexString(it->Offset).c_str());
+	 *  \endcode
+	 *  \note The file pointer is not used or moved, see MXFFile::ReadAt() for thread-safety
+	 */
+	class KLVView
+	{
+	public:
+		//! Forward iterator over the KLVs in a KLVView
+		class iterator
+		{
+		protected:
+			MXFFile *File;					//!< The file being read (the view holds the reference)
+			Position Limit;					//!< Position at which iteration ends, or -1 for the end of the file
+			KLInfo Info;					//!< The key and length of the current KLV
+			bool Valid;						//!< False once the end has been reached
+
+		public:
+			//! Construct an end iterator
+			iterator() : File(NULL), Limit(-1), Valid(false) {}
+
+			//! Construct an iterator at the KLV starting at a given position
+			iterator(MXFFile *File, Position Pos, Position Limit) : File(File), Limit(Limit) { Load(Pos); }
+
+			const KLInfo &operator*() const { return Info; }
+			const KLInfo *operator->() const { return &Info; }
+
+			//! Move to the next KLV
+			iterator &operator++() { Load(Info.End()); return *this; }
+
+			//! Iterators are equal if both are at the end, or both are at the same KLV
+			bool operator==(const iterator &Other) const
+			{
+				if(!Valid || !Other.Valid) return Valid == Other.Valid;
+				return Info.Offset == Other.Info.Offset;
+			}
+			bool operator!=(const iterator &Other) const { return !operator==(Other); }
+
+		protected:
+			//! Read the KLV at a given position, or mark the iterator as at the end
+			void Load(Position Pos)
+			{
+				Valid = ((Limit < 0) || (Pos < Limit)) && File->ReadKL(Pos, Info);
+			}
+		};
+
+	protected:
+		MXFFilePtr File;					//!< The file being viewed
+		Position Start;						//!< Position of the first KLV
+		Position End;						//!< Position at which to stop, or -1 for the end of the file
+
+	public:
+		//! Construct a view of the KLVs in a file, optionally limited to a range
+		KLVView(MXFFilePtr File, Position Start = 0, Position End = -1) : File(File), Start(Start), End(End) {}
+
+		iterator begin(void) const { return iterator(File, Start, End); }
+		iterator end(void) const { return iterator(); }
 	};
 }
 
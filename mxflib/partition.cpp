@@ -408,6 +408,9 @@ Length mxflib::Partition::ReadMetadata(MXFFilePtr File, Length Size)
 	// Start of data buffer
 	const UInt8 *BuffPtr = Data->Data;
 
+	// If the dictionary is frozen, any classes this file defines (such as in a metadictionary) are held in an overlay for the file
+	DictionaryOverlay::Scope OverlayScope(MDOType::IsFrozen() ? File->GetDictionaryOverlay().GetPtr() : NULL);
+
 	while(Size)
 	{
 		Length BytesAtItemStart = Bytes;
@@ -426,7 +429,7 @@ Length mxflib::Partition::ReadMetadata(MXFFilePtr File, Length Size)
 		}
 */
 		// Build an object (it may come back as an "unknown")
-		ULPtr NewUL = new UL(BuffPtr);
+		ULPtr NewUL = File->InternKey(BuffPtr);
 
 		/* If we are loading metadictionaries, we do so when we first read the Preface key */
 		if(Feature(FeatureLoadMetadict))
@@ -742,30 +745,44 @@ DataChunkPtr mxflib::Partition::ReadIndexChunk(void)
  */
 bool mxflib::Partition::SeekEssence(void)
 {
-	MXFFilePtr File = Object->GetParentFile();
-	if(!File) { error("Call to Partition::SeekEssence() on a non-file partition\n"); return false; }
+	Position BodyLocation = LocateEssence();
+	if(BodyLocation < 0) return false;
+
+	// Perform the seek
+	Object->GetParentFile()->Seek(BodyLocation);
+
+	return true;
+}
+
 
-	Position BodyLocation = 0;
+//! Locate start of Essence Container without using or moving the file pointer
+/*! \return The file offset of the start of the essence, or -1 if it could not be located
+ *  \note If there is no essence in this partition the location of the following partition (or the RIP if this is the footer) is returned
+ */
+Position mxflib::Partition::LocateEssence(void)
+{
+	MXFFilePtr File = Object->GetParentFile();
+	if(!File) { error("Call to Partition::LocateEssence() on a non-file partition\n"); return -1; }
 
 	Length MetadataSize = GetInt64(HeaderByteCount_UL);
 	Length IndexSize = GetInt64(IndexByteCount_UL);
 
-	// Skip over Partition Pack (and any trailing filler)
-	File->Seek( Object->GetLocation() + 16 );
-	Length Len = File->ReadBER();
-	BodyLocation = SkipFill( File->Tell() + Len );
-	if(!BodyLocation) return false;
-
-	// Skip over Metadata (and any trailing filler)
-	BodyLocation += MetadataSize;
+	// Skip over Partition Pack
+	KLInfo KL;
+	if(!File->ReadKL(Object->GetLocation(), KL)) return -1;
 
-	// Skip over Index (and any trailing filler)
-	BodyLocation += IndexSize;
+	Position BodyLocation = KL.End();
 
-	// Perform the seek
-	File->Seek(BodyLocation);
+	// Skip any trailing filler
+	File->ReadKL(BodyLocation, KL);
+	if(KL.KLSize < 16) return -1;
+	if((KL.ValueLength >= 0) && UL::Matches(KL.Key, KLVFill_UL.GetValue()))
+	{
+		BodyLocation = KL.End();
+	}
 
-	return true;
+	// Skip over Metadata and Index (both include any trailing filler)
+	return BodyLocation + MetadataSize + IndexSize;
 }
 
 
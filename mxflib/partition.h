@@ -145,6 +145,11 @@ namespace mxflib
 		//! Locate start of Essence Container
 		bool SeekEssence(void);
 
+		//! Locate start of Essence Container without using or moving the file pointer
+		/*! \return The file offset of the start of the essence, or -1 if it could not be located
+		 */
+		Position LocateEssence(void);
+
 		//! Locate the set that refers to the given set (with a strong reference)
 		MDObjectParent FindLinkParent(MDObjectPtr &Child);
 
@@ -116,6 +116,7 @@ Tag Primer::StaticLookup(ULPtr ItemUL, Tag TryTag /*=0*/)
 /*! If the UL has not yet been used the correct static or dynamic tag will 
  *	be determined and added to the primer
  *	\return The tag to use, or 0 if no more dynamic tags available
+ *	\note A frozen primer is not modified - static tags are returned without being added and 0 is returned if a dynamic tag would be needed
  */
 Tag Primer::Lookup(ULPtr ItemUL, Tag TryTag /*=0*/)
 {
@@ -137,10 +138,10 @@ Tag Primer::Lookup(ULPtr ItemUL, Tag TryTag /*=0*/)
 	}
 
 	// Do we have this UL already?
-	std::map<UL, Tag>::iterator it = TagLookup.find(ItemUL);
-	if(it != TagLookup.end())
+	const Tag *Found = TagLookup.Find(*ItemUL);
+	if(Found)
 	{
-		return (*it).second;
+		return *Found;
 	}
 
 	// Try and find the type with this UL
@@ -154,31 +155,225 @@ Tag Primer::Lookup(ULPtr ItemUL, Tag TryTag /*=0*/)
 		else
 		{
 			Tag ThisTag = (Type->GetKey().Data[0] << 8) + Type->GetKey().Data[1];
-			insert(Primer::value_type(ThisTag, ItemUL));
+			if(!Frozen) insert(Primer::value_type(ThisTag, ItemUL));
 			return ThisTag;
 		}
 	}
 
+	// DRAGONS: No dynamic tags are allocated in a frozen primer, the caller must use its own primer for these
+	if(Frozen) return 0;
+
 	// Generate a dynamic tag
-	// DRAGONS: Not very efficient
-	while(NextDynamic >= 0x8000)
+	Tag Ret = FindFreeDynamic();
+	if(Ret)
 	{
-		if(find(NextDynamic) == end())
-		{
-			Tag Ret = NextDynamic;
-			NextDynamic--;
-			insert(Primer::value_type(Ret, ItemUL));
-			return Ret;
-		}
-		NextDynamic--;
+		NextDynamic = Ret - 1;
+		insert(Primer::value_type(Ret, ItemUL));
+		return Ret;
 	}
 
 	//! Out of dynamic tags!
+	NextDynamic = 0x7fff;
 	error("Run out of dynamic tags!\n");
 	return 0;
 }
 
 
+//! Insert a new tag to UL mapping, unless the tag is already in use
+/*! \return An iterator for the entry with this tag, and true if it was added or false if the tag was already in use
+ */
+std::pair<Primer::iterator, bool> Primer::insert(const value_type &Val)
+{
+	// DRAGONS: The reverse lookup is updated even if the tag is already in use, so the first tag given for a UL is used for it
+	TagLookup.Insert(Val.second, Val.first);
+
+	return InsertEntry(Val);
+}
+
+
+//! Get the UL for a given tag, adding an entry with a null UL if the tag is not used
+Primer::mapped_type &Primer::operator[](Tag ThisTag)
+{
+	iterator it = InsertEntry(value_type(ThisTag, UL())).first;
+	return (*it).second;
+}
+
+
+//! Add an entry to the tag table, unless the tag is already in use, without updating the reverse lookup
+/*! \return An iterator for the entry with this tag, and true if it was added or false if the tag was already in use
+ */
+std::pair<Primer::iterator, bool> Primer::InsertEntry(const value_type &Val)
+{
+	// Allocate the page table, and the page holding this tag, when first used
+	if(PageStarts.empty()) PageStarts.resize(0x10000 / PageSize, 0);
+
+	UInt32 &Start = PageStarts[Val.first / PageSize];
+	if(!Start)
+	{
+		Start = static_cast<UInt32>(TagTable.size()) + 1;
+		TagTable.resize(TagTable.size() + PageSize, 0);
+	}
+
+	UInt32 &Index = TagTable[Start - 1 + Val.first % PageSize];
+	if(Index) return std::pair<iterator, bool>(iterator(this, Val.first), false);
+
+	// Reuse a slot freed by erase() if there is one
+	if(FreeSlots.empty())
+	{
+		Entries.push_back(Val);
+		Index = static_cast<UInt32>(Entries.size());
+	}
+	else
+	{
+		Index = FreeSlots.back();
+		FreeSlots.pop_back();
+		Entries[Index - 1] = Val;
+	}
+
+	if(Val.first >= 0x8000)
+	{
+		if(DynamicUsed.empty()) DynamicUsed.resize(0x8000 / 64, 0);
+
+		UInt32 Bit = Val.first - 0x8000;
+		DynamicUsed[Bit / 64] |= UINT64_C(1) << (Bit % 64);
+	}
+
+	return std::pair<iterator, bool>(iterator(this, Val.first), true);
+}
+
+
+//! Remove the entry for a given tag
+/*! \return The number of entries removed (0 or 1)
+ *  \note The reverse lookup is rebuilt, so this is much slower than insert()
+ */
+Primer::size_type Primer::erase(Tag ThisTag)
+{
+	UInt32 Index = EntryIndex(ThisTag);
+	if(!Index) return 0;
+
+	// DRAGONS: The slot is left in place for reuse rather than moving another entry into it, so that (as with std::map)
+	//          references to the other entries are not invalidated
+	Entries[Index - 1] = value_type();
+	FreeSlots.push_back(Index);
+
+	TagTable[PageStarts[ThisTag / PageSize] - 1 + ThisTag % PageSize] = 0;
+
+	if(ThisTag >= 0x8000)
+	{
+		UInt32 Bit = ThisTag - 0x8000;
+		DynamicUsed[Bit / 64] &= ~(UINT64_C(1) << (Bit % 64));
+	}
+
+	// DRAGONS: Entries cannot be removed from the reverse lookup so it is rebuilt from the remaining entries
+	TagLookup.clear();
+	iterator it = begin();
+	while(it != end())
+	{
+		TagLookup.Insert((*it).second, (*it).first);
+		it++;
+	}
+
+	return 1;
+}
+
+
+//! Remove all entries
+void Primer::clear(void)
+{
+	Entries.clear();
+	FreeSlots.clear();
+
+	PageStarts.clear();
+	TagTable.clear();
+	DynamicUsed.clear();
+
+	TagLookup.clear();
+	NextDynamic = 0xffff;
+}
+
+
+//! Find the first used tag at or after a given tag value, or 0x10000 if none
+UInt32 Primer::NextUsed(UInt32 Index) const
+{
+	if(PageStarts.empty()) return 0x10000;
+
+	while(Index < 0x10000)
+	{
+		UInt32 Start = PageStarts[Index / PageSize];
+
+		// Skip whole pages that have never been used
+		if(!Start)
+		{
+			Index = (Index / PageSize + 1) * PageSize;
+			continue;
+		}
+
+		if(TagTable[Start - 1 + Index % PageSize]) return Index;
+		Index++;
+	}
+
+	return 0x10000;
+}
+
+
+//! Find the last used tag before a given tag value, or 0x10000 if none
+UInt32 Primer::PrevUsed(UInt32 Index) const
+{
+	if(PageStarts.empty()) return 0x10000;
+
+	while(Index > 0)
+	{
+		Index--;
+
+		UInt32 Start = PageStarts[Index / PageSize];
+
+		// Skip whole pages that have never been used
+		if(!Start)
+		{
+			Index = (Index / PageSize) * PageSize;
+			continue;
+		}
+
+		if(TagTable[Start - 1 + Index % PageSize]) return Index;
+	}
+
+	return 0x10000;
+}
+
+
+//! Find the highest unused dynamic tag at or below NextDynamic, or 0 if there are none
+/*! The used tag bitmap is scanned a 64-bit word at a time */
+Tag Primer::FindFreeDynamic(void) const
+{
+	if(NextDynamic < 0x8000) return 0;
+
+	// No dynamic tags are used yet
+	if(DynamicUsed.empty()) return NextDynamic;
+
+	int Bit = NextDynamic - 0x8000;
+	int Word = Bit / 64;
+
+	// Mark the bits above NextDynamic in the first word as used, so they are not selected
+	UInt64 Used = DynamicUsed[Word];
+	if((Bit % 64) != 63) Used |= ~((UINT64_C(1) << ((Bit % 64) + 1)) - 1);
+
+	for(;;)
+	{
+		if(Used != ~UINT64_C(0))
+		{
+			// Locate the highest clear bit
+			int i = 63;
+			while(Used & (UINT64_C(1) << i)) i--;
+
+			return static_cast<Tag>(0x8000 + Word * 64 + i);
+		}
+
+		if(Word == 0) return 0;
+		Used = DynamicUsed[--Word];
+	}
+}
+
+
 //! Write this primer to a memory buffer
 /*! The primer will be <b>appended</b> to the DataChunk */
 UInt32 Primer::WritePrimer(DataChunkPtr &Buffer)
@@ -35,6 +35,10 @@
 
 
 #include <map>
+#include <vector>
+#include <deque>
+#include <iterator>
+#include <cstddef>
 
 namespace mxflib
 {
@@ -51,18 +55,123 @@ namespace mxflib
 
 namespace mxflib
 {
-	// Required to make MSVC compile!
-	typedef std::map<Tag, UL> Primer_Root;
-
 	//! Holds local tag to metadata definition UL mapping
-	class Primer : public Primer_Root, public RefCount<Primer>
+	/*! Entries are located by tag with a paged table giving constant time lookup of any of the 64K tags, and by UL with
+	 *  a hash table. A bitmap of used dynamic tags allows the next free dynamic tag to be found a word at a time.
+	 *  \note Iteration is in order of tag value, as for the std::map<Tag, UL> this class used to be, and the members of
+	 *        std::map that were used with primers are provided. As with std::map, erasing an entry only invalidates
+	 *        iterators and references to that entry
+	 */
+	class Primer : public RefCount<Primer>
 	{
+	public:
+		//! A tag and the UL it maps to
+		typedef std::pair<Tag, UL> value_type;
+
+		//! The key of each entry
+		typedef Tag key_type;
+
+		//! The value of each entry
+		typedef UL mapped_type;
+
+		//! Type used for counts of entries
+		typedef size_t size_type;
+
+		//! Type used for distances between iterators
+		typedef std::ptrdiff_t difference_type;
+
+		class const_iterator;
+
+		//! Iterator visiting every entry in order of tag value
+		class iterator
+		{
+			friend class Primer;
+			friend class const_iterator;
+
+		protected:
+			Primer *Parent;						//!< The primer being iterated
+			UInt32 Index;						//!< The current tag, or 0x10000 at the end
+
+		public:
+			typedef std::bidirectional_iterator_tag iterator_category;
+			typedef Primer::value_type value_type;
+			typedef Primer::difference_type difference_type;
+			typedef value_type *pointer;
+			typedef value_type &reference;
+
+			iterator() : Parent(NULL), Index(0x10000) {}
+			iterator(Primer *Parent, UInt32 Index) : Parent(Parent), Index(Index) {}
+
+			value_type &operator*() const { return Parent->Entries[Parent->EntryIndex(static_cast<Tag>(Index)) - 1]; }
+			value_type *operator->() const { return &operator*(); }
+
+			iterator &operator++() { Index = Parent->NextUsed(Index + 1); return *this; }
+			iterator operator++(int) { iterator Ret = *this; operator++(); return Ret; }
+
+			iterator &operator--() { Index = Parent->PrevUsed(Index); return *this; }
+			iterator operator--(int) { iterator Ret = *this; operator--(); return Ret; }
+
+			bool operator==(const iterator &Other) const { return Index == Other.Index; }
+			bool operator!=(const iterator &Other) const { return Index != Other.Index; }
+		};
+
+		//! Iterator visiting every entry of a const primer in order of tag value
+		class const_iterator
+		{
+		protected:
+			const Primer *Parent;				//!< The primer being iterated
+			UInt32 Index;						//!< The current tag, or 0x10000 at the end
+
+		public:
+			typedef std::bidirectional_iterator_tag iterator_category;
+			typedef const Primer::value_type value_type;
+			typedef Primer::difference_type difference_type;
+			typedef const Primer::value_type *pointer;
+			typedef const Primer::value_type &reference;
+
+			const_iterator() : Parent(NULL), Index(0x10000) {}
+			const_iterator(const Primer *Parent, UInt32 Index) : Parent(Parent), Index(Index) {}
+			const_iterator(const iterator &it) : Parent(it.Parent), Index(it.Index) {}
+
+			const value_type &operator*() const { return Parent->Entries[Parent->EntryIndex(static_cast<Tag>(Index)) - 1]; }
+			const value_type *operator->() const { return &operator*(); }
+
+			const_iterator &operator++() { Index = Parent->NextUsed(Index + 1); return *this; }
+			const_iterator operator++(int) { const_iterator Ret = *this; operator++(); return Ret; }
+
+			const_iterator &operator--() { Index = Parent->PrevUsed(Index); return *this; }
+			const_iterator operator--(int) { const_iterator Ret = *this; operator--(); return Ret; }
+
+			bool operator==(const const_iterator &Other) const { return Index == Other.Index; }
+			bool operator!=(const const_iterator &Other) const { return Index != Other.Index; }
+		};
+
+		friend class iterator;
+		friend class const_iterator;
+
+		//! Iterator visiting every entry in reverse order of tag value
+		typedef std::reverse_iterator<iterator> reverse_iterator;
+
+		//! Iterator visiting every entry of a const primer in reverse order of tag value
+		typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
 	protected:
-		Tag NextDynamic;						//! Next dynamic tag to try
-		std::map<UL, Tag> TagLookup;			//! Reverse lookup for locating a tag for a given UL
+		//! Number of tags indexed by each page of the tag table
+		enum { PageSize = 256 };
+
+		std::deque<value_type> Entries;			//!< All entries, in the order they were added (a deque so ULs are not copied as it grows)
+		std::vector<UInt32> PageStarts;			//!< Index + 1 of the start of each page in TagTable (0 if the page is unused), empty until the first entry is added
+		std::vector<UInt32> TagTable;			//!< Index + 1 of the entry in Entries for each tag (0 if unused), held a page at a time as pages are used
+		std::vector<UInt32> FreeSlots;			//!< Index + 1 of each slot in Entries freed by erase(), reused before Entries is grown
+		std::vector<UInt64> DynamicUsed;		//!< Bitmap of used dynamic tags (0x8000 to 0xffff), empty until the first dynamic tag is added
+
+		Tag NextDynamic;						//!< Next dynamic tag to try
+		ULHashMap<Tag> TagLookup;				//!< Reverse lookup for locating a tag for a given UL
+
+		bool Frozen;							//!< True if Lookup() may not add entries, allowing the primer to be shared between threads
 
 	public:
-		Primer() { NextDynamic = 0xffff; };
+		Primer() : Frozen(false) { clear(); };
 		UInt32 ReadValue(const UInt8 *Buffer, UInt32 Size);
 
 		//! Write this primer to a memory buffer
@@ -74,12 +183,130 @@ namespace mxflib
 		//! Determine the tag to use for a given UL - when no primer is availabe
 		static Tag StaticLookup(ULPtr ItemUL, Tag TryTag = 0);
 
-		//! Insert a new child type
-		std::pair<iterator, bool> insert(value_type Val) 
-		{ 
-			TagLookup.insert(std::map<UL, Tag>::value_type(Val.second, Val.first));
-			return Primer_Root::insert(Val);
+		//! Insert a new tag to UL mapping, unless the tag is already in use
+		std::pair<iterator, bool> insert(const value_type &Val);
+
+		//! Insert a new tag to UL mapping, unless the tag is already in use - the position hint is not required
+		iterator insert(iterator /*Hint*/, const value_type &Val) { return insert(Val).first; }
+
+		//! Insert a range of tag to UL mappings, skipping any tags already in use
+		template<class InputIterator> void insert(InputIterator First, InputIterator Last)
+		{
+			while(First != Last) insert(*First++);
+		}
+
+		//! Get the UL for a given tag, adding an entry with a null UL if the tag is not used
+		/*! \note As with the std::map this class used to be, assigning a UL through the returned reference does not update
+		 *        the reverse lookup used by Lookup() - use insert() for entries that need to be found by UL
+		 */
+		mapped_type &operator[](Tag ThisTag);
+
+		//! Locate the entry for a given tag
+		iterator find(Tag ThisTag) { return EntryIndex(ThisTag) ? iterator(this, ThisTag) : end(); }
+
+		//! Locate the entry for a given tag
+		const_iterator find(Tag ThisTag) const { return EntryIndex(ThisTag) ? const_iterator(this, ThisTag) : end(); }
+
+		//! Determine if a tag is used, returning 1 if it is or 0 if not
+		size_type count(Tag ThisTag) const { return EntryIndex(ThisTag) ? 1 : 0; }
+
+		//! Locate the first entry with a tag not less than a given tag
+		iterator lower_bound(Tag ThisTag) { return iterator(this, NextUsed(ThisTag)); }
+
+		//! Locate the first entry with a tag not less than a given tag
+		const_iterator lower_bound(Tag ThisTag) const { return const_iterator(this, NextUsed(ThisTag)); }
+
+		//! Locate the first entry with a tag greater than a given tag
+		iterator upper_bound(Tag ThisTag) { return iterator(this, NextUsed(static_cast<UInt32>(ThisTag) + 1)); }
+
+		//! Locate the first entry with a tag greater than a given tag
+		const_iterator upper_bound(Tag ThisTag) const { return const_iterator(this, NextUsed(static_cast<UInt32>(ThisTag) + 1)); }
+
+		//! Locate the range of entries with a given tag (which holds one entry if the tag is used, else none)
+		std::pair<iterator, iterator> equal_range(Tag ThisTag) { return std::pair<iterator, iterator>(lower_bound(ThisTag), upper_bound(ThisTag)); }
+
+		//! Locate the range of entries with a given tag (which holds one entry if the tag is used, else none)
+		std::pair<const_iterator, const_iterator> equal_range(Tag ThisTag) const
+		{
+			return std::pair<const_iterator, const_iterator>(lower_bound(ThisTag), upper_bound(ThisTag));
 		}
+
+		//! Iterator for the entry with the lowest tag
+		iterator begin(void) { return iterator(this, NextUsed(0)); }
+
+		//! Iterator for the entry with the lowest tag
+		const_iterator begin(void) const { return const_iterator(this, NextUsed(0)); }
+
+		//! Iterator for the end of the primer
+		iterator end(void) { return iterator(this, 0x10000); }
+
+		//! Iterator for the end of the primer
+		const_iterator end(void) const { return const_iterator(this, 0x10000); }
+
+		//! Reverse iterator for the entry with the highest tag
+		reverse_iterator rbegin(void) { return reverse_iterator(end()); }
+
+		//! Reverse iterator for the entry with the highest tag
+		const_reverse_iterator rbegin(void) const { return const_reverse_iterator(end()); }
+
+		//! Reverse iterator for the end of a reverse iteration
+		reverse_iterator rend(void) { return reverse_iterator(begin()); }
+
+		//! Reverse iterator for the end of a reverse iteration
+		const_reverse_iterator rend(void) const { return const_reverse_iterator(begin()); }
+
+		//! Remove the entry for a given tag
+		/*! \return The number of entries removed (0 or 1)
+		 *  \note The reverse lookup is rebuilt, so this is much slower than insert()
+		 */
+		size_type erase(Tag ThisTag);
+
+		//! Remove the entry at a given position
+		void erase(iterator it) { if(it != end()) erase(static_cast<Tag>(it.Index)); }
+
+		//! Remove the entries in a given range
+		/*! \note The reverse lookup is rebuilt for each entry removed */
+		void erase(iterator First, iterator Last)
+		{
+			// DRAGONS: Iterators hold a tag value, so they remain valid as the entries before them are removed
+			while(First != Last) erase(First++);
+		}
+
+		//! Number of entries in the primer
+		size_t size(void) const { return Entries.size() - FreeSlots.size(); }
+
+		//! Determine if the primer is empty
+		bool empty(void) const { return size() == 0; }
+
+		//! Remove all entries
+		void clear(void);
+
+		//! Prevent Lookup() from adding any more entries
+		/*! Static tags are still returned for known ULs, but no dynamic tags can be allocated */
+		void Freeze(void) { Frozen = true; }
+
+		//! Determine if Lookup() is prevented from adding entries
+		bool IsFrozen(void) const { return Frozen; }
+
+	protected:
+		//! Get the index + 1 of the entry for a given tag, or 0 if the tag is not used
+		UInt32 EntryIndex(Tag ThisTag) const
+		{
+			UInt32 Start = PageStarts.empty() ? 0 : PageStarts[ThisTag / PageSize];
+			return Start ? TagTable[Start - 1 + ThisTag % PageSize] : 0;
+		}
+
+		//! Find the first used tag at or after a given tag value, or 0x10000 if none
+		UInt32 NextUsed(UInt32 Index) const;
+
+		//! Find the last used tag before a given tag value, or 0x10000 if none
+		UInt32 PrevUsed(UInt32 Index) const;
+
+		//! Add an entry to the tag table, unless the tag is already in use, without updating the reverse lookup
+		std::pair<iterator, bool> InsertEntry(const value_type &Val);
+
+		//! Find the highest unused dynamic tag at or below NextDynamic, or 0 if there are none
+		Tag FindFreeDynamic(void) const;
 	};
 }
 
@@ -199,6 +199,9 @@ namespace mxflib
 //! Allow command-line switches to be prefixed with '/' or '-'
 #define IsCommandLineSwitchPrefix(x) ( (x == '/') || (x == '-'))
 
+//! Storage class for variables that have a separate instance in each thread
+#define MXFLIB_THREAD_LOCAL __declspec(thread)
+
 	//! Pause for user input (with prompt) e.g. for debugging purposes
 	inline void PauseForInput(void)
 	{
@@ -252,6 +255,42 @@ namespace mxflib
 		 int Ret = _read(file, dest, (unsigned int)size);
 		 return (Ret < 0) ? static_cast<size_t>(-1) : Ret; 
 	 }
+
+	// Positional reads use a second handle opened for overlapped I/O
+	// DRAGONS: ReadFile() with an offset on a synchronous handle moves the file pointer, so the CRT handle can't be used
+	typedef HANDLE ReadAtHandle;
+	inline ReadAtHandle FileOpenReadAt(FileHandle file)
+	{
+		return ReOpenFile(reinterpret_cast<HANDLE>(_get_osfhandle(file)), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, FILE_FLAG_OVERLAPPED);
+	}
+	inline bool FileReadAtValid(ReadAtHandle handle) { return (handle != NULL) && (handle != INVALID_HANDLE_VALUE); }
+	inline void FileCloseReadAt(ReadAtHandle handle) { CloseHandle(handle); }
+
+	// Read from a given offset without using the shared file position
+	// DRAGONS: Each read waits on its own event as several threads may be reading through the same handle
+	inline size_t FileReadAt(ReadAtHandle handle, UInt64 offset, unsigned char *dest, size_t size)
+	{
+		OVERLAPPED Overlapped;
+		memset(&Overlapped, 0, sizeof(Overlapped));
+		Overlapped.Offset = static_cast<DWORD>(offset);
+		Overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+		Overlapped.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+		if(!Overlapped.hEvent) return static_cast<size_t>(-1);
+
+		DWORD Bytes = 0;
+		BOOL Ok = ReadFile(handle, dest, (DWORD)size, NULL, &Overlapped);
+		if(Ok || (GetLastError() == ERROR_IO_PENDING)) Ok = GetOverlappedResult(handle, &Overlapped, &Bytes, TRUE);
+		DWORD Error = Ok ? 0 : GetLastError();
+
+		CloseHandle(Overlapped.hEvent);
+
+		if(Ok) return Bytes;
+		return (Error == ERROR_HANDLE_EOF) ? 0 : static_cast<size_t>(-1);
+	}
+
+	// Hint that a range of the file will be read soon
+	// DRAGONS: There is no equivalent of posix_fadvise() for CRT file handles, so this does nothing
+	inline void FileReadAhead(FileHandle /*file*/, UInt64 /*offset*/, UInt64 /*size*/) { }
 	inline size_t FileWrite(FileHandle file, const unsigned char *source, size_t size) 
 	{ 
 		int Ret = _write(file, source, (unsigned int)size); 
@@ -262,6 +301,7 @@ namespace mxflib
 	inline FileHandle FileOpenRead(const char *filename) { return _open(filename, _O_BINARY | _O_RDONLY ); }
 	inline FileHandle FileOpenNew(const char *filename) { return _open(filename, _O_BINARY | _O_RDWR | _O_CREAT | _O_TRUNC, _S_IREAD | _S_IWRITE); }
 	inline bool FileValid(FileHandle file) { return (file >= 0); }
+	inline FileHandle FileInvalid(void) { return -1; }
 	inline bool FileEof(FileHandle file) { return _eof(file) ? true : false; }
 	inline UInt64 FileTell(FileHandle file) { return _telli64(file); }
 	inline void FileClose(FileHandle file) { _close(file); }
@@ -428,6 +468,8 @@ namespace mxflib
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
 
 #ifdef HAVE_STDINT_H
 #include <stdint.h>
@@ -531,12 +573,50 @@ namespace mxflib
 	inline int FileSeek(FileHandle file, UInt64 offset) { return fseeko(file, offset, SEEK_SET); }
 	inline int FileSeekEnd(FileHandle file) { return fseeko(file, 0, SEEK_END); }
 	inline size_t FileRead(FileHandle file, unsigned char *dest, size_t size) { return fread(dest, 1, size, file); }
+
+	// Positional reads use pread() on the same handle, which does not move the file pointer
+	typedef FileHandle ReadAtHandle;
+	inline ReadAtHandle FileOpenReadAt(FileHandle file) { return file; }
+	inline bool FileReadAtValid(ReadAtHandle handle) { return (handle != NULL); }
+	inline void FileCloseReadAt(ReadAtHandle /*handle*/) { }
+
+	// Read from a given offset without using the shared file position (or the stdio buffer)
+	inline size_t FileReadAt(ReadAtHandle file, UInt64 offset, unsigned char *dest, size_t size)
+	{
+		size_t Total = 0;
+		while(Total < size)
+		{
+			ssize_t Ret = pread(fileno(file), dest + Total, size - Total, static_cast<off_t>(offset + Total));
+			if(Ret == 0) break;
+			if(Ret < 0)
+			{
+				if(errno == EINTR) continue;
+				return Total ? Total : static_cast<size_t>(-1);
+			}
+			Total += static_cast<size_t>(Ret);
+		}
+		return Total;
+	}
+
+	// Hint that a range of the file will be read soon, so that the OS can start reading it into the page cache
+	inline void FileReadAhead(FileHandle file, UInt64 offset, UInt64 size)
+	{
+#if defined(POSIX_FADV_WILLNEED)
+		posix_fadvise(fileno(file), static_cast<off_t>(offset), static_cast<off_t>(size), POSIX_FADV_WILLNEED);
+#elif defined(F_RDADVISE)
+		struct radvisory Advice;
+		Advice.ra_offset = static_cast<off_t>(offset);
+		Advice.ra_count = (size > 0x7fffffff) ? 0x7fffffff : static_cast<int>(size);
+		fcntl(fileno(file), F_RDADVISE, &Advice);
+#endif
+	}
 	inline size_t FileWrite(FileHandle file, const unsigned char *source, size_t size) { return fwrite(source, 1, size, file); }
 	inline int FileGetc(FileHandle file) { UInt8 c; return (FileRead(file, &c, 1) == 1) ? (int)c : EOF; }
 	inline FileHandle FileOpen(const char *filename) { return fopen(filename, "r+b" ); }
 	inline FileHandle FileOpenRead(const char *filename) { return fopen(filename, "rb" ); }
 	inline FileHandle FileOpenNew(const char *filename) { return fopen(filename, "w+b"); }
 	inline bool FileValid(FileHandle file) { return (file != NULL); }
+	inline FileHandle FileInvalid(void) { return NULL; }
 	inline bool FileEof(FileHandle file) { return feof(file); }
 	inline UInt64 FileTell(FileHandle file) { return ftello(file); }
 	inline void FileClose(FileHandle file) { fclose(file); }
@@ -589,6 +669,9 @@ void MakeUUID(UInt8 *Buffer);
 //! Allow command-line switches to be prefixed only with '-'
 #define IsCommandLineSwitchPrefix(x) ( x == '-' )
 
+//! Storage class for variables that have a separate instance in each thread
+#define MXFLIB_THREAD_LOCAL __thread
+
 #ifndef UINT64_C
 #define UINT64_C(c)	c##ULL		// for defining 64bit constants
 #endif // UINT64_C
@@ -639,6 +722,170 @@ namespace mxflib
 }
 
 
+/************************************************/
+/*     Threads and thread synchronization       */
+/************************************************/
+// DRAGONS: Windows builds use the native threads, everything else uses pthreads
+//          MXFLIB_THREAD_LOCAL, above, selects the matching thread-local storage
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+namespace mxflib
+{
+	//! A mutex for serializing access to data shared between threads
+	/*! \note Not recursive - a thread must not lock a mutex that it already holds */
+	class Mutex
+	{
+	private:
+#ifdef _WIN32
+		CRITICAL_SECTION Handle;					//!< The native mutex
+#else
+		pthread_mutex_t Handle;						//!< The native mutex
+#endif
+
+		Mutex(const Mutex &);						//!< Don't allow copy construction
+		Mutex &operator=(const Mutex &);			//!< Don't allow copying
+
+		friend class CondVar;
+
+	public:
+#ifdef _WIN32
+		Mutex() { InitializeCriticalSection(&Handle); }
+		~Mutex() { DeleteCriticalSection(&Handle); }
+
+		//! Lock the mutex, waiting until it is available
+		void Lock(void) { EnterCriticalSection(&Handle); }
+
+		//! Unlock the mutex
+		void Unlock(void) { LeaveCriticalSection(&Handle); }
+#else
+		Mutex() { pthread_mutex_init(&Handle, NULL); }
+		~Mutex() { pthread_mutex_destroy(&Handle); }
+
+		//! Lock the mutex, waiting until it is available
+		void Lock(void) { pthread_mutex_lock(&Handle); }
+
+		//! Unlock the mutex
+		void Unlock(void) { pthread_mutex_unlock(&Handle); }
+#endif
+	};
+
+
+	//! A condition variable, allowing threads to wait for a change to data protected by a Mutex
+	class CondVar
+	{
+	private:
+#ifdef _WIN32
+		CONDITION_VARIABLE Handle;					//!< The native condition variable
+#else
+		pthread_cond_t Handle;						//!< The native condition variable
+#endif
+
+		CondVar(const CondVar &);					//!< Don't allow copy construction
+		CondVar &operator=(const CondVar &);		//!< Don't allow copying
+
+	public:
+#ifdef _WIN32
+		CondVar() { InitializeConditionVariable(&Handle); }
+
+		//! Wait for the condition to be signalled
+		/*! DRAGONS: Must be called with Locked held, which is released while waiting and held again on return */
+		void Wait(Mutex &Locked) { SleepConditionVariableCS(&Handle, &Locked.Handle, INFINITE); }
+
+		//! Wake all threads waiting on this condition
+		void Broadcast(void) { WakeAllConditionVariable(&Handle); }
+#else
+		CondVar() { pthread_cond_init(&Handle, NULL); }
+		~CondVar() { pthread_cond_destroy(&Handle); }
+
+		//! Wait for the condition to be signalled
+		/*! DRAGONS: Must be called with Locked held, which is released while waiting and held again on return */
+		void Wait(Mutex &Locked) { pthread_cond_wait(&Handle, &Locked.Handle); }
+
+		//! Wake all threads waiting on this condition
+		void Broadcast(void) { pthread_cond_broadcast(&Handle); }
+#endif
+	};
+
+
+	//! A handle to a thread of execution
+	/*! Handles may be copied, but each thread that is started must be joined exactly once */
+	class Thread
+	{
+	public:
+		//! Function run by a thread
+		typedef void (*EntryPoint)(void *Param);
+
+	private:
+		//! The entry point and its parameter, passed to the new thread
+		struct StartInfo
+		{
+			EntryPoint Entry;
+			void *Param;
+		};
+
+#ifdef _WIN32
+		HANDLE Handle;								//!< The native thread handle
+
+		//! Native entry point, which runs the requested entry point
+		static DWORD WINAPI NativeEntry(LPVOID Info)
+		{
+			StartInfo Start = *static_cast<StartInfo *>(Info);
+			delete static_cast<StartInfo *>(Info);
+
+			Start.Entry(Start.Param);
+			return 0;
+		}
+#else
+		pthread_t Handle;							//!< The native thread handle
+
+		//! Native entry point, which runs the requested entry point
+		static void *NativeEntry(void *Info)
+		{
+			StartInfo Start = *static_cast<StartInfo *>(Info);
+			delete static_cast<StartInfo *>(Info);
+
+			Start.Entry(Start.Param);
+			return NULL;
+		}
+#endif
+
+	public:
+		//! Start a new thread running Entry(Param)
+		/*! \return true if the thread was started */
+		bool Start(EntryPoint Entry, void *Param)
+		{
+			StartInfo *Info = new StartInfo;
+			Info->Entry = Entry;
+			Info->Param = Param;
+
+#ifdef _WIN32
+			Handle = CreateThread(NULL, 0, NativeEntry, Info, 0, NULL);
+			if(Handle != NULL) return true;
+#else
+			if(pthread_create(&Handle, NULL, NativeEntry, Info) == 0) return true;
+#endif
+
+			delete Info;
+			return false;
+		}
+
+		//! Wait for a thread started by Start() to finish, and release it
+		void Join(void)
+		{
+#ifdef _WIN32
+			WaitForSingleObject(Handle, INFINITE);
+			CloseHandle(Handle);
+#else
+			pthread_join(Handle, NULL);
+#endif
+		}
+	};
+}
+
+
 /*****************************************************/
 /*     Declarations for client supplied file-I/O     */
 /*****************************************************/
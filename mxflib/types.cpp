@@ -12,15 +12,15 @@ using namespace mxflib;
 #include "types.h"
 
 
-//! Fast compare a UL based on testing most-likely to fail bytes first
+//! Fast compare with the 16 bytes of a UL based on testing most-likely to fail bytes first
 /*! We use an unrolled loop with modified order for best efficiency
  *  There may be a slightly faster way that will prevent pipeline stalling, but this is fast enough!
  */
-bool mxflib::UL::operator==(const UL &RHS) const
+bool mxflib::UL::Equals(const UInt8 *RHS) const
 {
 	// Most differences are in the second 8 bytes so we check those first
 	UInt8 const *pLHS = &Ident[8];
-	UInt8 const *pRHS = &RHS.Ident[8];
+	UInt8 const *pRHS = &RHS[8];
 	
 	if(*pLHS++ != *pRHS++) return false;		// Test byte 8
 	if(*pLHS++ != *pRHS++) return false;		// Test byte 9
@@ -34,7 +34,7 @@ bool mxflib::UL::operator==(const UL &RHS) const
 	// Now we test the first 8 bytes, but in reverse as the first 4 are almost certainly "06 0e 2b 34"
 	// We use predecrement from the original start values so that the compiler will optimize the address calculation if possible
 	pLHS = &Ident[8];
-	pRHS = &RHS.Ident[8];
+	pRHS = &RHS[8];
 
 	if(*--pLHS != *--pRHS) return false;		// Test byte 7
 	if(*--pLHS != *--pRHS) return false;		// Test byte 6
@@ -48,16 +48,16 @@ bool mxflib::UL::operator==(const UL &RHS) const
 }
 
 
-//! Fast compare of effective values of UL based on testing most-likely to fail bytes first
+//! Fast compare of effective values with the 16 bytes of a UL based on testing most-likely to fail bytes first
 /*! DRAGONS: This comparison ignores the UL version number and group coding
  *	We use an unrolled loop with modified order for best efficiency.
  *	There may be a slightly faster way that will prevent pipeline stalling, but this is fast enough!
  */
-bool mxflib::UL::Matches(const UL &RHS) const
+bool mxflib::UL::Matches(const UInt8 *LHS, const UInt8 *RHS)
 {
 	// Most differences are in the second 8 bytes so we check those first
-	UInt8 const *pLHS = &Ident[8];
-	UInt8 const *pRHS = &RHS.Ident[8];
+	UInt8 const *pLHS = &LHS[8];
+	UInt8 const *pRHS = &RHS[8];
 	
 	if(*pLHS++ != *pRHS++) return false;		// Test byte 8
 	if(*pLHS++ != *pRHS++) return false;		// Test byte 9
@@ -70,8 +70,8 @@ bool mxflib::UL::Matches(const UL &RHS) const
 
 	// Now we test the first 8 bytes, but in reverse as the first 4 are almost certainly "06 0e 2b 34"
 	// We use predecrement from the original start values so that the compiler will optimize the address calculation if possible
-	pLHS = &Ident[8];
-	pRHS = &RHS.Ident[8];
+	pLHS = &LHS[8];
+	pRHS = &RHS[8];
 
 	// Skip the UL version number
 	--pLHS;
@@ -101,8 +101,8 @@ bool mxflib::UL::Matches(const UL &RHS) const
 	// Do the remaining two comparisons
 	// DRAGONS: We do the byute 5 comparison even if we have already done it because it would take as long to
 	//          determine if we have already done it or not!
-	if(Ident[8] != RHS.Ident[8]) return false;
-	return (Ident[5] == RHS.Ident[5]);
+	if(LHS[8] != RHS[8]) return false;
+	return (LHS[5] == RHS[5]);
 }
 
 
@@ -664,78 +664,109 @@ namespace
 
 //! Find a label with a given value, from a UL reference
 /*! If more than one masked label matches, the value with the least mask bits is returned. 
- *  If more than one have the same number of mask bits, the last one found will be returned - which this is is undefined.
+ *  If more than one have the same number of mask bits, the one with the highest value is returned (the most recently added if equal).
  */
 LabelPtr Label::Find(const UL &LabelValue)
 {
 	// Search for an exact match
-	LabelULMap::iterator it = LabelMap.find(LabelValue);
+	const LabelPtr *Exact = LabelMap.Find(LabelValue);
 
 	// If we found an exact match, return it
-	if(it != LabelMap.end()) return (*it).second;
+	if(Exact) return *Exact;
 
-	/* Now we have to do the long-hand search for masked values */
+	/* Now search the masked labels, one hash lookup per distinct mask */
 
-	// DRAGONS: This can be simplified by seeking to a point in the list before the first possible match - but this code is good enough
-	
-	int SmallestBitMask = 255;
-	LabelPtr BestMatch;
+	const MaskedEntry *BestMatch = NULL;
+	int BestBits = 0;
 
-	LabelULMultiMap::iterator mit = LabelMultiMap.begin();
-	while(mit != LabelMultiMap.end())
+	const UInt8 *Value = LabelValue.GetValue();
+
+	MaskGroupList::const_iterator it = MaskGroups.begin();
+	while(it != MaskGroups.end())
 	{
-		// Only check those entries that have a mask (non-masked matches will have been found with the "find" call
-		if((*mit).second->NonZeroMask)
-		{
-			// Set up pointers to this entry's mask and value
-			const UInt8 *p1 = (*mit).first.GetValue();
-			const UInt8 *pMask = (*mit).second->Mask;
+		// Groups are sorted by number of mask bits, so once we have a match only groups with as few bits can do better or tie
+		if(BestMatch && ((*it).Bits > BestBits)) break;
 
-			// Set up a pointer to the search value
-			const UInt8 *p2 = LabelValue.GetValue();
+		// Clear the masked bits in the search value
+		UInt8 Masked[16];
+		int i;
+		for(i=0; i<16; i++) Masked[i] = Value[i] & ~(*it).Mask[i];
 
-			// Compare each byte
-			int Count = 16;
-			do
+		const MaskedEntry *Match = (*it).Labels.Find(Masked);
+		if(Match)
+		{
+			if(!BestMatch)
 			{
-				// Do a masked compare, first use XOR to select which bits don't match, then clear the masked ones
-				// Any bytes that match the test will end up zero, otherwise the failing bit will be set
-				if( ((*p1++) ^ (*p2++)) & ~(*pMask++) ) break;
-			} while(--Count);
-
-			// If we counted all the way to zero, we found a match - so count the mask bits
-			if(!Count)
+				BestMatch = Match;
+				BestBits = (*it).Bits;
+			}
+			else
 			{
-				int BitMaskSize = 0;
-
-				pMask = (*mit).second->Mask;
-				Count = 16;
-//while(Count--) { printf("%02x[%d].", *pMask, BitCount[*pMask]); BitMaskSize += BitCount[*pMask++]; };
-				while(Count--) { BitMaskSize += BitCount[*pMask++]; };
-
-//printf("Found a match with %d mask bits = %s\n", BitMaskSize, (*mit).second->GetName().c_str());
-				if(BitMaskSize <= SmallestBitMask)
-				{
-//printf("Best so far\n");
-					SmallestBitMask = BitMaskSize;
-					BestMatch = (*mit).second;
-				}
-			}	
+				// Break ties in favour of the highest value, then the most recently added
+				if((BestMatch->Entry->Value < Match->Entry->Value) 
+				|| ((!(Match->Entry->Value < BestMatch->Entry->Value)) && (Match->Serial > BestMatch->Serial))) BestMatch = Match;
+			}
 		}
 
-		mit++;
+		it++;
 	}
 
 	// Return the best match - which may be NULL
-	return BestMatch;
+	if(BestMatch) return BestMatch->Entry;
+	return NULL;
+}
+
+
+//! Add a masked label to the mask groups
+void Label::AddMasked(LabelPtr &NewLabel)
+{
+	MaskedEntry Entry;
+	Entry.Entry = NewLabel;
+	Entry.Serial = MaskedCount++;
+
+	// Clear the masked bits of the value to give the key
+	UInt8 Masked[16];
+	const UInt8 *Value = NewLabel->Value.GetValue();
+	int i;
+	for(i=0; i<16; i++) Masked[i] = Value[i] & ~NewLabel->Mask[i];
+
+	// Locate the group for this mask
+	MaskGroupList::iterator it = MaskGroups.begin();
+	while(it != MaskGroups.end())
+	{
+		if(memcmp((*it).Mask, NewLabel->Mask, 16) == 0) break;
+		it++;
+	}
+
+	// Add a new group if required, keeping the list sorted by number of mask bits
+	if(it == MaskGroups.end())
+	{
+		MaskGroup NewGroup;
+		memcpy(NewGroup.Mask, NewLabel->Mask, 16);
+		NewGroup.Bits = 0;
+		for(i=0; i<16; i++) NewGroup.Bits += BitCount[NewLabel->Mask[i]];
+
+		it = MaskGroups.begin();
+		while((it != MaskGroups.end()) && ((*it).Bits <= NewGroup.Bits)) it++;
+		it = MaskGroups.insert(it, NewGroup);
+	}
+
+	// Labels with the same mask and masked value always match together, so only the one that wins ties need be kept
+	const MaskedEntry *Existing = (*it).Labels.Find(Masked);
+	if(Existing && (NewLabel->Value < Existing->Entry->Value)) return;
+
+	(*it).Labels.Set(UL(Masked), Entry);
 }
 
 
 //! Map of all existing labels that don't use masking
 Label::LabelULMap Label::LabelMap;
 
-//! Map of all existing labels that use masking - this is a multimap to allow the same base with different masks
-Label::LabelULMultiMap Label::LabelMultiMap;
+//! All existing labels that use masking, grouped by mask
+Label::MaskGroupList Label::MaskGroups;
+
+//! Number of masked labels added so far
+UInt32 Label::MaskedCount = 0;
 
 //! Find a label with a given value, from a text Name
 LabelPtr Label::Find(const std::string Name)
@@ -744,12 +775,12 @@ LabelPtr Label::Find(const std::string Name)
 
 	LabelPtr Ret;
 
-	LabelULMap::iterator it = LabelMap.begin();
+	LabelULMap::const_iterator it = LabelMap.begin();
 
 	while( it != LabelMap.end() )
 	{
-		if( (*it).second->Name == Name ) return (*it).second;
-		it++;
+		if( it.Value()->Name == Name ) return it.Value();
+		++it;
 	}
 
 	return Ret;
@@ -768,16 +799,15 @@ bool Label::Insert(std::string Name, std::string Detail, const UInt8 *LabelValue
 
 	if(LabelMask)
 	{
-//#printf("Adding %s to the masked map\n", Name.c_str());
-		// Masked labels go in the multi-map and this will always succeed
-		LabelMultiMap.insert(LabelULMap::value_type(NewLabel->Value, NewLabel));
+		// Masked labels go in the mask groups and this will always succeed
+		AddMasked(NewLabel);
 		return true;
 	}
 	else
 	{
 //#printf("Adding %s to the unmasked map\n", Name.c_str());
 		// Try and insert this new label - if that succeeded, return true
-		return LabelMap.insert(LabelULMap::value_type(NewLabel->Value, NewLabel)).second;
+		return LabelMap.Insert(NewLabel->Value, NewLabel);
 	}
 }
 
@@ -794,14 +824,14 @@ bool Label::Insert(std::string Name, std::string Detail, const ULPtr &LabelValue
 
 	if(LabelMask)
 	{
-		// Masked labels go in the multi-map and this will always succeed
-		LabelMultiMap.insert(LabelULMap::value_type(NewLabel->Value, NewLabel));
+		// Masked labels go in the mask groups and this will always succeed
+		AddMasked(NewLabel);
 		return true;
 	}
 	else
 	{
 		// Try and insert this new label - if that succeeded, return true
-		return LabelMap.insert(LabelULMap::value_type(NewLabel->Value, NewLabel)).second;
+		return LabelMap.Insert(NewLabel->Value, NewLabel);
 	}
 }
 
@@ -818,14 +848,14 @@ bool Label::Insert(std::string Name, std::string Detail, const UL &LabelValue, c
 
 	if(LabelMask)
 	{
-		// Masked labels go in the multi-map and this will always succeed
-		LabelMultiMap.insert(LabelULMap::value_type(NewLabel->Value, NewLabel));
+		// Masked labels go in the mask groups and this will always succeed
+		AddMasked(NewLabel);
 		return true;
 	}
 	else
 	{
 		// Try and insert this new label - if that succeeded, return true
-		return LabelMap.insert(LabelULMap::value_type(NewLabel->Value, NewLabel)).second;
+		return LabelMap.Insert(NewLabel->Value, NewLabel);
 	}
 }
 
@@ -842,14 +872,14 @@ bool Label::Insert(std::string Name, std::string Detail, const UUIDPtr &LabelVal
 
 	if(LabelMask)
 	{
-		// Masked labels go in the multi-map and this will always succeed
-		LabelMultiMap.insert(LabelULMap::value_type(NewLabel->Value, NewLabel));
+		// Masked labels go in the mask groups and this will always succeed
+		AddMasked(NewLabel);
 		return true;
 	}
 	else
 	{
 		// Try and insert this new label - if that succeeded, return true
-		return LabelMap.insert(LabelULMap::value_type(NewLabel->Value, NewLabel)).second;
+		return LabelMap.Insert(NewLabel->Value, NewLabel);
 	}
 }
 
@@ -866,14 +896,14 @@ bool Label::Insert(std::string Name, std::string Detail, const mxflib::UUID &Lab
 
 	if(LabelMask)
 	{
-		// Masked labels go in the multi-map and this will always succeed
-		LabelMultiMap.insert(LabelULMap::value_type(NewLabel->Value, NewLabel));
+		// Masked labels go in the mask groups and this will always succeed
+		AddMasked(NewLabel);
 		return true;
 	}
 	else
 	{
 		// Try and insert this new label - if that succeeded, return true
-		return LabelMap.insert(LabelULMap::value_type(NewLabel->Value, NewLabel)).second;
+		return LabelMap.Insert(NewLabel->Value, NewLabel);
 	}
 }
 
@@ -910,7 +940,9 @@ void Rational::SetString(std::string Value)
 OutputFormatEnum mxflib::UL::DefaultFormat = -1;
 
 /* Static members holding allocated dynamic enum values for UL output formats */
-OutputFormatEnum UL::OutputFormatBraced = -1;
+/* DRAGONS: The default format is allocated here, rather than when first used, so that formatting never writes to these
+ *          statics and ULs may be formatted on several threads at once */
+OutputFormatEnum UL::OutputFormatBraced = MDTraitsEnum::GetNewEnum();
 OutputFormatEnum UL::OutputFormatHex = -1;
 OutputFormatEnum UL::OutputFormat0xHex = -1;
 OutputFormatEnum UL::OutputFormatDottedHex = -1;
@@ -1012,16 +1044,8 @@ std::string mxflib::UL::FormatString(UInt8 const *Ident, OutputFormatEnum Format
 
 	char Buffer[100];
 
-	// If no format specified, use current default
-	if(Format == -1)
-	{
-		if(DefaultFormat == -1)
-		{
-			if(OutputFormatBraced == -1) OutputFormatBraced = MDTraitsEnum::GetNewEnum();
-			DefaultFormat = OutputFormatBraced;
-		}
-		Format = DefaultFormat;
-	}
+	// If no format specified, use current default (braced unless one has been set)
+	if(Format == -1) Format = (DefaultFormat == -1) ? OutputFormatBraced : DefaultFormat;
 
 	if(Format == OutputFormatBraced)
 	{
@@ -1127,7 +1151,8 @@ std::string mxflib::UL::FormatString(UInt8 const *Ident, OutputFormatEnum Format
 OutputFormatEnum mxflib::UUID::DefaultFormat = -1;
 
 /* Static members holding allocated dynamic enum values for UUID output formats */
-OutputFormatEnum mxflib::UUID::OutputFormatBraced = -1;
+/* DRAGONS: As for ULs, the default format is allocated here so that formatting never writes to these statics */
+OutputFormatEnum mxflib::UUID::OutputFormatBraced = MDTraitsEnum::GetNewEnum();
 OutputFormatEnum mxflib::UUID::OutputFormatHex = -1;
 OutputFormatEnum mxflib::UUID::OutputFormat0xHex = -1;
 OutputFormatEnum mxflib::UUID::OutputFormatDottedHex = -1;
@@ -1233,16 +1258,8 @@ std::string mxflib::UUID::FormatString(UInt8 const *Ident, OutputFormatEnum Form
 		}
 	}
 
-	// If no format specified, use current default
-	if(Format == -1)
-	{
-		if(DefaultFormat == -1)
-		{
-			if(OutputFormatBraced == -1) OutputFormatBraced = MDTraitsEnum::GetNewEnum();
-			DefaultFormat = OutputFormatBraced;
-		}
-		Format = DefaultFormat;
-	}
+	// If no format specified, use current default (braced unless one has been set)
+	if(Format == -1) Format = (DefaultFormat == -1) ? OutputFormatBraced : DefaultFormat;
 
 	if(Format == OutputFormatBraced)
 	{
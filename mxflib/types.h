@@ -35,6 +35,7 @@
 
 // Standard library includes
 #include <list>
+#include <vector>
 
 #ifdef _WIN32
 #pragma warning(disable : 4995) //turn off warnings about sprintf deprecated
@@ -161,6 +162,22 @@ namespace mxflib
 	//! 16-byte identifier
 	typedef Identifier<16> Identifier16;
 
+	//! A constant Universal Label, held as a pointer to its 16 bytes
+	/*! This is a POD type, so a const ULConst at namespace scope is initialized at compile time and needs no static
+	 *  constructor, unlike a UL which is reference counted. It converts to a UL wherever one is required and may be
+	 *  compared with a UL without one being created.
+	 */
+	struct ULConst
+	{
+		const UInt8 *Data;								//!< The 16 bytes of the UL
+
+		//! Get the bytes of this UL
+		const UInt8 *GetValue(void) const { return Data; }
+
+		//! Produce a human-readable string in one of the "standard" formats
+		std::string GetString(OutputFormatEnum Format = -1) const;
+	};
+
 	//! Universal Label class with optimized comparison and string formatting
 	class UL : public RefCount<UL>, public Identifier16
 	{
@@ -195,6 +212,9 @@ namespace mxflib
 		UL(const UInt8 *ID) : Identifier16(ID) {};
 		UL( std::string const & ID);
 
+		//! Construct a UL from a constant UL
+		UL(const ULConst &ID) : Identifier16(ID.Data) {};
+
 		//! Construct a UL as a copy of another UL
 		UL(const SmartPtr<UL> ID) { if(!ID) memset(Ident,0,16); else memcpy(Ident,ID->Ident, 16); };
 
@@ -212,14 +232,33 @@ namespace mxflib
 		UL(const UUID *RHS) { operator=(*RHS); }
 
 		//! Fast compare a UL based on testing most-likely to fail bytes first
-		bool operator==(const UL &RHS) const;
+		bool operator==(const UL &RHS) const { return Equals(RHS.Ident); }
+
+		//! Fast compare with a constant UL
+		bool operator==(const ULConst &RHS) const { return Equals(RHS.Data); }
 
 		//! Simple != implementation
-		bool operator!=(const UL& Other) const { return !operator==(Other); }
+		bool operator!=(const UL& Other) const { return !Equals(Other.Ident); }
+
+		//! Simple != implementation for constant ULs
+		bool operator!=(const ULConst& Other) const { return !Equals(Other.Data); }
+
+		//! Fast compare with the 16 bytes of a UL based on testing most-likely to fail bytes first
+		bool Equals(const UInt8 *RHS) const;
 
 		//! Fast compare of effective values of UL based on testing most-likely to fail bytes first
 		/*! DRAGONS: This comparison ignores the UL version number and group coding */
-		bool Matches(const UL &RHS) const;
+		bool Matches(const UL &RHS) const { return Matches(RHS.Ident); }
+
+		//! Fast compare of effective values with a constant UL, ignoring the UL version number and group coding
+		bool Matches(const ULConst &RHS) const { return Matches(RHS.Data); }
+
+		//! Fast compare of effective values with the 16 bytes of a UL, ignoring the UL version number and group coding
+		bool Matches(const UInt8 *RHS) const { return Matches(Ident, RHS); }
+
+		//! Fast compare of effective values of two ULs held as 16 bytes, ignoring the UL version number and group coding
+		/*! Group coding is only ignored if LHS is a group key. This allows keys read from a file to be compared without building a UL */
+		static bool Matches(const UInt8 *LHS, const UInt8 *RHS);
 
 		//! Set a UL from a UUID, does end swapping
 		UL &operator=(const UUID &RHS);
@@ -249,6 +288,15 @@ namespace mxflib
 		static std::string FormatString(UInt8 const *Ident, OutputFormatEnum Format = -1);
 	};
 
+	//! Produce a human-readable string in one of the "standard" formats
+	inline std::string ULConst::GetString(OutputFormatEnum Format /*=-1*/) const { return UL::FormatString(Data, Format); }
+
+	//! Compare a constant UL with a UL
+	inline bool operator==(const ULConst &LHS, const UL &RHS) { return RHS.Equals(LHS.Data); }
+
+	//! Compare a constant UL with a UL
+	inline bool operator!=(const ULConst &LHS, const UL &RHS) { return !RHS.Equals(LHS.Data); }
+
 	//! A smart pointer to a UL object
 	typedef SmartPtr<UL> ULPtr;
 
@@ -257,6 +305,242 @@ namespace mxflib
 }
 
 
+namespace mxflib
+{
+	//! Open-addressing hash table keyed by UL, for fast dictionary lookups
+	/*! The hash ignores the UL version number (byte 8) so all versions of a UL share the same probe sequence, and both
+	 *  an exact lookup and a version-insensitive lookup are made with a single probe (normally only one slot is visited).
+	 *  \note Entries cannot be removed individually - use clear()
+	 */
+	template<class T> class ULHashMap
+	{
+	protected:
+		//! A slot in the table
+		struct Entry
+		{
+			UInt8 Key[16];					//!< The full UL of this entry (held as bytes as a UL carries reference counting overheads)
+			T Value;						//!< The value stored against this UL
+			UInt32 Serial;					//!< Order in which this entry was last set, used to select the newest version-insensitive match
+			bool Used;						//!< True if this slot holds an entry
+
+			Entry() : Serial(0), Used(false) { memset(Key, 0, 16); }
+		};
+
+		std::vector<Entry> Table;			//!< The slots, the size is always zero or a power of two
+		size_t Count;						//!< Number of used slots
+		UInt32 NextSerial;					//!< Serial number for the next entry set
+
+	public:
+		ULHashMap() : Count(0), NextSerial(0) {}
+
+		//! Hash a UL, ignoring the version number
+		static size_t Hash(const UInt8 *Key)
+		{
+			UInt8 First[8];
+			memcpy(First, Key, 8);
+			First[7] = 0;
+
+			UInt64 a, b;
+			memcpy(&a, First, 8);
+			memcpy(&b, &Key[8], 8);
+
+			// DRAGONS: The high half is folded down before multiplying, as a multiply only carries changes upwards
+			//          and private ULs often differ only in their last few bytes
+			UInt64 h = (a * UINT64_C(0x9e3779b97f4a7c15)) ^ b;
+			h ^= h >> 32;
+			h *= UINT64_C(0xc2b2ae3d27d4eb4f);
+			return static_cast<size_t>(h ^ (h >> 29));
+		}
+
+		//! Compare two ULs ignoring the version number
+		static bool MatchesVersionless(const UInt8 *a, const UInt8 *b)
+		{
+			return (memcmp(&a[8], &b[8], 8) == 0) && (memcmp(a, b, 7) == 0);
+		}
+
+		//! Remove all entries
+		void clear(void) { Table.clear(); Count = 0; NextSerial = 0; }
+
+		//! Number of entries
+		size_t size(void) const { return Count; }
+
+		//! Determine if there are no entries
+		bool empty(void) const { return Count == 0; }
+
+		//! Set the value for a UL, replacing any existing value for exactly the same UL
+		void Set(const UL &Key, const T &Value)
+		{
+			Entry *Slot = Locate(Key.GetValue());
+			if(!Slot->Used) { memcpy(Slot->Key, Key.GetValue(), 16); Slot->Used = true; Count++; }
+			Slot->Value = Value;
+			Slot->Serial = NextSerial++;
+		}
+
+		//! Add a value for a UL, unless there is already a value for exactly the same UL
+		/*! \return true if added, false if the UL was already present
+		 */
+		bool Insert(const UL &Key, const T &Value) { return Insert(Key.GetValue(), Value); }
+
+		//! Add a value for the UL held in 16 bytes, unless there is already a value for exactly the same UL
+		/*! \return true if added, false if the UL was already present
+		 */
+		bool Insert(const UInt8 *Key, const T &Value)
+		{
+			Entry *Slot = Locate(Key);
+			if(Slot->Used) return false;
+
+			memcpy(Slot->Key, Key, 16);
+			Slot->Used = true;
+			Slot->Value = Value;
+			Slot->Serial = NextSerial++;
+			Count++;
+			return true;
+		}
+
+		//! Find the value for exactly this UL
+		/*! \return Pointer to the value, or NULL if not found
+		 */
+		const T *Find(const UL &Key) const { return Find(Key.GetValue()); }
+
+		//! Find the value for exactly the UL held in 16 bytes
+		/*! \return Pointer to the value, or NULL if not found
+		 */
+		const T *Find(const UInt8 *KeyVal) const
+		{
+			if(Table.empty()) return NULL;
+
+			size_t Mask = Table.size() - 1;
+			for(size_t i = Hash(KeyVal) & Mask; Table[i].Used; i = (i + 1) & Mask)
+			{
+				if(memcmp(Table[i].Key, KeyVal, 16) == 0) return &Table[i].Value;
+			}
+
+			return NULL;
+		}
+
+		//! Find the value for this UL, or if not found and it is a SMPTE UL, the newest value for any other version of it
+		/*! \return Pointer to the value, or NULL if not found
+		 */
+		const T *FindVersionless(const UL &Key) const
+		{
+			if(Table.empty()) return NULL;
+
+			const UInt8 *KeyVal = Key.GetValue();
+			bool SMPTE = (KeyVal[0] == 0x06) && (KeyVal[1] == 0x0e) && (KeyVal[2] == 0x2b) && (KeyVal[3] == 0x34);
+
+			const Entry *Best = NULL;
+			size_t Mask = Table.size() - 1;
+			for(size_t i = Hash(KeyVal) & Mask; Table[i].Used; i = (i + 1) & Mask)
+			{
+				const UInt8 *ThisKey = Table[i].Key;
+				if(!MatchesVersionless(ThisKey, KeyVal)) continue;
+
+				if(ThisKey[7] == KeyVal[7]) return &Table[i].Value;
+				if(SMPTE && ((!Best) || (Table[i].Serial > Best->Serial))) Best = &Table[i];
+			}
+
+			return Best ? &Best->Value : NULL;
+		}
+
+		//! Find the most recently set value for any version of the UL held in 16 bytes, including this exact version
+		/*! \return Pointer to the value, or NULL if not found
+		 */
+		const T *FindNewestVersion(const UInt8 *KeyVal) const
+		{
+			size_t Index = NewestVersionIndex(KeyVal);
+			return (Index < Table.size()) ? &Table[Index].Value : NULL;
+		}
+
+		//! Find the most recently set value for any version of the UL held in 16 bytes, so that it can be modified
+		/*! \return Pointer to the value, or NULL if not found
+		 */
+		T *FindNewestVersion(const UInt8 *KeyVal)
+		{
+			size_t Index = NewestVersionIndex(KeyVal);
+			return (Index < Table.size()) ? &Table[Index].Value : NULL;
+		}
+
+		//! Iterator for visiting every entry, in no particular order
+		class const_iterator
+		{
+		protected:
+			const std::vector<Entry> *Table;	//!< The table being iterated
+			size_t Index;						//!< Index of the current slot, or the table size at the end
+
+		public:
+			const_iterator(const std::vector<Entry> *Table, size_t Start) : Table(Table), Index(Start)
+			{
+				while((Index < Table->size()) && !(*Table)[Index].Used) Index++;
+			}
+
+			//! Get the bytes of the UL of the current entry
+			const UInt8 *Key(void) const { return (*Table)[Index].Key; }
+
+			//! Get the value of the current entry
+			const T &Value(void) const { return (*Table)[Index].Value; }
+
+			const_iterator &operator++() { do Index++; while((Index < Table->size()) && !(*Table)[Index].Used); return *this; }
+			bool operator==(const const_iterator &Other) const { return Index == Other.Index; }
+			bool operator!=(const const_iterator &Other) const { return Index != Other.Index; }
+		};
+
+		const_iterator begin(void) const { return const_iterator(&Table, 0); }
+		const_iterator end(void) const { return const_iterator(&Table, Table.size()); }
+
+	protected:
+		//! Locate the slot holding exactly this UL, or the empty slot where it should be added, growing the table if required
+		Entry *Locate(const UInt8 *KeyVal)
+		{
+			// Keep the table no more than half full so probe sequences stay short
+			if((Count + 1) * 2 > Table.size()) Rehash(Table.empty() ? 64 : Table.size() * 2);
+
+			size_t Mask = Table.size() - 1;
+			size_t i = Hash(KeyVal) & Mask;
+			while(Table[i].Used && (memcmp(Table[i].Key, KeyVal, 16) != 0)) i = (i + 1) & Mask;
+
+			return &Table[i];
+		}
+
+		//! Locate the slot holding the most recently set value for any version of this UL
+		/*! \return The index of the slot, or the table size if not found
+		 */
+		size_t NewestVersionIndex(const UInt8 *KeyVal) const
+		{
+			if(Table.empty()) return 0;
+
+			size_t Best = Table.size();
+			size_t Mask = Table.size() - 1;
+			for(size_t i = Hash(KeyVal) & Mask; Table[i].Used; i = (i + 1) & Mask)
+			{
+				if(MatchesVersionless(Table[i].Key, KeyVal) && ((Best == Table.size()) || (Table[i].Serial > Table[Best].Serial))) Best = i;
+			}
+
+			return Best;
+		}
+
+		//! Move all entries into a new table of the given size (which must be a power of two)
+		void Rehash(size_t NewSize)
+		{
+			std::vector<Entry> Old(NewSize);
+			Old.swap(Table);
+
+			size_t Mask = NewSize - 1;
+			typename std::vector<Entry>::iterator it = Old.begin();
+			while(it != Old.end())
+			{
+				if((*it).Used)
+				{
+					size_t i = Hash((*it).Key) & Mask;
+					while(Table[i].Used) i = (i + 1) & Mask;
+					Table[i] = *it;
+				}
+				it++;
+			}
+		}
+	};
+}
+
+
 namespace mxflib
 {
 	//! Universally Unique Identifier class with string formatting
@@ -655,17 +939,36 @@ namespace mxflib
 		std::string Detail; 							//!< The human-readable description for this label
 
 	protected:
-		//! Type of the Label map (map of UL to LabelPtr)
-		typedef std::map<UL, LabelPtr> LabelULMap;
+		//! Type of the Label map (hash table of UL to LabelPtr)
+		typedef ULHashMap<LabelPtr> LabelULMap;
+
+		//! A masked label, with the order in which it was added (used to choose between equally good matches)
+		struct MaskedEntry
+		{
+			LabelPtr Entry;								//!< The label
+			UInt32 Serial;								//!< Order in which the label was added
+		};
+
+		//! All masked labels that share the same mask, hashed by their value with the masked bits cleared
+		struct MaskGroup
+		{
+			UInt8 Mask[16];								//!< The mask shared by all labels in this group
+			int Bits;									//!< Number of mask bits set
+			ULHashMap<MaskedEntry> Labels;				//!< Labels keyed by their value with the masked bits cleared
+		};
 
-		//! Type of the Label multi-map (map of UL to LabelPtr)
-		typedef std::multimap<UL, LabelPtr> LabelULMultiMap;
+		//! Type of the list of masked label groups
+		typedef std::vector<MaskGroup> MaskGroupList;
 
 		//! Map of all existing labels that don't use masking
 		static LabelULMap LabelMap;
 
-		//! Map of all existing labels that use masking - this is a multimap to allow the same base with different masks
-		static LabelULMultiMap LabelMultiMap;
+		//! All existing labels that use masking, grouped by mask and sorted by increasing number of mask bits
+		/*! DRAGONS: There are only ever a few distinct masks, so a masked search makes one hash lookup per mask however many labels exist */
+		static MaskGroupList MaskGroups;
+
+		//! Number of masked labels added so far
+		static UInt32 MaskedCount;
 
 	protected:
 		// Private constructor - to build a new label one of the Insert() functions must be called
@@ -712,6 +1015,10 @@ namespace mxflib
 		//! Return true if this label uses a (non-zero) mask
 		bool HasMask(void) { return NonZeroMask; }
 
+	protected:
+		//! Add a masked label to the mask groups
+		static void AddMasked(LabelPtr &NewLabel);
+
 	public:
 		//! Construct and add a label from a byte array
 		/*! \return true if succeeded, else false
@@ -2,1578 +2,1578 @@
 	namespace mxflib
 	{
 		const UInt8 AES3PCMDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00 };
-		const UL AES3PCMDescriptor_UL(AES3PCMDescriptor_UL_Data);
+		const ULConst AES3PCMDescriptor_UL = { AES3PCMDescriptor_UL_Data };
 
 		const UInt8 ANCDataDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5c, 0x00 };
-		const UL ANCDataDescriptor_UL(ANCDataDescriptor_UL_Data);
+		const ULConst ANCDataDescriptor_UL = { ANCDataDescriptor_UL_Data };
 
 		const UInt8 ATSCA52_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x04, 0x02, 0x02, 0x02, 0x03, 0x02, 0x01, 0x00 };
-		const UL ATSCA52_UL(ATSCA52_UL_Data);
+		const ULConst ATSCA52_UL = { ATSCA52_UL_Data };
 
 		const UInt8 AUID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL AUID_UL(AUID_UL_Data);
+		const ULConst AUID_UL = { AUID_UL_Data };
 
 		const UInt8 AUIDArray_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL AUIDArray_UL(AUIDArray_UL_Data);
+		const ULConst AUIDArray_UL = { AUIDArray_UL_Data };
 
 		const UInt8 AUIDSet_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL AUIDSet_UL(AUIDSet_UL_Data);
+		const ULConst AUIDSet_UL = { AUIDSet_UL_Data };
 
 		const UInt8 AUL_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL AUL_UL(AUL_UL_Data);
+		const ULConst AUL_UL = { AUL_UL_Data };
 
 		const UInt8 AbstractObject_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7f, 0x00 };
-		const UL AbstractObject_UL(AbstractObject_UL_Data);
+		const ULConst AbstractObject_UL = { AbstractObject_UL_Data };
 
 		const UInt8 ActiveFormatDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x03, 0x02, 0x09, 0x00, 0x00, 0x00 };
-		const UL ActiveFormatDescriptor_UL(ActiveFormatDescriptor_UL_Data);
+		const ULConst ActiveFormatDescriptor_UL = { ActiveFormatDescriptor_UL_Data };
 
 		const UInt8 AlphaMaxRef_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x0d, 0x00, 0x00, 0x00 };
-		const UL AlphaMaxRef_UL(AlphaMaxRef_UL_Data);
+		const ULConst AlphaMaxRef_UL = { AlphaMaxRef_UL_Data };
 
 		const UInt8 AlphaMinRef_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x0e, 0x00, 0x00, 0x00 };
-		const UL AlphaMinRef_UL(AlphaMinRef_UL_Data);
+		const ULConst AlphaMinRef_UL = { AlphaMinRef_UL_Data };
 
 		const UInt8 AlphaSampleDepth_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x07, 0x00, 0x00, 0x00 };
-		const UL AlphaSampleDepth_UL(AlphaSampleDepth_UL_Data);
+		const ULConst AlphaSampleDepth_UL = { AlphaSampleDepth_UL_Data };
 
 		const UInt8 AlphaTransparency_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00 };
-		const UL AlphaTransparency_UL(AlphaTransparency_UL_Data);
+		const ULConst AlphaTransparency_UL = { AlphaTransparency_UL_Data };
 
 		const UInt8 AnnotationSource_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x02, 0x0a, 0x00, 0x00 };
-		const UL AnnotationSource_UL(AnnotationSource_UL_Data);
+		const ULConst AnnotationSource_UL = { AnnotationSource_UL_Data };
 
 		const UInt8 ApplicationEnvironmentID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x05, 0x20, 0x07, 0x01, 0x0f, 0x00, 0x00, 0x00 };
-		const UL ApplicationEnvironmentID_UL(ApplicationEnvironmentID_UL_Data);
+		const ULConst ApplicationEnvironmentID_UL = { ApplicationEnvironmentID_UL_Data };
 
 		const UInt8 ApplicationObject_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x66, 0x00 };
-		const UL ApplicationObject_UL(ApplicationObject_UL_Data);
+		const ULConst ApplicationObject_UL = { ApplicationObject_UL_Data };
 
 		const UInt8 ApplicationPluginBatch_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x06, 0x01, 0x01, 0x04, 0x02, 0x0e, 0x00, 0x00 };
-		const UL ApplicationPluginBatch_UL(ApplicationPluginBatch_UL_Data);
+		const ULConst ApplicationPluginBatch_UL = { ApplicationPluginBatch_UL_Data };
 
 		const UInt8 ApplicationPluginInstanceID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x05, 0x20, 0x07, 0x01, 0x0d, 0x00, 0x00, 0x00 };
-		const UL ApplicationPluginInstanceID_UL(ApplicationPluginInstanceID_UL_Data);
+		const ULConst ApplicationPluginInstanceID_UL = { ApplicationPluginInstanceID_UL_Data };
 
 		const UInt8 ApplicationPluginObject_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x61, 0x00 };
-		const UL ApplicationPluginObject_UL(ApplicationPluginObject_UL_Data);
+		const ULConst ApplicationPluginObject_UL = { ApplicationPluginObject_UL_Data };
 
 		const UInt8 ApplicationReferencedObject_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x62, 0x00 };
-		const UL ApplicationReferencedObject_UL(ApplicationReferencedObject_UL_Data);
+		const ULConst ApplicationReferencedObject_UL = { ApplicationReferencedObject_UL_Data };
 
 		const UInt8 ApplicationScheme_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x04, 0x06, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00 };
-		const UL ApplicationScheme_UL(ApplicationScheme_UL_Data);
+		const ULConst ApplicationScheme_UL = { ApplicationScheme_UL_Data };
 
 		const UInt8 ApplicationSchemesBatch_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x01, 0x02, 0x02, 0x10, 0x02, 0x03, 0x00, 0x00 };
-		const UL ApplicationSchemesBatch_UL(ApplicationSchemesBatch_UL_Data);
+		const ULConst ApplicationSchemesBatch_UL = { ApplicationSchemesBatch_UL_Data };
 
 		const UInt8 AspectRatio_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00 };
-		const UL AspectRatio_UL(AspectRatio_UL_Data);
+		const ULConst AspectRatio_UL = { AspectRatio_UL_Data };
 
 		const UInt8 AudioRefLevel_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00 };
-		const UL AudioRefLevel_UL(AudioRefLevel_UL_Data);
+		const ULConst AudioRefLevel_UL = { AudioRefLevel_UL_Data };
 
 		const UInt8 AudioSamplingRate_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x03, 0x01, 0x01, 0x01, 0x00, 0x00 };
-		const UL AudioSamplingRate_UL(AudioSamplingRate_UL_Data);
+		const ULConst AudioSamplingRate_UL = { AudioSamplingRate_UL_Data };
 
 		const UInt8 AuxBitsMode_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00 };
-		const UL AuxBitsMode_UL(AuxBitsMode_UL_Data);
+		const ULConst AuxBitsMode_UL = { AuxBitsMode_UL_Data };
 
 		const UInt8 AvgBps_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x03, 0x03, 0x05, 0x00, 0x00, 0x00 };
-		const UL AvgBps_UL(AvgBps_UL_Data);
+		const ULConst AvgBps_UL = { AvgBps_UL_Data };
 
 		const UInt8 BPictureCount_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x09, 0x00, 0x00 };
-		const UL BPictureCount_UL(BPictureCount_UL_Data);
+		const ULConst BPictureCount_UL = { BPictureCount_UL_Data };
 
 		const UInt8 BaseClass_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x06, 0x01, 0x01, 0x04, 0x01, 0x0b, 0x00, 0x00 };
-		const UL BaseClass_UL(BaseClass_UL_Data);
+		const ULConst BaseClass_UL = { BaseClass_UL_Data };
 
 		const UInt8 BitRate_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x0b, 0x00, 0x00 };
-		const UL BitRate_UL(BitRate_UL_Data);
+		const ULConst BitRate_UL = { BitRate_UL_Data };
 
 		const UInt8 BlackRefLevel_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00 };
-		const UL BlackRefLevel_UL(BlackRefLevel_UL_Data);
+		const ULConst BlackRefLevel_UL = { BlackRefLevel_UL_Data };
 
 		const UInt8 BlockAlign_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00 };
-		const UL BlockAlign_UL(BlockAlign_UL_Data);
+		const ULConst BlockAlign_UL = { BlockAlign_UL_Data };
 
 		const UInt8 BlockStartOffset_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x03, 0x02, 0x03, 0x00, 0x00, 0x00 };
-		const UL BlockStartOffset_UL(BlockStartOffset_UL_Data);
+		const ULConst BlockStartOffset_UL = { BlockStartOffset_UL_Data };
 
 		const UInt8 BodyOffset_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x06, 0x08, 0x01, 0x02, 0x01, 0x03, 0x00, 0x00 };
-		const UL BodyOffset_UL(BodyOffset_UL_Data);
+		const ULConst BodyOffset_UL = { BodyOffset_UL_Data };
 
 		const UInt8 BodySID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x01, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00 };
-		const UL BodySID_UL(BodySID_UL_Data);
+		const ULConst BodySID_UL = { BodySID_UL_Data };
 
 		const UInt8 Boolean_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL Boolean_UL(Boolean_UL_Data);
+		const ULConst Boolean_UL = { Boolean_UL_Data };
 
 		const UInt8 Build_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00 };
-		const UL Build_UL(Build_UL_Data);
+		const ULConst Build_UL = { Build_UL_Data };
 
 		const UInt8 CDCIEssenceDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00 };
-		const UL CDCIEssenceDescriptor_UL(CDCIEssenceDescriptor_UL_Data);
+		const ULConst CDCIEssenceDescriptor_UL = { CDCIEssenceDescriptor_UL_Data };
 
 		const UInt8 ChannelAssignment_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x07, 0x04, 0x02, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00 };
-		const UL ChannelAssignment_UL(ChannelAssignment_UL_Data);
+		const ULConst ChannelAssignment_UL = { ChannelAssignment_UL_Data };
 
 		const UInt8 ChannelCount_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x00 };
-		const UL ChannelCount_UL(ChannelCount_UL_Data);
+		const ULConst ChannelCount_UL = { ChannelCount_UL_Data };
 
 		const UInt8 ChannelIDs_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x03, 0x07, 0x00, 0x00, 0x00 };
-		const UL ChannelIDs_UL(ChannelIDs_UL_Data);
+		const ULConst ChannelIDs_UL = { ChannelIDs_UL_Data };
 
 		const UInt8 ChannelStatusMode_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x02, 0x00, 0x00, 0x00 };
-		const UL ChannelStatusMode_UL(ChannelStatusMode_UL_Data);
+		const ULConst ChannelStatusMode_UL = { ChannelStatusMode_UL_Data };
 
 		const UInt8 ChannelStatusModeType_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x25, 0x00, 0x00, 0x00, 0x00 };
-		const UL ChannelStatusModeType_UL(ChannelStatusModeType_UL_Data);
+		const ULConst ChannelStatusModeType_UL = { ChannelStatusModeType_UL_Data };
 
 		const UInt8 ChunkData_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL ChunkData_UL(ChunkData_UL_Data);
+		const ULConst ChunkData_UL = { ChunkData_UL_Data };
 
 		const UInt8 ChunkID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x06, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00 };
-		const UL ChunkID_UL(ChunkID_UL_Data);
+		const ULConst ChunkID_UL = { ChunkID_UL_Data };
 
 		const UInt8 ChunkLength_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x06, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00 };
-		const UL ChunkLength_UL(ChunkLength_UL_Data);
+		const ULConst ChunkLength_UL = { ChunkLength_UL_Data };
 
 		const UInt8 CipherAlgorithm_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x02, 0x09, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00 };
-		const UL CipherAlgorithm_UL(CipherAlgorithm_UL_Data);
+		const ULConst CipherAlgorithm_UL = { CipherAlgorithm_UL_Data };
 
 		const UInt8 CipherAlgorithmAES128CBC_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x07, 0x02, 0x09, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00 };
-		const UL CipherAlgorithmAES128CBC_UL(CipherAlgorithmAES128CBC_UL_Data);
+		const ULConst CipherAlgorithmAES128CBC_UL = { CipherAlgorithmAES128CBC_UL_Data };
 
 		const UInt8 ClassDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x00 };
-		const UL ClassDefinition_UL(ClassDefinition_UL_Data);
+		const ULConst ClassDefinition_UL = { ClassDefinition_UL_Data };
 
 		const UInt8 ClassDefinitions_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x07, 0x00, 0x00, 0x00 };
-		const UL ClassDefinitions_UL(ClassDefinitions_UL_Data);
+		const ULConst ClassDefinitions_UL = { ClassDefinitions_UL_Data };
 
 		const UInt8 ClosedBodyPartition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x05, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x03, 0x02, 0x00 };
-		const UL ClosedBodyPartition_UL(ClosedBodyPartition_UL_Data);
+		const ULConst ClosedBodyPartition_UL = { ClosedBodyPartition_UL_Data };
 
 		const UInt8 ClosedCompleteBodyPartition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x05, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x03, 0x04, 0x00 };
-		const UL ClosedCompleteBodyPartition_UL(ClosedCompleteBodyPartition_UL_Data);
+		const ULConst ClosedCompleteBodyPartition_UL = { ClosedCompleteBodyPartition_UL_Data };
 
 		const UInt8 ClosedCompleteHeader_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x05, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x02, 0x04, 0x00 };
-		const UL ClosedCompleteHeader_UL(ClosedCompleteHeader_UL_Data);
+		const ULConst ClosedCompleteHeader_UL = { ClosedCompleteHeader_UL_Data };
 
 		const UInt8 ClosedGOP_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x06, 0x00, 0x00 };
-		const UL ClosedGOP_UL(ClosedGOP_UL_Data);
+		const ULConst ClosedGOP_UL = { ClosedGOP_UL_Data };
 
 		const UInt8 ClosedHeader_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x05, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 0x00 };
-		const UL ClosedHeader_UL(ClosedHeader_UL_Data);
+		const ULConst ClosedHeader_UL = { ClosedHeader_UL_Data };
 
 		const UInt8 Codec_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x01, 0x03, 0x00, 0x00 };
-		const UL Codec_UL(Codec_UL_Data);
+		const ULConst Codec_UL = { Codec_UL_Data };
 
 		const UInt8 CodecDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x00 };
-		const UL CodecDefinition_UL(CodecDefinition_UL_Data);
+		const ULConst CodecDefinition_UL = { CodecDefinition_UL_Data };
 
 		const UInt8 CodecDefinitions_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x05, 0x07, 0x00, 0x00 };
-		const UL CodecDefinitions_UL(CodecDefinitions_UL_Data);
+		const ULConst CodecDefinitions_UL = { CodecDefinitions_UL_Data };
 
 		const UInt8 CodedContentType_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x04, 0x00, 0x00 };
-		const UL CodedContentType_UL(CodedContentType_UL_Data);
+		const ULConst CodedContentType_UL = { CodedContentType_UL_Data };
 
 		const UInt8 CodingEquations_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x02, 0x01, 0x01, 0x03, 0x01, 0x00 };
-		const UL CodingEquations_UL(CodingEquations_UL_Data);
+		const ULConst CodingEquations_UL = { CodingEquations_UL_Data };
 
 		const UInt8 CodingStyleDefault_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x0c, 0x00, 0x00, 0x00 };
-		const UL CodingStyleDefault_UL(CodingStyleDefault_UL_Data);
+		const ULConst CodingStyleDefault_UL = { CodingStyleDefault_UL_Data };
 
 		const UInt8 ColorPrimaries_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x02, 0x01, 0x01, 0x06, 0x01, 0x00 };
-		const UL ColorPrimaries_UL(ColorPrimaries_UL_Data);
+		const ULConst ColorPrimaries_UL = { ColorPrimaries_UL_Data };
 
 		const UInt8 ColorRange_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x05, 0x00, 0x00, 0x00 };
-		const UL ColorRange_UL(ColorRange_UL_Data);
+		const ULConst ColorRange_UL = { ColorRange_UL_Data };
 
 		const UInt8 ColorSiting_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x00, 0x00, 0x00 };
-		const UL ColorSiting_UL(ColorSiting_UL_Data);
+		const ULConst ColorSiting_UL = { ColorSiting_UL_Data };
 
 		const UInt8 CommentMarker_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x00 };
-		const UL CommentMarker_UL(CommentMarker_UL_Data);
+		const ULConst CommentMarker_UL = { CommentMarker_UL_Data };
 
 		const UInt8 CompanyName_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x02, 0x01, 0x00, 0x00 };
-		const UL CompanyName_UL(CompanyName_UL_Data);
+		const ULConst CompanyName_UL = { CompanyName_UL_Data };
 
 		const UInt8 CompleteFooter_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x05, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x04, 0x04, 0x00 };
-		const UL CompleteFooter_UL(CompleteFooter_UL_Data);
+		const ULConst CompleteFooter_UL = { CompleteFooter_UL_Data };
 
 		const UInt8 ComponentDataDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL ComponentDataDefinition_UL(ComponentDataDefinition_UL_Data);
+		const ULConst ComponentDataDefinition_UL = { ComponentDataDefinition_UL_Data };
 
 		const UInt8 ComponentDepth_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x0a, 0x00, 0x00, 0x00 };
-		const UL ComponentDepth_UL(ComponentDepth_UL_Data);
+		const ULConst ComponentDepth_UL = { ComponentDepth_UL_Data };
 
 		const UInt8 ComponentLength_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x02, 0x01, 0x01, 0x03, 0x00, 0x00 };
-		const UL ComponentLength_UL(ComponentLength_UL_Data);
+		const ULConst ComponentLength_UL = { ComponentLength_UL_Data };
 
 		const UInt8 ComponentMaxRef_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x0b, 0x00, 0x00, 0x00 };
-		const UL ComponentMaxRef_UL(ComponentMaxRef_UL_Data);
+		const ULConst ComponentMaxRef_UL = { ComponentMaxRef_UL_Data };
 
 		const UInt8 ComponentMinRef_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x0c, 0x00, 0x00, 0x00 };
-		const UL ComponentMinRef_UL(ComponentMinRef_UL_Data);
+		const ULConst ComponentMinRef_UL = { ComponentMinRef_UL_Data };
 
 		const UInt8 ConstantBFrames_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x03, 0x00, 0x00 };
-		const UL ConstantBFrames_UL(ConstantBFrames_UL_Data);
+		const ULConst ConstantBFrames_UL = { ConstantBFrames_UL_Data };
 
 		const UInt8 ContainerDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x00 };
-		const UL ContainerDefinition_UL(ContainerDefinition_UL_Data);
+		const ULConst ContainerDefinition_UL = { ContainerDefinition_UL_Data };
 
 		const UInt8 ContainerDefinitions_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x05, 0x08, 0x00, 0x00 };
-		const UL ContainerDefinitions_UL(ContainerDefinitions_UL_Data);
+		const ULConst ContainerDefinitions_UL = { ContainerDefinitions_UL_Data };
 
 		const UInt8 ContainerDuration_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x06, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00 };
-		const UL ContainerDuration_UL(ContainerDuration_UL_Data);
+		const ULConst ContainerDuration_UL = { ContainerDuration_UL_Data };
 
 		const UInt8 ContentStorage_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x00 };
-		const UL ContentStorage_UL(ContentStorage_UL_Data);
+		const ULConst ContentStorage_UL = { ContentStorage_UL_Data };
 
 		const UInt8 ContentStorageObject_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x02, 0x01, 0x00, 0x00 };
-		const UL ContentStorageObject_UL(ContentStorageObject_UL_Data);
+		const ULConst ContentStorageObject_UL = { ContentStorageObject_UL_Data };
 
 		const UInt8 ContextID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x15, 0x11, 0x00, 0x00, 0x00, 0x00 };
-		const UL ContextID_UL(ContextID_UL_Data);
+		const ULConst ContextID_UL = { ContextID_UL_Data };
 
 		const UInt8 ContextIDLink_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x06, 0x01, 0x01, 0x06, 0x03, 0x00, 0x00, 0x00 };
-		const UL ContextIDLink_UL(ContextIDLink_UL_Data);
+		const ULConst ContextIDLink_UL = { ContextIDLink_UL_Data };
 
 		const UInt8 ContextSR_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x06, 0x01, 0x01, 0x04, 0x02, 0x0d, 0x00, 0x00 };
-		const UL ContextSR_UL(ContextSR_UL_Data);
+		const ULConst ContextSR_UL = { ContextSR_UL_Data };
 
 		const UInt8 CryptographicContext_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x02, 0x02, 0x00, 0x00 };
-		const UL CryptographicContext_UL(CryptographicContext_UL_Data);
+		const ULConst CryptographicContext_UL = { CryptographicContext_UL_Data };
 
 		const UInt8 CryptographicFramework_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x02, 0x01, 0x00, 0x00 };
-		const UL CryptographicFramework_UL(CryptographicFramework_UL_Data);
+		const ULConst CryptographicFramework_UL = { CryptographicFramework_UL_Data };
 
 		const UInt8 CryptographicFrameworkLabel_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x07, 0x0d, 0x01, 0x04, 0x01, 0x02, 0x01, 0x01, 0x00 };
-		const UL CryptographicFrameworkLabel_UL(CryptographicFrameworkLabel_UL_Data);
+		const ULConst CryptographicFrameworkLabel_UL = { CryptographicFrameworkLabel_UL_Data };
 
 		const UInt8 CryptographicKeyID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x02, 0x09, 0x03, 0x01, 0x02, 0x00, 0x00, 0x00 };
-		const UL CryptographicKeyID_UL(CryptographicKeyID_UL_Data);
+		const ULConst CryptographicKeyID_UL = { CryptographicKeyID_UL_Data };
 
 		const UInt8 Csiz_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x0a, 0x00, 0x00, 0x00 };
-		const UL Csiz_UL(Csiz_UL_Data);
+		const ULConst Csiz_UL = { Csiz_UL_Data };
 
 		const UInt8 DMFramework_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x04, 0x02, 0x0c, 0x00, 0x00 };
-		const UL DMFramework_UL(DMFramework_UL_Data);
+		const ULConst DMFramework_UL = { DMFramework_UL_Data };
 
 		const UInt8 DMS1_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x01, 0x00, 0x00, 0x00 };
-		const UL DMS1_UL(DMS1_UL_Data);
+		const ULConst DMS1_UL = { DMS1_UL_Data };
 
 		const UInt8 DMS1Clip_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x04, 0x0d, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x01 };
-		const UL DMS1Clip_UL(DMS1Clip_UL_Data);
+		const ULConst DMS1Clip_UL = { DMS1Clip_UL_Data };
 
 		const UInt8 DMS1ClipExtended_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x04, 0x0d, 0x01, 0x04, 0x01, 0x01, 0x02, 0x02, 0x02 };
-		const UL DMS1ClipExtended_UL(DMS1ClipExtended_UL_Data);
+		const ULConst DMS1ClipExtended_UL = { DMS1ClipExtended_UL_Data };
 
 		const UInt8 DMS1Production_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x04, 0x0d, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01 };
-		const UL DMS1Production_UL(DMS1Production_UL_Data);
+		const ULConst DMS1Production_UL = { DMS1Production_UL_Data };
 
 		const UInt8 DMS1ProductionExtended_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x04, 0x0d, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x02 };
-		const UL DMS1ProductionExtended_UL(DMS1ProductionExtended_UL_Data);
+		const ULConst DMS1ProductionExtended_UL = { DMS1ProductionExtended_UL_Data };
 
 		const UInt8 DMS1Scene_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x04, 0x0d, 0x01, 0x04, 0x01, 0x01, 0x02, 0x03, 0x01 };
-		const UL DMS1Scene_UL(DMS1Scene_UL_Data);
+		const ULConst DMS1Scene_UL = { DMS1Scene_UL_Data };
 
 		const UInt8 DMS1SceneExtended_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x04, 0x0d, 0x01, 0x04, 0x01, 0x01, 0x02, 0x03, 0x02 };
-		const UL DMS1SceneExtended_UL(DMS1SceneExtended_UL_Data);
+		const ULConst DMS1SceneExtended_UL = { DMS1SceneExtended_UL_Data };
 
 		const UInt8 DMSCrypto_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x07, 0x0d, 0x01, 0x04, 0x01, 0x02, 0x00, 0x00, 0x00 };
-		const UL DMSCrypto_UL(DMSCrypto_UL_Data);
+		const ULConst DMSCrypto_UL = { DMSCrypto_UL_Data };
 
 		const UInt8 DMSchemes_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x01, 0x02, 0x02, 0x10, 0x02, 0x02, 0x00, 0x00 };
-		const UL DMSchemes_UL(DMSchemes_UL_Data);
+		const ULConst DMSchemes_UL = { DMSchemes_UL_Data };
 
 		const UInt8 DMSegment_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x00 };
-		const UL DMSegment_UL(DMSegment_UL_Data);
+		const ULConst DMSegment_UL = { DMSegment_UL_Data };
 
 		const UInt8 DMSourceClip_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x45, 0x00 };
-		const UL DMSourceClip_UL(DMSourceClip_UL_Data);
+		const ULConst DMSourceClip_UL = { DMSourceClip_UL_Data };
 
 		const UInt8 DMSourceClipTrackIDs_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x01, 0x07, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00 };
-		const UL DMSourceClipTrackIDs_UL(DMSourceClipTrackIDs_UL_Data);
+		const ULConst DMSourceClipTrackIDs_UL = { DMSourceClipTrackIDs_UL_Data };
 
 		const UInt8 DM_Framework_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00 };
-		const UL DM_Framework_UL(DM_Framework_UL_Data);
+		const ULConst DM_Framework_UL = { DM_Framework_UL_Data };
 
 		const UInt8 DM_Set_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL DM_Set_UL(DM_Set_UL_Data);
+		const ULConst DM_Set_UL = { DM_Set_UL_Data };
 
 		const UInt8 DataDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1b, 0x00 };
-		const UL DataDefinition_UL(DataDefinition_UL_Data);
+		const ULConst DataDefinition_UL = { DataDefinition_UL_Data };
 
 		const UInt8 DataDefinitions_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x05, 0x05, 0x00, 0x00 };
-		const UL DataDefinitions_UL(DataDefinitions_UL_Data);
+		const ULConst DataDefinitions_UL = { DataDefinitions_UL_Data };
 
 		const UInt8 DataEssenceCoding_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x03, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00 };
-		const UL DataEssenceCoding_UL(DataEssenceCoding_UL_Data);
+		const ULConst DataEssenceCoding_UL = { DataEssenceCoding_UL_Data };
 
 		const UInt8 DataEssenceTrack_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00 };
-		const UL DataEssenceTrack_UL(DataEssenceTrack_UL_Data);
+		const ULConst DataEssenceTrack_UL = { DataEssenceTrack_UL_Data };
 
 		const UInt8 DataValue_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x04, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL DataValue_UL(DataValue_UL_Data);
+		const ULConst DataValue_UL = { DataValue_UL_Data };
 
 		const UInt8 DateStruct_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL DateStruct_UL(DateStruct_UL_Data);
+		const ULConst DateStruct_UL = { DateStruct_UL_Data };
 
 		const UInt8 Day_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00 };
-		const UL Day_UL(Day_UL_Data);
+		const ULConst Day_UL = { Day_UL_Data };
 
 		const UInt8 DefinitionObject_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x00 };
-		const UL DefinitionObject_UL(DefinitionObject_UL_Data);
+		const ULConst DefinitionObject_UL = { DefinitionObject_UL_Data };
 
 		const UInt8 DefinitionObjectDescription_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x03, 0x01, 0x02, 0x01, 0x00, 0x00 };
-		const UL DefinitionObjectDescription_UL(DefinitionObjectDescription_UL_Data);
+		const ULConst DefinitionObjectDescription_UL = { DefinitionObjectDescription_UL_Data };
 
 		const UInt8 DefinitionObjectIdentification_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x15, 0x03, 0x00, 0x00, 0x00, 0x00 };
-		const UL DefinitionObjectIdentification_UL(DefinitionObjectIdentification_UL_Data);
+		const ULConst DefinitionObjectIdentification_UL = { DefinitionObjectIdentification_UL_Data };
 
 		const UInt8 DefinitionObjectName_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x07, 0x01, 0x02, 0x03, 0x01, 0x00, 0x00 };
-		const UL DefinitionObjectName_UL(DefinitionObjectName_UL_Data);
+		const ULConst DefinitionObjectName_UL = { DefinitionObjectName_UL_Data };
 
 		const UInt8 DeltaEntryArray_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x04, 0x04, 0x01, 0x06, 0x00, 0x00, 0x00 };
-		const UL DeltaEntryArray_UL(DeltaEntryArray_UL_Data);
+		const ULConst DeltaEntryArray_UL = { DeltaEntryArray_UL_Data };
 
 		const UInt8 Denominator_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00 };
-		const UL Denominator_UL(Denominator_UL_Data);
+		const ULConst Denominator_UL = { Denominator_UL_Data };
 
 		const UInt8 DescriptiveMetadataApplicationEnvironmentID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x05, 0x20, 0x07, 0x01, 0x10, 0x00, 0x00, 0x00 };
-		const UL DescriptiveMetadataApplicationEnvironmentID_UL(DescriptiveMetadataApplicationEnvironmentID_UL_Data);
+		const ULConst DescriptiveMetadataApplicationEnvironmentID_UL = { DescriptiveMetadataApplicationEnvironmentID_UL_Data };
 
 		const UInt8 DescriptiveMetadataPluginID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x05, 0x20, 0x07, 0x01, 0x0e, 0x00, 0x00, 0x00 };
-		const UL DescriptiveMetadataPluginID_UL(DescriptiveMetadataPluginID_UL_Data);
+		const ULConst DescriptiveMetadataPluginID_UL = { DescriptiveMetadataPluginID_UL_Data };
 
 		const UInt8 DescriptiveMetadataScheme_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x04, 0x06, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00 };
-		const UL DescriptiveMetadataScheme_UL(DescriptiveMetadataScheme_UL_Data);
+		const ULConst DescriptiveMetadataScheme_UL = { DescriptiveMetadataScheme_UL_Data };
 
 		const UInt8 DescriptiveMetadataTrack_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x10, 0x00, 0x00, 0x00 };
-		const UL DescriptiveMetadataTrack_UL(DescriptiveMetadataTrack_UL_Data);
+		const ULConst DescriptiveMetadataTrack_UL = { DescriptiveMetadataTrack_UL_Data };
 
 		const UInt8 Descriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x02, 0x03, 0x00, 0x00 };
-		const UL Descriptor_UL(Descriptor_UL_Data);
+		const ULConst Descriptor_UL = { Descriptor_UL_Data };
 
 		const UInt8 DialNorm_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00 };
-		const UL DialNorm_UL(DialNorm_UL_Data);
+		const ULConst DialNorm_UL = { DialNorm_UL_Data };
 
 		const UInt8 DictReferenceCodecDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x01, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL DictReferenceCodecDefinition_UL(DictReferenceCodecDefinition_UL_Data);
+		const ULConst DictReferenceCodecDefinition_UL = { DictReferenceCodecDefinition_UL_Data };
 
 		const UInt8 DictReferenceContainerDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL DictReferenceContainerDefinition_UL(DictReferenceContainerDefinition_UL_Data);
+		const ULConst DictReferenceContainerDefinition_UL = { DictReferenceContainerDefinition_UL_Data };
 
 		const UInt8 DictReferenceDataDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL DictReferenceDataDefinition_UL(DictReferenceDataDefinition_UL_Data);
+		const ULConst DictReferenceDataDefinition_UL = { DictReferenceDataDefinition_UL_Data };
 
 		const UInt8 DictReferenceVectorDataDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL DictReferenceVectorDataDefinition_UL(DictReferenceVectorDataDefinition_UL_Data);
+		const ULConst DictReferenceVectorDataDefinition_UL = { DictReferenceVectorDataDefinition_UL_Data };
 
 		const UInt8 Dictionaries_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x02, 0x02, 0x00, 0x00 };
-		const UL Dictionaries_UL(Dictionaries_UL_Data);
+		const ULConst Dictionaries_UL = { Dictionaries_UL_Data };
 
 		const UInt8 Dictionary_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x22, 0x00 };
-		const UL Dictionary_UL(Dictionary_UL_Data);
+		const ULConst Dictionary_UL = { Dictionary_UL_Data };
 
 		const UInt8 DisplayF2Offset_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x03, 0x02, 0x07, 0x00, 0x00, 0x00 };
-		const UL DisplayF2Offset_UL(DisplayF2Offset_UL_Data);
+		const ULConst DisplayF2Offset_UL = { DisplayF2Offset_UL_Data };
 
 		const UInt8 DisplayHeight_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0b, 0x00, 0x00, 0x00 };
-		const UL DisplayHeight_UL(DisplayHeight_UL_Data);
+		const ULConst DisplayHeight_UL = { DisplayHeight_UL_Data };
 
 		const UInt8 DisplayWidth_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0c, 0x00, 0x00, 0x00 };
-		const UL DisplayWidth_UL(DisplayWidth_UL_Data);
+		const ULConst DisplayWidth_UL = { DisplayWidth_UL_Data };
 
 		const UInt8 DisplayXOffset_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0d, 0x00, 0x00, 0x00 };
-		const UL DisplayXOffset_UL(DisplayXOffset_UL_Data);
+		const ULConst DisplayXOffset_UL = { DisplayXOffset_UL_Data };
 
 		const UInt8 DisplayYOffset_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0e, 0x00, 0x00, 0x00 };
-		const UL DisplayYOffset_UL(DisplayYOffset_UL_Data);
+		const ULConst DisplayYOffset_UL = { DisplayYOffset_UL_Data };
 
 		const UInt8 DropFrame_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00 };
-		const UL DropFrame_UL(DropFrame_UL_Data);
+		const ULConst DropFrame_UL = { DropFrame_UL_Data };
 
 		const UInt8 EditRate_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x30, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00 };
-		const UL EditRate_UL(EditRate_UL_Data);
+		const ULConst EditRate_UL = { EditRate_UL_Data };
 
 		const UInt8 EditUnitByteCount_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x04, 0x06, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00 };
-		const UL EditUnitByteCount_UL(EditUnitByteCount_UL_Data);
+		const ULConst EditUnitByteCount_UL = { EditUnitByteCount_UL_Data };
 
 		const UInt8 ElectroSpatialFormulation_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00 };
-		const UL ElectroSpatialFormulation_UL(ElectroSpatialFormulation_UL_Data);
+		const ULConst ElectroSpatialFormulation_UL = { ElectroSpatialFormulation_UL_Data };
 
 		const UInt8 ElementCount_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00 };
-		const UL ElementCount_UL(ElementCount_UL_Data);
+		const ULConst ElementCount_UL = { ElementCount_UL_Data };
 
 		const UInt8 ElementNames_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x04, 0x00, 0x00, 0x00 };
-		const UL ElementNames_UL(ElementNames_UL_Data);
+		const ULConst ElementNames_UL = { ElementNames_UL_Data };
 
 		const UInt8 ElementOf_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x06, 0x01, 0x01, 0x07, 0x21, 0x00, 0x00, 0x00 };
-		const UL ElementOf_UL(ElementOf_UL_Data);
+		const ULConst ElementOf_UL = { ElementOf_UL_Data };
 
 		const UInt8 ElementType_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x0b, 0x00, 0x00, 0x00 };
-		const UL ElementType_UL(ElementType_UL_Data);
+		const ULConst ElementType_UL = { ElementType_UL_Data };
 
 		const UInt8 ElementValues_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x05, 0x00, 0x00, 0x00 };
-		const UL ElementValues_UL(ElementValues_UL_Data);
+		const ULConst ElementValues_UL = { ElementValues_UL_Data };
 
 		const UInt8 Emphasis_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x06, 0x00, 0x00, 0x00 };
-		const UL Emphasis_UL(Emphasis_UL_Data);
+		const ULConst Emphasis_UL = { Emphasis_UL_Data };
 
 		const UInt8 EncryptedContainerLabel_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x07, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x0b, 0x01, 0x00 };
-		const UL EncryptedContainerLabel_UL(EncryptedContainerLabel_UL_Data);
+		const ULConst EncryptedContainerLabel_UL = { EncryptedContainerLabel_UL_Data };
 
 		const UInt8 EncryptedSourceValue_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x02, 0x09, 0x03, 0x01, 0x03, 0x00, 0x00, 0x00 };
-		const UL EncryptedSourceValue_UL(EncryptedSourceValue_UL_Data);
+		const ULConst EncryptedSourceValue_UL = { EncryptedSourceValue_UL_Data };
 
 		const UInt8 EncryptedTriplet_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x04, 0x01, 0x07, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x7e, 0x01, 0x00 };
-		const UL EncryptedTriplet_UL(EncryptedTriplet_UL_Data);
+		const ULConst EncryptedTriplet_UL = { EncryptedTriplet_UL_Data };
 
 		const UInt8 EssenceContainer_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x01, 0x02, 0x00, 0x00 };
-		const UL EssenceContainer_UL(EssenceContainer_UL_Data);
+		const ULConst EssenceContainer_UL = { EssenceContainer_UL_Data };
 
 		const UInt8 EssenceContainerData_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x00 };
-		const UL EssenceContainerData_UL(EssenceContainerData_UL_Data);
+		const ULConst EssenceContainerData_UL = { EssenceContainerData_UL_Data };
 
 		const UInt8 EssenceContainers_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x01, 0x02, 0x02, 0x10, 0x02, 0x01, 0x00, 0x00 };
-		const UL EssenceContainers_UL(EssenceContainers_UL_Data);
+		const ULConst EssenceContainers_UL = { EssenceContainers_UL_Data };
 
 		const UInt8 EssenceDataObjects_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x05, 0x02, 0x00, 0x00 };
-		const UL EssenceDataObjects_UL(EssenceDataObjects_UL_Data);
+		const ULConst EssenceDataObjects_UL = { EssenceDataObjects_UL_Data };
 
 		const UInt8 EssenceIsIdentified_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x01, 0x03, 0x00, 0x00, 0x00 };
-		const UL EssenceIsIdentified_UL(EssenceIsIdentified_UL_Data);
+		const ULConst EssenceIsIdentified_UL = { EssenceIsIdentified_UL_Data };
 
 		const UInt8 Event_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x00 };
-		const UL Event_UL(Event_UL_Data);
+		const ULConst Event_UL = { Event_UL_Data };
 
 		const UInt8 EventComment_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x30, 0x04, 0x04, 0x01, 0x00, 0x00, 0x00 };
-		const UL EventComment_UL(EventComment_UL_Data);
+		const ULConst EventComment_UL = { EventComment_UL_Data };
 
 		const UInt8 EventEditRate_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x30, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00 };
-		const UL EventEditRate_UL(EventEditRate_UL_Data);
+		const ULConst EventEditRate_UL = { EventEditRate_UL_Data };
 
 		const UInt8 EventOrigin_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x07, 0x02, 0x01, 0x03, 0x01, 0x0b, 0x00, 0x00 };
-		const UL EventOrigin_UL(EventOrigin_UL_Data);
+		const ULConst EventOrigin_UL = { EventOrigin_UL_Data };
 
 		const UInt8 EventStartPosition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x03, 0x03, 0x03, 0x00, 0x00 };
-		const UL EventStartPosition_UL(EventStartPosition_UL_Data);
+		const ULConst EventStartPosition_UL = { EventStartPosition_UL_Data };
 
 		const UInt8 EventTrack_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x39, 0x00 };
-		const UL EventTrack_UL(EventTrack_UL_Data);
+		const ULConst EventTrack_UL = { EventTrack_UL_Data };
 
 		const UInt8 ExtendibleEnumerationElement_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x06, 0x01, 0x01, 0x07, 0x7e, 0x00, 0x00, 0x00 };
-		const UL ExtendibleEnumerationElement_UL(ExtendibleEnumerationElement_UL_Data);
+		const ULConst ExtendibleEnumerationElement_UL = { ExtendibleEnumerationElement_UL_Data };
 
 		const UInt8 ExtensionDescription_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x06, 0x01, 0x01, 0x07, 0x1e, 0x00, 0x00, 0x00 };
-		const UL ExtensionDescription_UL(ExtensionDescription_UL_Data);
+		const ULConst ExtensionDescription_UL = { ExtensionDescription_UL_Data };
 
 		const UInt8 ExtensionScheme_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x26, 0x00, 0x00 };
-		const UL ExtensionScheme_UL(ExtensionScheme_UL_Data);
+		const ULConst ExtensionScheme_UL = { ExtensionScheme_UL_Data };
 
 		const UInt8 ExtensionSchemeID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x06, 0x01, 0x01, 0x07, 0x1b, 0x00, 0x00, 0x00 };
-		const UL ExtensionSchemeID_UL(ExtensionSchemeID_UL_Data);
+		const ULConst ExtensionSchemeID_UL = { ExtensionSchemeID_UL_Data };
 
 		const UInt8 FieldDominance_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x03, 0x01, 0x06, 0x00, 0x00, 0x00 };
-		const UL FieldDominance_UL(FieldDominance_UL_Data);
+		const ULConst FieldDominance_UL = { FieldDominance_UL_Data };
 
 		const UInt8 FileDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00 };
-		const UL FileDescriptor_UL(FileDescriptor_UL_Data);
+		const ULConst FileDescriptor_UL = { FileDescriptor_UL_Data };
 
 		const UInt8 FileDescriptors_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x06, 0x01, 0x01, 0x04, 0x06, 0x0b, 0x00, 0x00 };
-		const UL FileDescriptors_UL(FileDescriptors_UL_Data);
+		const ULConst FileDescriptors_UL = { FileDescriptors_UL_Data };
 
 		const UInt8 Filler_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x00 };
-		const UL Filler_UL(Filler_UL_Data);
+		const ULConst Filler_UL = { Filler_UL_Data };
 
 		const UInt8 FixedArrayElementType_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x0c, 0x00, 0x00, 0x00 };
-		const UL FixedArrayElementType_UL(FixedArrayElementType_UL_Data);
+		const ULConst FixedArrayElementType_UL = { FixedArrayElementType_UL_Data };
 
 		const UInt8 FixedChannelStatusData_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x03, 0x00, 0x00, 0x00 };
-		const UL FixedChannelStatusData_UL(FixedChannelStatusData_UL_Data);
+		const ULConst FixedChannelStatusData_UL = { FixedChannelStatusData_UL_Data };
 
 		const UInt8 FixedUserData_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x05, 0x00, 0x00, 0x00 };
-		const UL FixedUserData_UL(FixedUserData_UL_Data);
+		const ULConst FixedUserData_UL = { FixedUserData_UL_Data };
 
 		const UInt8 Footer_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x05, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x04, 0x02, 0x00 };
-		const UL Footer_UL(Footer_UL_Data);
+		const ULConst Footer_UL = { Footer_UL_Data };
 
 		const UInt8 FooterPartition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x06, 0x10, 0x10, 0x05, 0x01, 0x00, 0x00, 0x00 };
-		const UL FooterPartition_UL(FooterPartition_UL_Data);
+		const ULConst FooterPartition_UL = { FooterPartition_UL_Data };
 
 		const UInt8 FrameLayout_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x03, 0x01, 0x04, 0x00, 0x00, 0x00 };
-		const UL FrameLayout_UL(FrameLayout_UL_Data);
+		const ULConst FrameLayout_UL = { FrameLayout_UL_Data };
 
 		const UInt8 GenerationUID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x08, 0x00, 0x00, 0x00 };
-		const UL GenerationUID_UL(GenerationUID_UL_Data);
+		const ULConst GenerationUID_UL = { GenerationUID_UL_Data };
 
 		const UInt8 GenericDataEssenceDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x43, 0x00 };
-		const UL GenericDataEssenceDescriptor_UL(GenericDataEssenceDescriptor_UL_Data);
+		const ULConst GenericDataEssenceDescriptor_UL = { GenericDataEssenceDescriptor_UL_Data };
 
 		const UInt8 GenericDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x00 };
-		const UL GenericDescriptor_UL(GenericDescriptor_UL_Data);
+		const ULConst GenericDescriptor_UL = { GenericDescriptor_UL_Data };
 
 		const UInt8 GenericEssenceContainerMultipleWrappings_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x03, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x7f, 0x01, 0x00 };
-		const UL GenericEssenceContainerMultipleWrappings_UL(GenericEssenceContainerMultipleWrappings_UL_Data);
+		const ULConst GenericEssenceContainerMultipleWrappings_UL = { GenericEssenceContainerMultipleWrappings_UL_Data };
 
 		const UInt8 GenericPackage_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00 };
-		const UL GenericPackage_UL(GenericPackage_UL_Data);
+		const ULConst GenericPackage_UL = { GenericPackage_UL_Data };
 
 		const UInt8 GenericPictureEssenceDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00 };
-		const UL GenericPictureEssenceDescriptor_UL(GenericPictureEssenceDescriptor_UL_Data);
+		const ULConst GenericPictureEssenceDescriptor_UL = { GenericPictureEssenceDescriptor_UL_Data };
 
 		const UInt8 GenericSoundEssenceDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00 };
-		const UL GenericSoundEssenceDescriptor_UL(GenericSoundEssenceDescriptor_UL_Data);
+		const ULConst GenericSoundEssenceDescriptor_UL = { GenericSoundEssenceDescriptor_UL_Data };
 
 		const UInt8 GenericTrack_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00 };
-		const UL GenericTrack_UL(GenericTrack_UL_Data);
+		const ULConst GenericTrack_UL = { GenericTrack_UL_Data };
 
 		const UInt8 GlobalAUID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x01, 0x03, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00 };
-		const UL GlobalAUID_UL(GlobalAUID_UL_Data);
+		const ULConst GlobalAUID_UL = { GlobalAUID_UL_Data };
 
 		const UInt8 HMACAlgorithmSHA1128_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x07, 0x02, 0x09, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00 };
-		const UL HMACAlgorithmSHA1128_UL(HMACAlgorithmSHA1128_UL_Data);
+		const ULConst HMACAlgorithmSHA1128_UL = { HMACAlgorithmSHA1128_UL_Data };
 
 		const UInt8 HeaderByteCount_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x04, 0x06, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00 };
-		const UL HeaderByteCount_UL(HeaderByteCount_UL_Data);
+		const ULConst HeaderByteCount_UL = { HeaderByteCount_UL_Data };
 
 		const UInt8 HorizontalSubsampling_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x05, 0x00, 0x00, 0x00 };
-		const UL HorizontalSubsampling_UL(HorizontalSubsampling_UL_Data);
+		const ULConst HorizontalSubsampling_UL = { HorizontalSubsampling_UL_Data };
 
 		const UInt8 Hours_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00 };
-		const UL Hours_UL(Hours_UL_Data);
+		const ULConst Hours_UL = { Hours_UL_Data };
 
 		const UInt8 ISO7_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL ISO7_UL(ISO7_UL_Data);
+		const ULConst ISO7_UL = { ISO7_UL_Data };
 
 		const UInt8 ISO7String_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL ISO7String_UL(ISO7String_UL_Data);
+		const ULConst ISO7String_UL = { ISO7String_UL_Data };
 
 		const UInt8 IdenticalGOP_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x07, 0x00, 0x00 };
-		const UL IdenticalGOP_UL(IdenticalGOP_UL_Data);
+		const ULConst IdenticalGOP_UL = { IdenticalGOP_UL_Data };
 
 		const UInt8 Identification_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00 };
-		const UL Identification_UL(Identification_UL_Data);
+		const ULConst Identification_UL = { Identification_UL_Data };
 
 		const UInt8 Identifications_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x06, 0x04, 0x00, 0x00 };
-		const UL Identifications_UL(Identifications_UL_Data);
+		const ULConst Identifications_UL = { Identifications_UL_Data };
 
 		const UInt8 ImageAlignmentOffset_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x18, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00 };
-		const UL ImageAlignmentOffset_UL(ImageAlignmentOffset_UL_Data);
+		const ULConst ImageAlignmentOffset_UL = { ImageAlignmentOffset_UL_Data };
 
 		const UInt8 ImageEndOffset_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x18, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00 };
-		const UL ImageEndOffset_UL(ImageEndOffset_UL_Data);
+		const ULConst ImageEndOffset_UL = { ImageEndOffset_UL_Data };
 
 		const UInt8 ImageStartOffset_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x18, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00 };
-		const UL ImageStartOffset_UL(ImageStartOffset_UL_Data);
+		const ULConst ImageStartOffset_UL = { ImageStartOffset_UL_Data };
 
 		const UInt8 IndexByteCount_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x04, 0x06, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00 };
-		const UL IndexByteCount_UL(IndexByteCount_UL_Data);
+		const ULConst IndexByteCount_UL = { IndexByteCount_UL_Data };
 
 		const UInt8 IndexDuration_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x07, 0x02, 0x02, 0x01, 0x01, 0x02, 0x00, 0x00 };
-		const UL IndexDuration_UL(IndexDuration_UL_Data);
+		const ULConst IndexDuration_UL = { IndexDuration_UL_Data };
 
 		const UInt8 IndexEditRate_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x05, 0x30, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00 };
-		const UL IndexEditRate_UL(IndexEditRate_UL_Data);
+		const ULConst IndexEditRate_UL = { IndexEditRate_UL_Data };
 
 		const UInt8 IndexEntryArray_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x04, 0x04, 0x02, 0x05, 0x00, 0x00, 0x00 };
-		const UL IndexEntryArray_UL(IndexEntryArray_UL_Data);
+		const ULConst IndexEntryArray_UL = { IndexEntryArray_UL_Data };
 
 		const UInt8 IndexSID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x01, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00 };
-		const UL IndexSID_UL(IndexSID_UL_Data);
+		const ULConst IndexSID_UL = { IndexSID_UL_Data };
 
 		const UInt8 IndexStartPosition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x07, 0x02, 0x01, 0x03, 0x01, 0x0a, 0x00, 0x00 };
-		const UL IndexStartPosition_UL(IndexStartPosition_UL_Data);
+		const ULConst IndexStartPosition_UL = { IndexStartPosition_UL_Data };
 
 		const UInt8 IndexTableSegment_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x10, 0x01, 0x00 };
-		const UL IndexTableSegment_UL(IndexTableSegment_UL_Data);
+		const ULConst IndexTableSegment_UL = { IndexTableSegment_UL_Data };
 
 		const UInt8 Indirect_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x04, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL Indirect_UL(Indirect_UL_Data);
+		const ULConst Indirect_UL = { Indirect_UL_Data };
 
 		const UInt8 InstanceUID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00 };
-		const UL InstanceUID_UL(InstanceUID_UL_Data);
+		const ULConst InstanceUID_UL = { InstanceUID_UL_Data };
 
 		const UInt8 Int16_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL Int16_UL(Int16_UL_Data);
+		const ULConst Int16_UL = { Int16_UL_Data };
 
 		const UInt8 Int32_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL Int32_UL(Int32_UL_Data);
+		const ULConst Int32_UL = { Int32_UL_Data };
 
 		const UInt8 Int32Batch_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL Int32Batch_UL(Int32Batch_UL_Data);
+		const ULConst Int32Batch_UL = { Int32Batch_UL_Data };
 
 		const UInt8 Int64_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL Int64_UL(Int64_UL_Data);
+		const ULConst Int64_UL = { Int64_UL_Data };
 
 		const UInt8 Int64Array_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL Int64Array_UL(Int64Array_UL_Data);
+		const ULConst Int64Array_UL = { Int64Array_UL_Data };
 
 		const UInt8 Int8_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL Int8_UL(Int8_UL_Data);
+		const ULConst Int8_UL = { Int8_UL_Data };
 
 		const UInt8 InterchangeObject_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00 };
-		const UL InterchangeObject_UL(InterchangeObject_UL_Data);
+		const ULConst InterchangeObject_UL = { InterchangeObject_UL_Data };
 
 		const UInt8 IsConcrete_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x03, 0x00, 0x00, 0x00 };
-		const UL IsConcrete_UL(IsConcrete_UL_Data);
+		const ULConst IsConcrete_UL = { IsConcrete_UL_Data };
 
 		const UInt8 IsOptional_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00 };
-		const UL IsOptional_UL(IsOptional_UL_Data);
+		const ULConst IsOptional_UL = { IsOptional_UL_Data };
 
 		const UInt8 IsSigned_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x02, 0x00, 0x00, 0x00 };
-		const UL IsSigned_UL(IsSigned_UL_Data);
+		const ULConst IsSigned_UL = { IsSigned_UL_Data };
 
 		const UInt8 IsUniqueIdentifier_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x06, 0x00, 0x00, 0x00 };
-		const UL IsUniqueIdentifier_UL(IsUniqueIdentifier_UL_Data);
+		const ULConst IsUniqueIdentifier_UL = { IsUniqueIdentifier_UL_Data };
 
 		const UInt8 JPEG2000PictureSubDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00 };
-		const UL JPEG2000PictureSubDescriptor_UL(JPEG2000PictureSubDescriptor_UL_Data);
+		const ULConst JPEG2000PictureSubDescriptor_UL = { JPEG2000PictureSubDescriptor_UL_Data };
 
 		const UInt8 KAGSize_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x03, 0x01, 0x02, 0x01, 0x09, 0x00, 0x00, 0x00 };
-		const UL KAGSize_UL(KAGSize_UL_Data);
+		const ULConst KAGSize_UL = { KAGSize_UL_Data };
 
 		const UInt8 KLVFill_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x10, 0x01, 0x00, 0x00, 0x00 };
-		const UL KLVFill_UL(KLVFill_UL_Data);
+		const ULConst KLVFill_UL = { KLVFill_UL_Data };
 
 		const UInt8 LastModifiedDate_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x10, 0x02, 0x04, 0x00, 0x00 };
-		const UL LastModifiedDate_UL(LastModifiedDate_UL_Data);
+		const ULConst LastModifiedDate_UL = { LastModifiedDate_UL_Data };
 
 		const UInt8 LayoutType_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00 };
-		const UL LayoutType_UL(LayoutType_UL_Data);
+		const ULConst LayoutType_UL = { LayoutType_UL_Data };
 
 		const UInt8 Length_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x04, 0x06, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00 };
-		const UL Length_UL(Length_UL_Data);
+		const ULConst Length_UL = { Length_UL_Data };
 
 		const UInt8 LengthType_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00 };
-		const UL LengthType_UL(LengthType_UL_Data);
+		const ULConst LengthType_UL = { LengthType_UL_Data };
 
 		const UInt8 LinkedApplicationPluginInstanceID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x05, 0x20, 0x07, 0x01, 0x0b, 0x00, 0x00, 0x00 };
-		const UL LinkedApplicationPluginInstanceID_UL(LinkedApplicationPluginInstanceID_UL_Data);
+		const ULConst LinkedApplicationPluginInstanceID_UL = { LinkedApplicationPluginInstanceID_UL_Data };
 
 		const UInt8 LinkedDescriptiveFrameworkPluginID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x05, 0x20, 0x07, 0x01, 0x0c, 0x00, 0x00, 0x00 };
-		const UL LinkedDescriptiveFrameworkPluginID_UL(LinkedDescriptiveFrameworkPluginID_UL_Data);
+		const ULConst LinkedDescriptiveFrameworkPluginID_UL = { LinkedDescriptiveFrameworkPluginID_UL_Data };
 
 		const UInt8 LinkedDescriptiveObjectPluginID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x05, 0x20, 0x07, 0x01, 0x11, 0x00, 0x00, 0x00 };
-		const UL LinkedDescriptiveObjectPluginID_UL(LinkedDescriptiveObjectPluginID_UL_Data);
+		const ULConst LinkedDescriptiveObjectPluginID_UL = { LinkedDescriptiveObjectPluginID_UL_Data };
 
 		const UInt8 LinkedPackageUID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x06, 0x01, 0x00, 0x00, 0x00 };
-		const UL LinkedPackageUID_UL(LinkedPackageUID_UL_Data);
+		const ULConst LinkedPackageUID_UL = { LinkedPackageUID_UL_Data };
 
 		const UInt8 LinkedTrackID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00 };
-		const UL LinkedTrackID_UL(LinkedTrackID_UL_Data);
+		const ULConst LinkedTrackID_UL = { LinkedTrackID_UL_Data };
 
 		const UInt8 LocalIdentification_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x05, 0x00, 0x00, 0x00 };
-		const UL LocalIdentification_UL(LocalIdentification_UL_Data);
+		const ULConst LocalIdentification_UL = { LocalIdentification_UL_Data };
 
 		const UInt8 LocalTag_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x01, 0x03, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00 };
-		const UL LocalTag_UL(LocalTag_UL_Data);
+		const ULConst LocalTag_UL = { LocalTag_UL_Data };
 
 		const UInt8 LocalTagEntries_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x07, 0x15, 0x00, 0x00, 0x00 };
-		const UL LocalTagEntries_UL(LocalTagEntries_UL_Data);
+		const ULConst LocalTagEntries_UL = { LocalTagEntries_UL_Data };
 
 		const UInt8 LocalTagType_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00 };
-		const UL LocalTagType_UL(LocalTagType_UL_Data);
+		const ULConst LocalTagType_UL = { LocalTagType_UL_Data };
 
 		const UInt8 Locator_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x31, 0x00 };
-		const UL Locator_UL(Locator_UL_Data);
+		const ULConst Locator_UL = { Locator_UL_Data };
 
 		const UInt8 LocatorName_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00 };
-		const UL LocatorName_UL(LocatorName_UL_Data);
+		const ULConst LocatorName_UL = { LocatorName_UL_Data };
 
 		const UInt8 Locators_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x06, 0x03, 0x00, 0x00 };
-		const UL Locators_UL(Locators_UL_Data);
+		const ULConst Locators_UL = { Locators_UL_Data };
 
 		const UInt8 Locked_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x04, 0x02, 0x03, 0x01, 0x04, 0x00, 0x00, 0x00 };
-		const UL Locked_UL(Locked_UL_Data);
+		const ULConst Locked_UL = { Locked_UL_Data };
 
 		const UInt8 LowDelay_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x05, 0x00, 0x00 };
-		const UL LowDelay_UL(LowDelay_UL_Data);
+		const ULConst LowDelay_UL = { LowDelay_UL_Data };
 
 		const UInt8 MIC_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x02, 0x09, 0x03, 0x02, 0x02, 0x00, 0x00, 0x00 };
-		const UL MIC_UL(MIC_UL_Data);
+		const ULConst MIC_UL = { MIC_UL_Data };
 
 		const UInt8 MICAlgorithm_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x02, 0x09, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00 };
-		const UL MICAlgorithm_UL(MICAlgorithm_UL_Data);
+		const ULConst MICAlgorithm_UL = { MICAlgorithm_UL_Data };
 
 		const UInt8 MPEG2VideoDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00 };
-		const UL MPEG2VideoDescriptor_UL(MPEG2VideoDescriptor_UL_Data);
+		const ULConst MPEG2VideoDescriptor_UL = { MPEG2VideoDescriptor_UL_Data };
 
 		const UInt8 MXFEC_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL MXFEC_UL(MXFEC_UL_Data);
+		const ULConst MXFEC_UL = { MXFEC_UL_Data };
 
 		const UInt8 MXFGC_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x00, 0x00, 0x00 };
-		const UL MXFGC_UL(MXFGC_UL_Data);
+		const ULConst MXFGC_UL = { MXFGC_UL_Data };
 
 		const UInt8 MXFGCAESBWF_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x06, 0x00, 0x00 };
-		const UL MXFGCAESBWF_UL(MXFGCAESBWF_UL_Data);
+		const ULConst MXFGCAESBWF_UL = { MXFGCAESBWF_UL_Data };
 
 		const UInt8 MXFGCALaw_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x0a, 0x00, 0x00 };
-		const UL MXFGCALaw_UL(MXFGCALaw_UL_Data);
+		const ULConst MXFGCALaw_UL = { MXFGCALaw_UL_Data };
 
 		const UInt8 MXFGCD10_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x01, 0x00, 0x00 };
-		const UL MXFGCD10_UL(MXFGCD10_UL_Data);
+		const ULConst MXFGCD10_UL = { MXFGCD10_UL_Data };
 
 		const UInt8 MXFGCD11_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x03, 0x00, 0x00 };
-		const UL MXFGCD11_UL(MXFGCD11_UL_Data);
+		const ULConst MXFGCD11_UL = { MXFGCD11_UL_Data };
 
 		const UInt8 MXFGCDV_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x02, 0x00, 0x00 };
-		const UL MXFGCDV_UL(MXFGCDV_UL_Data);
+		const ULConst MXFGCDV_UL = { MXFGCDV_UL_Data };
 
 		const UInt8 MXFGCEncrypted_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x0b, 0x00, 0x00 };
-		const UL MXFGCEncrypted_UL(MXFGCEncrypted_UL_Data);
+		const ULConst MXFGCEncrypted_UL = { MXFGCEncrypted_UL_Data };
 
 		const UInt8 MXFGCJP2K_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x0c, 0x00, 0x00 };
-		const UL MXFGCJP2K_UL(MXFGCJP2K_UL_Data);
+		const ULConst MXFGCJP2K_UL = { MXFGCJP2K_UL_Data };
 
 		const UInt8 MXFGCMPEGES_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x04, 0x00, 0x00 };
-		const UL MXFGCMPEGES_UL(MXFGCMPEGES_UL_Data);
+		const ULConst MXFGCMPEGES_UL = { MXFGCMPEGES_UL_Data };
 
 		const UInt8 MXFGCMPEGPES_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x07, 0x00, 0x00 };
-		const UL MXFGCMPEGPES_UL(MXFGCMPEGPES_UL_Data);
+		const ULConst MXFGCMPEGPES_UL = { MXFGCMPEGPES_UL_Data };
 
 		const UInt8 MXFGCMPEGPS_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x08, 0x00, 0x00 };
-		const UL MXFGCMPEGPS_UL(MXFGCMPEGPS_UL_Data);
+		const ULConst MXFGCMPEGPS_UL = { MXFGCMPEGPS_UL_Data };
 
 		const UInt8 MXFGCMPEGTS_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x09, 0x00, 0x00 };
-		const UL MXFGCMPEGTS_UL(MXFGCMPEGTS_UL_Data);
+		const ULConst MXFGCMPEGTS_UL = { MXFGCMPEGTS_UL_Data };
 
 		const UInt8 MXFGCMultiple_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x03, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x7f, 0x01, 0x00 };
-		const UL MXFGCMultiple_UL(MXFGCMultiple_UL_Data);
+		const ULConst MXFGCMultiple_UL = { MXFGCMultiple_UL_Data };
 
 		const UInt8 MXFGCUncompressed_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x05, 0x00, 0x00 };
-		const UL MXFGCUncompressed_UL(MXFGCUncompressed_UL_Data);
+		const ULConst MXFGCUncompressed_UL = { MXFGCUncompressed_UL_Data };
 
 		const UInt8 MXFGCVBI_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x0d, 0x00, 0x00 };
-		const UL MXFGCVBI_UL(MXFGCVBI_UL_Data);
+		const ULConst MXFGCVBI_UL = { MXFGCVBI_UL_Data };
 
 		const UInt8 MXFOP1a_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00 };
-		const UL MXFOP1a_UL(MXFOP1a_UL_Data);
+		const ULConst MXFOP1a_UL = { MXFOP1a_UL_Data };
 
 		const UInt8 MXFOP1b_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00 };
-		const UL MXFOP1b_UL(MXFOP1b_UL_Data);
+		const ULConst MXFOP1b_UL = { MXFOP1b_UL_Data };
 
 		const UInt8 MXFOP1c_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x03, 0x01, 0x00 };
-		const UL MXFOP1c_UL(MXFOP1c_UL_Data);
+		const ULConst MXFOP1c_UL = { MXFOP1c_UL_Data };
 
 		const UInt8 MXFOP1x_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00 };
-		const UL MXFOP1x_UL(MXFOP1x_UL_Data);
+		const ULConst MXFOP1x_UL = { MXFOP1x_UL_Data };
 
 		const UInt8 MXFOP2a_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x00 };
-		const UL MXFOP2a_UL(MXFOP2a_UL_Data);
+		const ULConst MXFOP2a_UL = { MXFOP2a_UL_Data };
 
 		const UInt8 MXFOP2b_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x02, 0x02, 0x01, 0x00 };
-		const UL MXFOP2b_UL(MXFOP2b_UL_Data);
+		const ULConst MXFOP2b_UL = { MXFOP2b_UL_Data };
 
 		const UInt8 MXFOP2c_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x02, 0x03, 0x01, 0x00 };
-		const UL MXFOP2c_UL(MXFOP2c_UL_Data);
+		const ULConst MXFOP2c_UL = { MXFOP2c_UL_Data };
 
 		const UInt8 MXFOP3a_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x03, 0x01, 0x01, 0x00 };
-		const UL MXFOP3a_UL(MXFOP3a_UL_Data);
+		const ULConst MXFOP3a_UL = { MXFOP3a_UL_Data };
 
 		const UInt8 MXFOP3b_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x03, 0x02, 0x01, 0x00 };
-		const UL MXFOP3b_UL(MXFOP3b_UL_Data);
+		const ULConst MXFOP3b_UL = { MXFOP3b_UL_Data };
 
 		const UInt8 MXFOP3c_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x03, 0x03, 0x01, 0x00 };
-		const UL MXFOP3c_UL(MXFOP3c_UL_Data);
+		const ULConst MXFOP3c_UL = { MXFOP3c_UL_Data };
 
 		const UInt8 MXFOPAtom_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x02, 0x01, 0x10, 0x00, 0x00, 0x00 };
-		const UL MXFOPAtom_UL(MXFOPAtom_UL_Data);
+		const ULConst MXFOPAtom_UL = { MXFOPAtom_UL_Data };
 
 		const UInt8 MXFOPSpecialized_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x00, 0x0d, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00 };
-		const UL MXFOPSpecialized_UL(MXFOPSpecialized_UL_Data);
+		const ULConst MXFOPSpecialized_UL = { MXFOPSpecialized_UL_Data };
 
 		const UInt8 Major_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00 };
-		const UL Major_UL(Major_UL_Data);
+		const ULConst Major_UL = { Major_UL_Data };
 
 		const UInt8 MajorVersion_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x03, 0x01, 0x02, 0x01, 0x06, 0x00, 0x00, 0x00 };
-		const UL MajorVersion_UL(MajorVersion_UL_Data);
+		const ULConst MajorVersion_UL = { MajorVersion_UL_Data };
 
 		const UInt8 MaterialPackage_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x36, 0x00 };
-		const UL MaterialPackage_UL(MaterialPackage_UL_Data);
+		const ULConst MaterialPackage_UL = { MaterialPackage_UL_Data };
 
 		const UInt8 MaxGOP_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x08, 0x00, 0x00 };
-		const UL MaxGOP_UL(MaxGOP_UL_Data);
+		const ULConst MaxGOP_UL = { MaxGOP_UL_Data };
 
 		const UInt8 MemberNames_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x06, 0x00, 0x00, 0x00 };
-		const UL MemberNames_UL(MemberNames_UL_Data);
+		const ULConst MemberNames_UL = { MemberNames_UL_Data };
 
 		const UInt8 MemberTypes_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x11, 0x00, 0x00, 0x00 };
-		const UL MemberTypes_UL(MemberTypes_UL_Data);
+		const ULConst MemberTypes_UL = { MemberTypes_UL_Data };
 
 		const UInt8 MetaDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x24, 0x00, 0x00 };
-		const UL MetaDefinition_UL(MetaDefinition_UL_Data);
+		const ULConst MetaDefinition_UL = { MetaDefinition_UL_Data };
 
 		const UInt8 MetaDefinitionDescription_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x14, 0x01, 0x00, 0x00 };
-		const UL MetaDefinitionDescription_UL(MetaDefinitionDescription_UL_Data);
+		const ULConst MetaDefinitionDescription_UL = { MetaDefinitionDescription_UL_Data };
 
 		const UInt8 MetaDefinitionIdentification_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x13, 0x00, 0x00, 0x00 };
-		const UL MetaDefinitionIdentification_UL(MetaDefinitionIdentification_UL_Data);
+		const ULConst MetaDefinitionIdentification_UL = { MetaDefinitionIdentification_UL_Data };
 
 		const UInt8 MetaDefinitionName_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x04, 0x01, 0x02, 0x01, 0x00, 0x00 };
-		const UL MetaDefinitionName_UL(MetaDefinitionName_UL_Data);
+		const ULConst MetaDefinitionName_UL = { MetaDefinitionName_UL_Data };
 
 		const UInt8 MetaDefinitions_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x06, 0x01, 0x01, 0x07, 0x1f, 0x00, 0x00, 0x00 };
-		const UL MetaDefinitions_UL(MetaDefinitions_UL_Data);
+		const ULConst MetaDefinitions_UL = { MetaDefinitions_UL_Data };
 
 		const UInt8 MetaDictionary_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x25, 0x00, 0x00 };
-		const UL MetaDictionary_UL(MetaDictionary_UL_Data);
+		const ULConst MetaDictionary_UL = { MetaDictionary_UL_Data };
 
 		const UInt8 MetaReferenceClassDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL MetaReferenceClassDefinition_UL(MetaReferenceClassDefinition_UL_Data);
+		const ULConst MetaReferenceClassDefinition_UL = { MetaReferenceClassDefinition_UL_Data };
 
 		const UInt8 MetaReferenceTypeDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL MetaReferenceTypeDefinition_UL(MetaReferenceTypeDefinition_UL_Data);
+		const ULConst MetaReferenceTypeDefinition_UL = { MetaReferenceTypeDefinition_UL_Data };
 
 		const UInt8 Minor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00 };
-		const UL Minor_UL(Minor_UL_Data);
+		const ULConst Minor_UL = { Minor_UL_Data };
 
 		const UInt8 MinorVersion_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x03, 0x01, 0x02, 0x01, 0x07, 0x00, 0x00, 0x00 };
-		const UL MinorVersion_UL(MinorVersion_UL_Data);
+		const ULConst MinorVersion_UL = { MinorVersion_UL_Data };
 
 		const UInt8 Minutes_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00 };
-		const UL Minutes_UL(Minutes_UL_Data);
+		const ULConst Minutes_UL = { Minutes_UL_Data };
 
 		const UInt8 ModificationDate_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x10, 0x02, 0x03, 0x00, 0x00 };
-		const UL ModificationDate_UL(ModificationDate_UL_Data);
+		const ULConst ModificationDate_UL = { ModificationDate_UL_Data };
 
 		const UInt8 MonoSourceTrackIDs_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x06, 0x01, 0x01, 0x03, 0x08, 0x00, 0x00, 0x00 };
-		const UL MonoSourceTrackIDs_UL(MonoSourceTrackIDs_UL_Data);
+		const ULConst MonoSourceTrackIDs_UL = { MonoSourceTrackIDs_UL_Data };
 
 		const UInt8 Month_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00 };
-		const UL Month_UL(Month_UL_Data);
+		const ULConst Month_UL = { Month_UL_Data };
 
 		const UInt8 MultipleDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x44, 0x00 };
-		const UL MultipleDescriptor_UL(MultipleDescriptor_UL_Data);
+		const ULConst MultipleDescriptor_UL = { MultipleDescriptor_UL_Data };
 
 		const UInt8 NetworkLocator_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x32, 0x00 };
-		const UL NetworkLocator_UL(NetworkLocator_UL_Data);
+		const ULConst NetworkLocator_UL = { NetworkLocator_UL_Data };
 
 		const UInt8 Numerator_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00 };
-		const UL Numerator_UL(Numerator_UL_Data);
+		const ULConst Numerator_UL = { Numerator_UL_Data };
 
 		const UInt8 ObjectClass_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x01, 0x01, 0x00, 0x00 };
-		const UL ObjectClass_UL(ObjectClass_UL_Data);
+		const ULConst ObjectClass_UL = { ObjectClass_UL_Data };
 
 		const UInt8 ObjectModelVersion_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x01, 0x04, 0x00, 0x00, 0x00 };
-		const UL ObjectModelVersion_UL(ObjectModelVersion_UL_Data);
+		const ULConst ObjectModelVersion_UL = { ObjectModelVersion_UL_Data };
 
 		const UInt8 Opaque_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x04, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL Opaque_UL(Opaque_UL_Data);
+		const ULConst Opaque_UL = { Opaque_UL_Data };
 
 		const UInt8 OpenBodyPartition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x05, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x03, 0x01, 0x00 };
-		const UL OpenBodyPartition_UL(OpenBodyPartition_UL_Data);
+		const ULConst OpenBodyPartition_UL = { OpenBodyPartition_UL_Data };
 
 		const UInt8 OpenCompleteBodyPartition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x05, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x03, 0x03, 0x00 };
-		const UL OpenCompleteBodyPartition_UL(OpenCompleteBodyPartition_UL_Data);
+		const ULConst OpenCompleteBodyPartition_UL = { OpenCompleteBodyPartition_UL_Data };
 
 		const UInt8 OpenCompleteHeader_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x05, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x02, 0x03, 0x00 };
-		const UL OpenCompleteHeader_UL(OpenCompleteHeader_UL_Data);
+		const ULConst OpenCompleteHeader_UL = { OpenCompleteHeader_UL_Data };
 
 		const UInt8 OpenHeader_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x05, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00 };
-		const UL OpenHeader_UL(OpenHeader_UL_Data);
+		const ULConst OpenHeader_UL = { OpenHeader_UL_Data };
 
 		const UInt8 OperationalPattern_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x01, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00 };
-		const UL OperationalPattern_UL(OperationalPattern_UL_Data);
+		const ULConst OperationalPattern_UL = { OperationalPattern_UL_Data };
 
 		const UInt8 Origin_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x03, 0x01, 0x03, 0x00, 0x00 };
-		const UL Origin_UL(Origin_UL_Data);
+		const ULConst Origin_UL = { Origin_UL_Data };
 
 		const UInt8 OriginalProperty_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x06, 0x01, 0x01, 0x07, 0x20, 0x00, 0x00, 0x00 };
-		const UL OriginalProperty_UL(OriginalProperty_UL_Data);
+		const ULConst OriginalProperty_UL = { OriginalProperty_UL_Data };
 
 		const UInt8 PackageCreationDate_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x10, 0x01, 0x03, 0x00, 0x00 };
-		const UL PackageCreationDate_UL(PackageCreationDate_UL_Data);
+		const ULConst PackageCreationDate_UL = { PackageCreationDate_UL_Data };
 
 		const UInt8 PackageID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL PackageID_UL(PackageID_UL_Data);
+		const ULConst PackageID_UL = { PackageID_UL_Data };
 
 		const UInt8 PackageMarkInPosition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x07, 0x02, 0x01, 0x03, 0x01, 0x0e, 0x00, 0x00 };
-		const UL PackageMarkInPosition_UL(PackageMarkInPosition_UL_Data);
+		const ULConst PackageMarkInPosition_UL = { PackageMarkInPosition_UL_Data };
 
 		const UInt8 PackageMarkOutPosition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x07, 0x02, 0x01, 0x03, 0x02, 0x04, 0x00, 0x00 };
-		const UL PackageMarkOutPosition_UL(PackageMarkOutPosition_UL_Data);
+		const ULConst PackageMarkOutPosition_UL = { PackageMarkOutPosition_UL_Data };
 
 		const UInt8 PackageMarker_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x06, 0x01, 0x01, 0x04, 0x02, 0x0f, 0x00, 0x00 };
-		const UL PackageMarker_UL(PackageMarker_UL_Data);
+		const ULConst PackageMarker_UL = { PackageMarker_UL_Data };
 
 		const UInt8 PackageMarkerObject_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x60, 0x00 };
-		const UL PackageMarkerObject_UL(PackageMarkerObject_UL_Data);
+		const ULConst PackageMarkerObject_UL = { PackageMarkerObject_UL_Data };
 
 		const UInt8 PackageModifiedDate_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x10, 0x02, 0x05, 0x00, 0x00 };
-		const UL PackageModifiedDate_UL(PackageModifiedDate_UL_Data);
+		const ULConst PackageModifiedDate_UL = { PackageModifiedDate_UL_Data };
 
 		const UInt8 PackageName_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00 };
-		const UL PackageName_UL(PackageName_UL_Data);
+		const ULConst PackageName_UL = { PackageName_UL_Data };
 
 		const UInt8 PackageUID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x15, 0x10, 0x00, 0x00, 0x00, 0x00 };
-		const UL PackageUID_UL(PackageUID_UL_Data);
+		const ULConst PackageUID_UL = { PackageUID_UL_Data };
 
 		const UInt8 Packages_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x05, 0x01, 0x00, 0x00 };
-		const UL Packages_UL(Packages_UL_Data);
+		const ULConst Packages_UL = { Packages_UL_Data };
 
 		const UInt8 PaddingBits_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x18, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00 };
-		const UL PaddingBits_UL(PaddingBits_UL_Data);
+		const ULConst PaddingBits_UL = { PaddingBits_UL_Data };
 
 		const UInt8 Palette_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x08, 0x00, 0x00, 0x00 };
-		const UL Palette_UL(Palette_UL_Data);
+		const ULConst Palette_UL = { Palette_UL_Data };
 
 		const UInt8 PaletteLayout_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x09, 0x00, 0x00, 0x00 };
-		const UL PaletteLayout_UL(PaletteLayout_UL_Data);
+		const ULConst PaletteLayout_UL = { PaletteLayout_UL_Data };
 
 		const UInt8 ParentClass_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x01, 0x00, 0x00, 0x00 };
-		const UL ParentClass_UL(ParentClass_UL_Data);
+		const ULConst ParentClass_UL = { ParentClass_UL_Data };
 
 		const UInt8 PartitionArray_UL_Data[16] = { 0x80, 0x62, 0xc1, 0x08, 0xa8, 0x0d, 0xeb, 0xfe, 0x3a, 0x9d, 0xc8, 0xe1, 0x7e, 0x83, 0xb6, 0x4b };
-		const UL PartitionArray_UL(PartitionArray_UL_Data);
+		const ULConst PartitionArray_UL = { PartitionArray_UL_Data };
 
 		const UInt8 PartitionMetadata_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x06, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL PartitionMetadata_UL(PartitionMetadata_UL_Data);
+		const ULConst PartitionMetadata_UL = { PartitionMetadata_UL_Data };
 
 		const UInt8 Patch_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00 };
-		const UL Patch_UL(Patch_UL_Data);
+		const ULConst Patch_UL = { Patch_UL_Data };
 
 		const UInt8 PeakChannels_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x0a, 0x00, 0x00, 0x00 };
-		const UL PeakChannels_UL(PeakChannels_UL_Data);
+		const ULConst PeakChannels_UL = { PeakChannels_UL_Data };
 
 		const UInt8 PeakEnvelopeBlockSize_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x09, 0x00, 0x00, 0x00 };
-		const UL PeakEnvelopeBlockSize_UL(PeakEnvelopeBlockSize_UL_Data);
+		const ULConst PeakEnvelopeBlockSize_UL = { PeakEnvelopeBlockSize_UL_Data };
 
 		const UInt8 PeakEnvelopeData_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x03, 0x01, 0x0e, 0x00, 0x00, 0x00 };
-		const UL PeakEnvelopeData_UL(PeakEnvelopeData_UL_Data);
+		const ULConst PeakEnvelopeData_UL = { PeakEnvelopeData_UL_Data };
 
 		const UInt8 PeakEnvelopeFormat_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x07, 0x00, 0x00, 0x00 };
-		const UL PeakEnvelopeFormat_UL(PeakEnvelopeFormat_UL_Data);
+		const ULConst PeakEnvelopeFormat_UL = { PeakEnvelopeFormat_UL_Data };
 
 		const UInt8 PeakEnvelopeTimestamp_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x0d, 0x00, 0x00, 0x00 };
-		const UL PeakEnvelopeTimestamp_UL(PeakEnvelopeTimestamp_UL_Data);
+		const ULConst PeakEnvelopeTimestamp_UL = { PeakEnvelopeTimestamp_UL_Data };
 
 		const UInt8 PeakEnvelopeVersion_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x06, 0x00, 0x00, 0x00 };
-		const UL PeakEnvelopeVersion_UL(PeakEnvelopeVersion_UL_Data);
+		const ULConst PeakEnvelopeVersion_UL = { PeakEnvelopeVersion_UL_Data };
 
 		const UInt8 PeakFrames_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x0b, 0x00, 0x00, 0x00 };
-		const UL PeakFrames_UL(PeakFrames_UL_Data);
+		const ULConst PeakFrames_UL = { PeakFrames_UL_Data };
 
 		const UInt8 PeakOfPeaksPosition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x0c, 0x00, 0x00, 0x00 };
-		const UL PeakOfPeaksPosition_UL(PeakOfPeaksPosition_UL_Data);
+		const ULConst PeakOfPeaksPosition_UL = { PeakOfPeaksPosition_UL_Data };
 
 		const UInt8 PictureComponentSizing_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x0b, 0x00, 0x00, 0x00 };
-		const UL PictureComponentSizing_UL(PictureComponentSizing_UL_Data);
+		const ULConst PictureComponentSizing_UL = { PictureComponentSizing_UL_Data };
 
 		const UInt8 PictureEssenceCoding_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00 };
-		const UL PictureEssenceCoding_UL(PictureEssenceCoding_UL_Data);
+		const ULConst PictureEssenceCoding_UL = { PictureEssenceCoding_UL_Data };
 
 		const UInt8 PictureEssenceTrack_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00 };
-		const UL PictureEssenceTrack_UL(PictureEssenceTrack_UL_Data);
+		const ULConst PictureEssenceTrack_UL = { PictureEssenceTrack_UL_Data };
 
 		const UInt8 PixelLayout_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x06, 0x00, 0x00, 0x00 };
-		const UL PixelLayout_UL(PixelLayout_UL_Data);
+		const ULConst PixelLayout_UL = { PixelLayout_UL_Data };
 
 		const UInt8 PlaintextOffset_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x06, 0x09, 0x02, 0x01, 0x03, 0x00, 0x00, 0x00 };
-		const UL PlaintextOffset_UL(PlaintextOffset_UL_Data);
+		const ULConst PlaintextOffset_UL = { PlaintextOffset_UL_Data };
 
 		const UInt8 Platform_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x06, 0x01, 0x00, 0x00 };
-		const UL Platform_UL(Platform_UL_Data);
+		const ULConst Platform_UL = { Platform_UL_Data };
 
 		const UInt8 PointsPerPeakValue_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x08, 0x00, 0x00, 0x00 };
-		const UL PointsPerPeakValue_UL(PointsPerPeakValue_UL_Data);
+		const ULConst PointsPerPeakValue_UL = { PointsPerPeakValue_UL_Data };
 
 		const UInt8 PosTableCount_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x04, 0x04, 0x01, 0x07, 0x00, 0x00, 0x00 };
-		const UL PosTableCount_UL(PosTableCount_UL_Data);
+		const ULConst PosTableCount_UL = { PosTableCount_UL_Data };
 
 		const UInt8 Position_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00 };
-		const UL Position_UL(Position_UL_Data);
+		const ULConst Position_UL = { Position_UL_Data };
 
 		const UInt8 Preface_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00 };
-		const UL Preface_UL(Preface_UL_Data);
+		const ULConst Preface_UL = { Preface_UL_Data };
 
 		const UInt8 PreferredPrefix_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x06, 0x01, 0x01, 0x07, 0x1d, 0x00, 0x00, 0x00 };
-		const UL PreferredPrefix_UL(PreferredPrefix_UL_Data);
+		const ULConst PreferredPrefix_UL = { PreferredPrefix_UL_Data };
 
 		const UInt8 PreviousPartition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x06, 0x10, 0x10, 0x02, 0x01, 0x00, 0x00, 0x00 };
-		const UL PreviousPartition_UL(PreviousPartition_UL_Data);
+		const ULConst PreviousPartition_UL = { PreviousPartition_UL_Data };
 
 		const UInt8 PrimaryPackage_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x06, 0x01, 0x01, 0x04, 0x01, 0x08, 0x00, 0x00 };
-		const UL PrimaryPackage_UL(PrimaryPackage_UL_Data);
+		const ULConst PrimaryPackage_UL = { PrimaryPackage_UL_Data };
 
 		const UInt8 Primer_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x05, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x05, 0x01, 0x00 };
-		const UL Primer_UL(Primer_UL_Data);
+		const ULConst Primer_UL = { Primer_UL_Data };
 
 		const UInt8 ProductName_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x03, 0x01, 0x00, 0x00 };
-		const UL ProductName_UL(ProductName_UL_Data);
+		const ULConst ProductName_UL = { ProductName_UL_Data };
 
 		const UInt8 ProductUID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x07, 0x00, 0x00, 0x00 };
-		const UL ProductUID_UL(ProductUID_UL_Data);
+		const ULConst ProductUID_UL = { ProductUID_UL_Data };
 
 		const UInt8 ProductVersion_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x04, 0x00, 0x00, 0x00 };
-		const UL ProductVersion_UL(ProductVersion_UL_Data);
+		const ULConst ProductVersion_UL = { ProductVersion_UL_Data };
 
 		const UInt8 ProductVersionType_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL ProductVersionType_UL(ProductVersionType_UL_Data);
+		const ULConst ProductVersionType_UL = { ProductVersionType_UL_Data };
 
 		const UInt8 ProfileAndLevel_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x0a, 0x00, 0x00 };
-		const UL ProfileAndLevel_UL(ProfileAndLevel_UL_Data);
+		const ULConst ProfileAndLevel_UL = { ProfileAndLevel_UL_Data };
 
 		const UInt8 Properties_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x02, 0x00, 0x00, 0x00 };
-		const UL Properties_UL(Properties_UL_Data);
+		const ULConst Properties_UL = { Properties_UL_Data };
 
 		const UInt8 PropertyDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00 };
-		const UL PropertyDefinition_UL(PropertyDefinition_UL_Data);
+		const ULConst PropertyDefinition_UL = { PropertyDefinition_UL_Data };
 
 		const UInt8 PropertyType_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x04, 0x00, 0x00, 0x00 };
-		const UL PropertyType_UL(PropertyType_UL_Data);
+		const ULConst PropertyType_UL = { PropertyType_UL_Data };
 
 		const UInt8 PropertyWrapperDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x27, 0x00, 0x00 };
-		const UL PropertyWrapperDefinition_UL(PropertyWrapperDefinition_UL_Data);
+		const ULConst PropertyWrapperDefinition_UL = { PropertyWrapperDefinition_UL_Data };
 
 		const UInt8 QuantizationBits_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x04, 0x02, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00 };
-		const UL QuantizationBits_UL(QuantizationBits_UL_Data);
+		const ULConst QuantizationBits_UL = { QuantizationBits_UL_Data };
 
 		const UInt8 QuantizationDefault_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x0d, 0x00, 0x00, 0x00 };
-		const UL QuantizationDefault_UL(QuantizationDefault_UL_Data);
+		const ULConst QuantizationDefault_UL = { QuantizationDefault_UL_Data };
 
 		const UInt8 RGBACode_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00 };
-		const UL RGBACode_UL(RGBACode_UL_Data);
+		const ULConst RGBACode_UL = { RGBACode_UL_Data };
 
 		const UInt8 RGBAEssenceDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00 };
-		const UL RGBAEssenceDescriptor_UL(RGBAEssenceDescriptor_UL_Data);
+		const ULConst RGBAEssenceDescriptor_UL = { RGBAEssenceDescriptor_UL_Data };
 
 		const UInt8 RGBALayout_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL RGBALayout_UL(RGBALayout_UL_Data);
+		const ULConst RGBALayout_UL = { RGBALayout_UL_Data };
 
 		const UInt8 RGBALayoutItem_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL RGBALayoutItem_UL(RGBALayoutItem_UL_Data);
+		const ULConst RGBALayoutItem_UL = { RGBALayoutItem_UL_Data };
 
 		const UInt8 RandomIndexMetadata_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x05, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x11, 0x01, 0x00 };
-		const UL RandomIndexMetadata_UL(RandomIndexMetadata_UL_Data);
+		const ULConst RandomIndexMetadata_UL = { RandomIndexMetadata_UL_Data };
 
 		const UInt8 RandomIndexMetadataV10_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x05, 0x01, 0x01, 0x0d, 0x01, 0x02, 0x01, 0x01, 0x11, 0x00, 0x00 };
-		const UL RandomIndexMetadataV10_UL(RandomIndexMetadataV10_UL_Data);
+		const ULConst RandomIndexMetadataV10_UL = { RandomIndexMetadataV10_UL_Data };
 
 		const UInt8 Rational_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL Rational_UL(Rational_UL_Data);
+		const ULConst Rational_UL = { Rational_UL_Data };
 
 		const UInt8 RationalArray_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x04, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL RationalArray_UL(RationalArray_UL_Data);
+		const ULConst RationalArray_UL = { RationalArray_UL_Data };
 
 		const UInt8 ReferencedType_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x09, 0x00, 0x00, 0x00 };
-		const UL ReferencedType_UL(ReferencedType_UL_Data);
+		const ULConst ReferencedType_UL = { ReferencedType_UL_Data };
 
 		const UInt8 Release_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x02, 0x05, 0x00, 0x00, 0x00, 0x00 };
-		const UL Release_UL(Release_UL_Data);
+		const ULConst Release_UL = { Release_UL_Data };
 
 		const UInt8 RenamedType_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x12, 0x00, 0x00, 0x00 };
-		const UL RenamedType_UL(RenamedType_UL_Data);
+		const ULConst RenamedType_UL = { RenamedType_UL_Data };
 
 		const UInt8 ReversedByteOrder_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x03, 0x01, 0x02, 0x01, 0x0a, 0x00, 0x00, 0x00 };
-		const UL ReversedByteOrder_UL(ReversedByteOrder_UL_Data);
+		const ULConst ReversedByteOrder_UL = { ReversedByteOrder_UL_Data };
 
 		const UInt8 Root_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00 };
-		const UL Root_UL(Root_UL_Data);
+		const ULConst Root_UL = { Root_UL_Data };
 
 		const UInt8 RootExtensions_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x06, 0x01, 0x01, 0x07, 0x7f, 0x01, 0x00, 0x00 };
-		const UL RootExtensions_UL(RootExtensions_UL_Data);
+		const ULConst RootExtensions_UL = { RootExtensions_UL_Data };
 
 		const UInt8 RootFormatVersion_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x06, 0x01, 0x01, 0x07, 0x19, 0x00, 0x00, 0x00 };
-		const UL RootFormatVersion_UL(RootFormatVersion_UL_Data);
+		const ULConst RootFormatVersion_UL = { RootFormatVersion_UL_Data };
 
 		const UInt8 RootPreface_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x06, 0x01, 0x01, 0x07, 0x17, 0x00, 0x00, 0x00 };
-		const UL RootPreface_UL(RootPreface_UL_Data);
+		const ULConst RootPreface_UL = { RootPreface_UL_Data };
 
 		const UInt8 RoundedTimecodeBase_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x04, 0x01, 0x01, 0x02, 0x06, 0x00, 0x00 };
-		const UL RoundedTimecodeBase_UL(RoundedTimecodeBase_UL_Data);
+		const ULConst RoundedTimecodeBase_UL = { RoundedTimecodeBase_UL_Data };
 
 		const UInt8 Rsiz_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00 };
-		const UL Rsiz_UL(Rsiz_UL_Data);
+		const ULConst Rsiz_UL = { Rsiz_UL_Data };
 
 		const UInt8 SMPTE12MTimecodeActiveUserBitsTrack_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x02, 0x00, 0x00, 0x00 };
-		const UL SMPTE12MTimecodeActiveUserBitsTrack_UL(SMPTE12MTimecodeActiveUserBitsTrack_UL_Data);
+		const ULConst SMPTE12MTimecodeActiveUserBitsTrack_UL = { SMPTE12MTimecodeActiveUserBitsTrack_UL_Data };
 
 		const UInt8 SMPTE12MTimecodeTrack_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00 };
-		const UL SMPTE12MTimecodeTrack_UL(SMPTE12MTimecodeTrack_UL_Data);
+		const ULConst SMPTE12MTimecodeTrack_UL = { SMPTE12MTimecodeTrack_UL_Data };
 
 		const UInt8 SMPTE309MTimecodeTrack_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x03, 0x00, 0x00, 0x00 };
-		const UL SMPTE309MTimecodeTrack_UL(SMPTE309MTimecodeTrack_UL_Data);
+		const ULConst SMPTE309MTimecodeTrack_UL = { SMPTE309MTimecodeTrack_UL_Data };
 
 		const UInt8 SampleRate_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x06, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00 };
-		const UL SampleRate_UL(SampleRate_UL_Data);
+		const ULConst SampleRate_UL = { SampleRate_UL_Data };
 
 		const UInt8 SampledHeight_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x07, 0x00, 0x00, 0x00 };
-		const UL SampledHeight_UL(SampledHeight_UL_Data);
+		const ULConst SampledHeight_UL = { SampledHeight_UL_Data };
 
 		const UInt8 SampledWidth_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x08, 0x00, 0x00, 0x00 };
-		const UL SampledWidth_UL(SampledWidth_UL_Data);
+		const ULConst SampledWidth_UL = { SampledWidth_UL_Data };
 
 		const UInt8 SampledXOffset_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x09, 0x00, 0x00, 0x00 };
-		const UL SampledXOffset_UL(SampledXOffset_UL_Data);
+		const ULConst SampledXOffset_UL = { SampledXOffset_UL_Data };
 
 		const UInt8 SampledYOffset_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0a, 0x00, 0x00, 0x00 };
-		const UL SampledYOffset_UL(SampledYOffset_UL_Data);
+		const ULConst SampledYOffset_UL = { SampledYOffset_UL_Data };
 
 		const UInt8 ScanningDirection_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04, 0x01, 0x00, 0x00, 0x00 };
-		const UL ScanningDirection_UL(ScanningDirection_UL_Data);
+		const ULConst ScanningDirection_UL = { ScanningDirection_UL_Data };
 
 		const UInt8 Seconds_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00 };
-		const UL Seconds_UL(Seconds_UL_Data);
+		const ULConst Seconds_UL = { Seconds_UL_Data };
 
 		const UInt8 Segment_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00 };
-		const UL Segment_UL(Segment_UL_Data);
+		const ULConst Segment_UL = { Segment_UL_Data };
 
 		const UInt8 Sequence_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0f, 0x00 };
-		const UL Sequence_UL(Sequence_UL_Data);
+		const ULConst Sequence_UL = { Sequence_UL_Data };
 
 		const UInt8 SequenceNumber_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x06, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL SequenceNumber_UL(SequenceNumber_UL_Data);
+		const ULConst SequenceNumber_UL = { SequenceNumber_UL_Data };
 
 		const UInt8 SequenceOffset_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x03, 0x02, 0x02, 0x00, 0x00, 0x00 };
-		const UL SequenceOffset_UL(SequenceOffset_UL_Data);
+		const ULConst SequenceOffset_UL = { SequenceOffset_UL_Data };
 
 		const UInt8 SetElementType_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x0e, 0x00, 0x00, 0x00 };
-		const UL SetElementType_UL(SetElementType_UL_Data);
+		const ULConst SetElementType_UL = { SetElementType_UL_Data };
 
 		const UInt8 SignalStandard_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x05, 0x01, 0x13, 0x00, 0x00, 0x00, 0x00 };
-		const UL SignalStandard_UL(SignalStandard_UL_Data);
+		const ULConst SignalStandard_UL = { SignalStandard_UL_Data };
 
 		const UInt8 SingleSequence_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x02, 0x00, 0x00 };
-		const UL SingleSequence_UL(SingleSequence_UL_Data);
+		const ULConst SingleSequence_UL = { SingleSequence_UL_Data };
 
 		const UInt8 Size_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00 };
-		const UL Size_UL(Size_UL_Data);
+		const ULConst Size_UL = { Size_UL_Data };
 
 		const UInt8 SliceCount_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x04, 0x04, 0x04, 0x01, 0x01, 0x00, 0x00, 0x00 };
-		const UL SliceCount_UL(SliceCount_UL_Data);
+		const ULConst SliceCount_UL = { SliceCount_UL_Data };
 
 		const UInt8 SoundEssenceCompression_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x02, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00 };
-		const UL SoundEssenceCompression_UL(SoundEssenceCompression_UL_Data);
+		const ULConst SoundEssenceCompression_UL = { SoundEssenceCompression_UL_Data };
 
 		const UInt8 SoundEssenceTrack_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x04, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00 };
-		const UL SoundEssenceTrack_UL(SoundEssenceTrack_UL_Data);
+		const ULConst SoundEssenceTrack_UL = { SoundEssenceTrack_UL_Data };
 
 		const UInt8 SourceClip_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x00 };
-		const UL SourceClip_UL(SourceClip_UL_Data);
+		const ULConst SourceClip_UL = { SourceClip_UL_Data };
 
 		const UInt8 SourceEssenceContainer_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x06, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00 };
-		const UL SourceEssenceContainer_UL(SourceEssenceContainer_UL_Data);
+		const ULConst SourceEssenceContainer_UL = { SourceEssenceContainer_UL_Data };
 
 		const UInt8 SourceKey_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x06, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00 };
-		const UL SourceKey_UL(SourceKey_UL_Data);
+		const ULConst SourceKey_UL = { SourceKey_UL_Data };
 
 		const UInt8 SourceLength_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x04, 0x06, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00 };
-		const UL SourceLength_UL(SourceLength_UL_Data);
+		const ULConst SourceLength_UL = { SourceLength_UL_Data };
 
 		const UInt8 SourcePackage_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x37, 0x00 };
-		const UL SourcePackage_UL(SourcePackage_UL_Data);
+		const ULConst SourcePackage_UL = { SourcePackage_UL_Data };
 
 		const UInt8 SourcePackageID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00 };
-		const UL SourcePackageID_UL(SourcePackageID_UL_Data);
+		const ULConst SourcePackageID_UL = { SourcePackageID_UL_Data };
 
 		const UInt8 SourceReference_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x00 };
-		const UL SourceReference_UL(SourceReference_UL_Data);
+		const ULConst SourceReference_UL = { SourceReference_UL_Data };
 
 		const UInt8 SourceTrackID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x03, 0x02, 0x00, 0x00, 0x00 };
-		const UL SourceTrackID_UL(SourceTrackID_UL_Data);
+		const ULConst SourceTrackID_UL = { SourceTrackID_UL_Data };
 
 		const UInt8 StartPosition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x03, 0x01, 0x04, 0x00, 0x00 };
-		const UL StartPosition_UL(StartPosition_UL_Data);
+		const ULConst StartPosition_UL = { StartPosition_UL_Data };
 
 		const UInt8 StartTimecode_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x03, 0x01, 0x05, 0x00, 0x00 };
-		const UL StartTimecode_UL(StartTimecode_UL_Data);
+		const ULConst StartTimecode_UL = { StartTimecode_UL_Data };
 
 		const UInt8 StaticTrack_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3a, 0x00 };
-		const UL StaticTrack_UL(StaticTrack_UL_Data);
+		const ULConst StaticTrack_UL = { StaticTrack_UL_Data };
 
 		const UInt8 StoredF2Offset_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x03, 0x02, 0x08, 0x00, 0x00, 0x00 };
-		const UL StoredF2Offset_UL(StoredF2Offset_UL_Data);
+		const ULConst StoredF2Offset_UL = { StoredF2Offset_UL_Data };
 
 		const UInt8 StoredHeight_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x02, 0x01, 0x00, 0x00, 0x00 };
-		const UL StoredHeight_UL(StoredHeight_UL_Data);
+		const ULConst StoredHeight_UL = { StoredHeight_UL_Data };
 
 		const UInt8 StoredWidth_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00 };
-		const UL StoredWidth_UL(StoredWidth_UL_Data);
+		const ULConst StoredWidth_UL = { StoredWidth_UL_Data };
 
 		const UInt8 Stream_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x04, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL Stream_UL(Stream_UL_Data);
+		const ULConst Stream_UL = { Stream_UL_Data };
 
 		const UInt8 StringArray_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StringArray_UL(StringArray_UL_Data);
+		const ULConst StringArray_UL = { StringArray_UL_Data };
 
 		const UInt8 StringElementType_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x0f, 0x00, 0x00, 0x00 };
-		const UL StringElementType_UL(StringElementType_UL_Data);
+		const ULConst StringElementType_UL = { StringElementType_UL_Data };
 
 		const UInt8 StrongRef_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongRef_UL(StrongRef_UL_Data);
+		const ULConst StrongRef_UL = { StrongRef_UL_Data };
 
 		const UInt8 StrongReferenceCodecDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceCodecDefinition_UL(StrongReferenceCodecDefinition_UL_Data);
+		const ULConst StrongReferenceCodecDefinition_UL = { StrongReferenceCodecDefinition_UL_Data };
 
 		const UInt8 StrongReferenceComponent_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceComponent_UL(StrongReferenceComponent_UL_Data);
+		const ULConst StrongReferenceComponent_UL = { StrongReferenceComponent_UL_Data };
 
 		const UInt8 StrongReferenceContainerDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceContainerDefinition_UL(StrongReferenceContainerDefinition_UL_Data);
+		const ULConst StrongReferenceContainerDefinition_UL = { StrongReferenceContainerDefinition_UL_Data };
 
 		const UInt8 StrongReferenceContentStorage_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceContentStorage_UL(StrongReferenceContentStorage_UL_Data);
+		const ULConst StrongReferenceContentStorage_UL = { StrongReferenceContentStorage_UL_Data };
 
 		const UInt8 StrongReferenceDataDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceDataDefinition_UL(StrongReferenceDataDefinition_UL_Data);
+		const ULConst StrongReferenceDataDefinition_UL = { StrongReferenceDataDefinition_UL_Data };
 
 		const UInt8 StrongReferenceDictionary_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceDictionary_UL(StrongReferenceDictionary_UL_Data);
+		const ULConst StrongReferenceDictionary_UL = { StrongReferenceDictionary_UL_Data };
 
 		const UInt8 StrongReferenceEssenceData_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceEssenceData_UL(StrongReferenceEssenceData_UL_Data);
+		const ULConst StrongReferenceEssenceData_UL = { StrongReferenceEssenceData_UL_Data };
 
 		const UInt8 StrongReferenceEssenceDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceEssenceDescriptor_UL(StrongReferenceEssenceDescriptor_UL_Data);
+		const ULConst StrongReferenceEssenceDescriptor_UL = { StrongReferenceEssenceDescriptor_UL_Data };
 
 		const UInt8 StrongReferenceIdentification_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceIdentification_UL(StrongReferenceIdentification_UL_Data);
+		const ULConst StrongReferenceIdentification_UL = { StrongReferenceIdentification_UL_Data };
 
 		const UInt8 StrongReferenceInterpolationDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceInterpolationDefinition_UL(StrongReferenceInterpolationDefinition_UL_Data);
+		const ULConst StrongReferenceInterpolationDefinition_UL = { StrongReferenceInterpolationDefinition_UL_Data };
 
 		const UInt8 StrongReferenceKLVData_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceKLVData_UL(StrongReferenceKLVData_UL_Data);
+		const ULConst StrongReferenceKLVData_UL = { StrongReferenceKLVData_UL_Data };
 
 		const UInt8 StrongReferenceKLVDataDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceKLVDataDefinition_UL(StrongReferenceKLVDataDefinition_UL_Data);
+		const ULConst StrongReferenceKLVDataDefinition_UL = { StrongReferenceKLVDataDefinition_UL_Data };
 
 		const UInt8 StrongReferenceLocator_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceLocator_UL(StrongReferenceLocator_UL_Data);
+		const ULConst StrongReferenceLocator_UL = { StrongReferenceLocator_UL_Data };
 
 		const UInt8 StrongReferenceNetworkLocator_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceNetworkLocator_UL(StrongReferenceNetworkLocator_UL_Data);
+		const ULConst StrongReferenceNetworkLocator_UL = { StrongReferenceNetworkLocator_UL_Data };
 
 		const UInt8 StrongReferencePackage_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferencePackage_UL(StrongReferencePackage_UL_Data);
+		const ULConst StrongReferencePackage_UL = { StrongReferencePackage_UL_Data };
 
 		const UInt8 StrongReferenceParameter_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceParameter_UL(StrongReferenceParameter_UL_Data);
+		const ULConst StrongReferenceParameter_UL = { StrongReferenceParameter_UL_Data };
 
 		const UInt8 StrongReferenceParameterDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceParameterDefinition_UL(StrongReferenceParameterDefinition_UL_Data);
+		const ULConst StrongReferenceParameterDefinition_UL = { StrongReferenceParameterDefinition_UL_Data };
 
 		const UInt8 StrongReferencePluginDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferencePluginDefinition_UL(StrongReferencePluginDefinition_UL_Data);
+		const ULConst StrongReferencePluginDefinition_UL = { StrongReferencePluginDefinition_UL_Data };
 
 		const UInt8 StrongReferencePropertyDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferencePropertyDefinition_UL(StrongReferencePropertyDefinition_UL_Data);
+		const ULConst StrongReferencePropertyDefinition_UL = { StrongReferencePropertyDefinition_UL_Data };
 
 		const UInt8 StrongReferenceSegment_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceSegment_UL(StrongReferenceSegment_UL_Data);
+		const ULConst StrongReferenceSegment_UL = { StrongReferenceSegment_UL_Data };
 
 		const UInt8 StrongReferenceSetClassDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceSetClassDefinition_UL(StrongReferenceSetClassDefinition_UL_Data);
+		const ULConst StrongReferenceSetClassDefinition_UL = { StrongReferenceSetClassDefinition_UL_Data };
 
 		const UInt8 StrongReferenceSetCodecDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceSetCodecDefinition_UL(StrongReferenceSetCodecDefinition_UL_Data);
+		const ULConst StrongReferenceSetCodecDefinition_UL = { StrongReferenceSetCodecDefinition_UL_Data };
 
 		const UInt8 StrongReferenceSetContainerDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceSetContainerDefinition_UL(StrongReferenceSetContainerDefinition_UL_Data);
+		const ULConst StrongReferenceSetContainerDefinition_UL = { StrongReferenceSetContainerDefinition_UL_Data };
 
 		const UInt8 StrongReferenceSetDataDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceSetDataDefinition_UL(StrongReferenceSetDataDefinition_UL_Data);
+		const ULConst StrongReferenceSetDataDefinition_UL = { StrongReferenceSetDataDefinition_UL_Data };
 
 		const UInt8 StrongReferenceSetEssenceData_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceSetEssenceData_UL(StrongReferenceSetEssenceData_UL_Data);
+		const ULConst StrongReferenceSetEssenceData_UL = { StrongReferenceSetEssenceData_UL_Data };
 
 		const UInt8 StrongReferenceSetInterpolationDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceSetInterpolationDefinition_UL(StrongReferenceSetInterpolationDefinition_UL_Data);
+		const ULConst StrongReferenceSetInterpolationDefinition_UL = { StrongReferenceSetInterpolationDefinition_UL_Data };
 
 		const UInt8 StrongReferenceSetKLVDataDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x05, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceSetKLVDataDefinition_UL(StrongReferenceSetKLVDataDefinition_UL_Data);
+		const ULConst StrongReferenceSetKLVDataDefinition_UL = { StrongReferenceSetKLVDataDefinition_UL_Data };
 
 		const UInt8 StrongReferenceSetPackage_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x05, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceSetPackage_UL(StrongReferenceSetPackage_UL_Data);
+		const ULConst StrongReferenceSetPackage_UL = { StrongReferenceSetPackage_UL_Data };
 
 		const UInt8 StrongReferenceSetParameterDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x05, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceSetParameterDefinition_UL(StrongReferenceSetParameterDefinition_UL_Data);
+		const ULConst StrongReferenceSetParameterDefinition_UL = { StrongReferenceSetParameterDefinition_UL_Data };
 
 		const UInt8 StrongReferenceSetPluginDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x05, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceSetPluginDefinition_UL(StrongReferenceSetPluginDefinition_UL_Data);
+		const ULConst StrongReferenceSetPluginDefinition_UL = { StrongReferenceSetPluginDefinition_UL_Data };
 
 		const UInt8 StrongReferenceSetPropertyDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x05, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceSetPropertyDefinition_UL(StrongReferenceSetPropertyDefinition_UL_Data);
+		const ULConst StrongReferenceSetPropertyDefinition_UL = { StrongReferenceSetPropertyDefinition_UL_Data };
 
 		const UInt8 StrongReferenceSetTaggedValueDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x05, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceSetTaggedValueDefinition_UL(StrongReferenceSetTaggedValueDefinition_UL_Data);
+		const ULConst StrongReferenceSetTaggedValueDefinition_UL = { StrongReferenceSetTaggedValueDefinition_UL_Data };
 
 		const UInt8 StrongReferenceSetTypeDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x05, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceSetTypeDefinition_UL(StrongReferenceSetTypeDefinition_UL_Data);
+		const ULConst StrongReferenceSetTypeDefinition_UL = { StrongReferenceSetTypeDefinition_UL_Data };
 
 		const UInt8 StrongReferenceSourceReference_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceSourceReference_UL(StrongReferenceSourceReference_UL_Data);
+		const ULConst StrongReferenceSourceReference_UL = { StrongReferenceSourceReference_UL_Data };
 
 		const UInt8 StrongReferenceTaggedValueDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceTaggedValueDefinition_UL(StrongReferenceTaggedValueDefinition_UL_Data);
+		const ULConst StrongReferenceTaggedValueDefinition_UL = { StrongReferenceTaggedValueDefinition_UL_Data };
 
 		const UInt8 StrongReferenceTrack_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x02, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceTrack_UL(StrongReferenceTrack_UL_Data);
+		const ULConst StrongReferenceTrack_UL = { StrongReferenceTrack_UL_Data };
 
 		const UInt8 StrongReferenceVectorComponent_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceVectorComponent_UL(StrongReferenceVectorComponent_UL_Data);
+		const ULConst StrongReferenceVectorComponent_UL = { StrongReferenceVectorComponent_UL_Data };
 
 		const UInt8 StrongReferenceVectorFileDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x06, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceVectorFileDescriptor_UL(StrongReferenceVectorFileDescriptor_UL_Data);
+		const ULConst StrongReferenceVectorFileDescriptor_UL = { StrongReferenceVectorFileDescriptor_UL_Data };
 
 		const UInt8 StrongReferenceVectorIdentification_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceVectorIdentification_UL(StrongReferenceVectorIdentification_UL_Data);
+		const ULConst StrongReferenceVectorIdentification_UL = { StrongReferenceVectorIdentification_UL_Data };
 
 		const UInt8 StrongReferenceVectorLocator_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceVectorLocator_UL(StrongReferenceVectorLocator_UL_Data);
+		const ULConst StrongReferenceVectorLocator_UL = { StrongReferenceVectorLocator_UL_Data };
 
 		const UInt8 StrongReferenceVectorParameter_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x06, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceVectorParameter_UL(StrongReferenceVectorParameter_UL_Data);
+		const ULConst StrongReferenceVectorParameter_UL = { StrongReferenceVectorParameter_UL_Data };
 
 		const UInt8 StrongReferenceVectorSegment_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceVectorSegment_UL(StrongReferenceVectorSegment_UL_Data);
+		const ULConst StrongReferenceVectorSegment_UL = { StrongReferenceVectorSegment_UL_Data };
 
 		const UInt8 StrongReferenceVectorSubDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x06, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceVectorSubDescriptor_UL(StrongReferenceVectorSubDescriptor_UL_Data);
+		const ULConst StrongReferenceVectorSubDescriptor_UL = { StrongReferenceVectorSubDescriptor_UL_Data };
 
 		const UInt8 StrongReferenceVectorTrack_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x06, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL StrongReferenceVectorTrack_UL(StrongReferenceVectorTrack_UL_Data);
+		const ULConst StrongReferenceVectorTrack_UL = { StrongReferenceVectorTrack_UL_Data };
 
 		const UInt8 StructuralComponent_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00 };
-		const UL StructuralComponent_UL(StructuralComponent_UL_Data);
+		const ULConst StructuralComponent_UL = { StructuralComponent_UL_Data };
 
 		const UInt8 StructuralComponents_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x06, 0x09, 0x00, 0x00 };
-		const UL StructuralComponents_UL(StructuralComponents_UL_Data);
+		const ULConst StructuralComponents_UL = { StructuralComponents_UL_Data };
 
 		const UInt8 SubDescriptors_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x06, 0x01, 0x01, 0x04, 0x06, 0x10, 0x00, 0x00 };
-		const UL SubDescriptors_UL(SubDescriptors_UL_Data);
+		const ULConst SubDescriptors_UL = { SubDescriptors_UL_Data };
 
 		const UInt8 SymbolSpaceURI_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x06, 0x01, 0x01, 0x07, 0x1c, 0x00, 0x00, 0x00 };
-		const UL SymbolSpaceURI_UL(SymbolSpaceURI_UL_Data);
+		const ULConst SymbolSpaceURI_UL = { SymbolSpaceURI_UL_Data };
 
 		const UInt8 TargetSet_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x0b, 0x00, 0x00, 0x00 };
-		const UL TargetSet_UL(TargetSet_UL_Data);
+		const ULConst TargetSet_UL = { TargetSet_UL_Data };
 
 		const UInt8 TextLocator_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x33, 0x00 };
-		const UL TextLocator_UL(TextLocator_UL_Data);
+		const ULConst TextLocator_UL = { TextLocator_UL_Data };
 
 		const UInt8 ThisGenerationUID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00 };
-		const UL ThisGenerationUID_UL(ThisGenerationUID_UL_Data);
+		const ULConst ThisGenerationUID_UL = { ThisGenerationUID_UL_Data };
 
 		const UInt8 ThisPartition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x06, 0x10, 0x10, 0x03, 0x01, 0x00, 0x00, 0x00 };
-		const UL ThisPartition_UL(ThisPartition_UL_Data);
+		const ULConst ThisPartition_UL = { ThisPartition_UL_Data };
 
 		const UInt8 TimeStruct_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL TimeStruct_UL(TimeStruct_UL_Data);
+		const ULConst TimeStruct_UL = { TimeStruct_UL_Data };
 
 		const UInt8 TimebaseReferenceTrackID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x06, 0x01, 0x01, 0x03, 0x0e, 0x00, 0x00, 0x00 };
-		const UL TimebaseReferenceTrackID_UL(TimebaseReferenceTrackID_UL_Data);
+		const ULConst TimebaseReferenceTrackID_UL = { TimebaseReferenceTrackID_UL_Data };
 
 		const UInt8 TimecodeComponent_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x00 };
-		const UL TimecodeComponent_UL(TimecodeComponent_UL_Data);
+		const ULConst TimecodeComponent_UL = { TimecodeComponent_UL_Data };
 
 		const UInt8 Timestamp_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL Timestamp_UL(Timestamp_UL_Data);
+		const ULConst Timestamp_UL = { Timestamp_UL_Data };
 
 		const UInt8 ToolkitVersion_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x0a, 0x00, 0x00, 0x00 };
-		const UL ToolkitVersion_UL(ToolkitVersion_UL_Data);
+		const ULConst ToolkitVersion_UL = { ToolkitVersion_UL_Data };
 
 		const UInt8 Track_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x00 };
-		const UL Track_UL(Track_UL_Data);
+		const ULConst Track_UL = { Track_UL_Data };
 
 		const UInt8 TrackFileID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x06, 0x01, 0x01, 0x06, 0x02, 0x00, 0x00, 0x00 };
-		const UL TrackFileID_UL(TrackFileID_UL_Data);
+		const ULConst TrackFileID_UL = { TrackFileID_UL_Data };
 
 		const UInt8 TrackID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00 };
-		const UL TrackID_UL(TrackID_UL_Data);
+		const ULConst TrackID_UL = { TrackID_UL_Data };
 
 		const UInt8 TrackIDs_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x01, 0x07, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00 };
-		const UL TrackIDs_UL(TrackIDs_UL_Data);
+		const ULConst TrackIDs_UL = { TrackIDs_UL_Data };
 
 		const UInt8 TrackName_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x07, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00 };
-		const UL TrackName_UL(TrackName_UL_Data);
+		const ULConst TrackName_UL = { TrackName_UL_Data };
 
 		const UInt8 TrackNumber_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00 };
-		const UL TrackNumber_UL(TrackNumber_UL_Data);
+		const ULConst TrackNumber_UL = { TrackNumber_UL_Data };
 
 		const UInt8 TrackSegment_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x02, 0x04, 0x00, 0x00 };
-		const UL TrackSegment_UL(TrackSegment_UL_Data);
+		const ULConst TrackSegment_UL = { TrackSegment_UL_Data };
 
 		const UInt8 Tracks_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x06, 0x05, 0x00, 0x00 };
-		const UL Tracks_UL(Tracks_UL_Data);
+		const ULConst Tracks_UL = { Tracks_UL_Data };
 
 		const UInt8 TransferCharacteristic_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x00 };
-		const UL TransferCharacteristic_UL(TransferCharacteristic_UL_Data);
+		const ULConst TransferCharacteristic_UL = { TransferCharacteristic_UL_Data };
 
 		const UInt8 TypeDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00 };
-		const UL TypeDefinition_UL(TypeDefinition_UL_Data);
+		const ULConst TypeDefinition_UL = { TypeDefinition_UL_Data };
 
 		const UInt8 TypeDefinitionCharacter_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x23, 0x00, 0x00 };
-		const UL TypeDefinitionCharacter_UL(TypeDefinitionCharacter_UL_Data);
+		const ULConst TypeDefinitionCharacter_UL = { TypeDefinitionCharacter_UL_Data };
 
 		const UInt8 TypeDefinitionEnumeration_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x07, 0x00, 0x00 };
-		const UL TypeDefinitionEnumeration_UL(TypeDefinitionEnumeration_UL_Data);
+		const ULConst TypeDefinitionEnumeration_UL = { TypeDefinitionEnumeration_UL_Data };
 
 		const UInt8 TypeDefinitionExtendibleEnumeration_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x20, 0x00, 0x00 };
-		const UL TypeDefinitionExtendibleEnumeration_UL(TypeDefinitionExtendibleEnumeration_UL_Data);
+		const ULConst TypeDefinitionExtendibleEnumeration_UL = { TypeDefinitionExtendibleEnumeration_UL_Data };
 
 		const UInt8 TypeDefinitionFixedArray_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x08, 0x00, 0x00 };
-		const UL TypeDefinitionFixedArray_UL(TypeDefinitionFixedArray_UL_Data);
+		const ULConst TypeDefinitionFixedArray_UL = { TypeDefinitionFixedArray_UL_Data };
 
 		const UInt8 TypeDefinitionIndirect_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x21, 0x00, 0x00 };
-		const UL TypeDefinitionIndirect_UL(TypeDefinitionIndirect_UL_Data);
+		const ULConst TypeDefinitionIndirect_UL = { TypeDefinitionIndirect_UL_Data };
 
 		const UInt8 TypeDefinitionInteger_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x04, 0x00, 0x00 };
-		const UL TypeDefinitionInteger_UL(TypeDefinitionInteger_UL_Data);
+		const ULConst TypeDefinitionInteger_UL = { TypeDefinitionInteger_UL_Data };
 
 		const UInt8 TypeDefinitionOpaque_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x22, 0x00, 0x00 };
-		const UL TypeDefinitionOpaque_UL(TypeDefinitionOpaque_UL_Data);
+		const ULConst TypeDefinitionOpaque_UL = { TypeDefinitionOpaque_UL_Data };
 
 		const UInt8 TypeDefinitionRecord_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x0d, 0x00, 0x00 };
-		const UL TypeDefinitionRecord_UL(TypeDefinitionRecord_UL_Data);
+		const ULConst TypeDefinitionRecord_UL = { TypeDefinitionRecord_UL_Data };
 
 		const UInt8 TypeDefinitionRename_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x0e, 0x00, 0x00 };
-		const UL TypeDefinitionRename_UL(TypeDefinitionRename_UL_Data);
+		const ULConst TypeDefinitionRename_UL = { TypeDefinitionRename_UL_Data };
 
 		const UInt8 TypeDefinitionSet_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x0a, 0x00, 0x00 };
-		const UL TypeDefinitionSet_UL(TypeDefinitionSet_UL_Data);
+		const ULConst TypeDefinitionSet_UL = { TypeDefinitionSet_UL_Data };
 
 		const UInt8 TypeDefinitionStream_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x0c, 0x00, 0x00 };
-		const UL TypeDefinitionStream_UL(TypeDefinitionStream_UL_Data);
+		const ULConst TypeDefinitionStream_UL = { TypeDefinitionStream_UL_Data };
 
 		const UInt8 TypeDefinitionString_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x0b, 0x00, 0x00 };
-		const UL TypeDefinitionString_UL(TypeDefinitionString_UL_Data);
+		const ULConst TypeDefinitionString_UL = { TypeDefinitionString_UL_Data };
 
 		const UInt8 TypeDefinitionStrongObjectReference_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x05, 0x00, 0x00 };
-		const UL TypeDefinitionStrongObjectReference_UL(TypeDefinitionStrongObjectReference_UL_Data);
+		const ULConst TypeDefinitionStrongObjectReference_UL = { TypeDefinitionStrongObjectReference_UL_Data };
 
 		const UInt8 TypeDefinitionVariableArray_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x09, 0x00, 0x00 };
-		const UL TypeDefinitionVariableArray_UL(TypeDefinitionVariableArray_UL_Data);
+		const ULConst TypeDefinitionVariableArray_UL = { TypeDefinitionVariableArray_UL_Data };
 
 		const UInt8 TypeDefinitionWeakObjectReference_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x06, 0x00, 0x00 };
-		const UL TypeDefinitionWeakObjectReference_UL(TypeDefinitionWeakObjectReference_UL_Data);
+		const ULConst TypeDefinitionWeakObjectReference_UL = { TypeDefinitionWeakObjectReference_UL_Data };
 
 		const UInt8 TypeDefinitions_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x08, 0x00, 0x00, 0x00 };
-		const UL TypeDefinitions_UL(TypeDefinitions_UL_Data);
+		const ULConst TypeDefinitions_UL = { TypeDefinitions_UL_Data };
 
 		const UInt8 UInt16_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL UInt16_UL(UInt16_UL_Data);
+		const ULConst UInt16_UL = { UInt16_UL_Data };
 
 		const UInt8 UInt32_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL UInt32_UL(UInt32_UL_Data);
+		const ULConst UInt32_UL = { UInt32_UL_Data };
 
 		const UInt8 UInt32Array_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL UInt32Array_UL(UInt32Array_UL_Data);
+		const ULConst UInt32Array_UL = { UInt32Array_UL_Data };
 
 		const UInt8 UInt32Batch_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x04, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL UInt32Batch_UL(UInt32Batch_UL_Data);
+		const ULConst UInt32Batch_UL = { UInt32Batch_UL_Data };
 
 		const UInt8 UInt64_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL UInt64_UL(UInt64_UL_Data);
+		const ULConst UInt64_UL = { UInt64_UL_Data };
 
 		const UInt8 UInt8_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL UInt8_UL(UInt8_UL_Data);
+		const ULConst UInt8_UL = { UInt8_UL_Data };
 
 		const UInt8 UInt8Array_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL UInt8Array_UL(UInt8Array_UL_Data);
+		const ULConst UInt8Array_UL = { UInt8Array_UL_Data };
 
 		const UInt8 UL_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL UL_UL(UL_UL_Data);
+		const ULConst UL_UL = { UL_UL_Data };
 
 		const UInt8 UMID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL UMID_UL(UMID_UL_Data);
+		const ULConst UMID_UL = { UMID_UL_Data };
 
 		const UInt8 URLString_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00 };
-		const UL URLString_UL(URLString_UL_Data);
+		const ULConst URLString_UL = { URLString_UL_Data };
 
 		const UInt8 UTF16_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL UTF16_UL(UTF16_UL_Data);
+		const ULConst UTF16_UL = { UTF16_UL_Data };
 
 		const UInt8 UTF16String_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL UTF16String_UL(UTF16String_UL_Data);
+		const ULConst UTF16String_UL = { UTF16String_UL_Data };
 
 		const UInt8 UTF7String_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x20, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL UTF7String_UL(UTF7String_UL_Data);
+		const ULConst UTF7String_UL = { UTF7String_UL_Data };
 
 		const UInt8 UUID_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL UUID_UL(UUID_UL_Data);
+		const ULConst UUID_UL = { UUID_UL_Data };
 
 		const UInt8 UnknownChunk_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4f, 0x00 };
-		const UL UnknownChunk_UL(UnknownChunk_UL_Data);
+		const ULConst UnknownChunk_UL = { UnknownChunk_UL_Data };
 
 		const UInt8 UserDataMode_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x04, 0x00, 0x00, 0x00 };
-		const UL UserDataMode_UL(UserDataMode_UL_Data);
+		const ULConst UserDataMode_UL = { UserDataMode_UL_Data };
 
 		const UInt8 VBIDataDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5b, 0x00 };
-		const UL VBIDataDescriptor_UL(VBIDataDescriptor_UL_Data);
+		const ULConst VBIDataDescriptor_UL = { VBIDataDescriptor_UL_Data };
 
 		const UInt8 VariableArrayElementType_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x0d, 0x00, 0x00, 0x00 };
-		const UL VariableArrayElementType_UL(VariableArrayElementType_UL_Data);
+		const ULConst VariableArrayElementType_UL = { VariableArrayElementType_UL_Data };
 
 		const UInt8 Version_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x01, 0x05, 0x00, 0x00, 0x00 };
-		const UL Version_UL(Version_UL_Data);
+		const ULConst Version_UL = { Version_UL_Data };
 
 		const UInt8 VersionString_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x05, 0x01, 0x00, 0x00 };
-		const UL VersionString_UL(VersionString_UL_Data);
+		const ULConst VersionString_UL = { VersionString_UL_Data };
 
 		const UInt8 VersionType_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL VersionType_UL(VersionType_UL_Data);
+		const ULConst VersionType_UL = { VersionType_UL_Data };
 
 		const UInt8 VerticalSubsampling_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x01, 0x10, 0x00, 0x00, 0x00 };
-		const UL VerticalSubsampling_UL(VerticalSubsampling_UL_Data);
+		const ULConst VerticalSubsampling_UL = { VerticalSubsampling_UL_Data };
 
 		const UInt8 VideoLineMap_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x03, 0x02, 0x05, 0x00, 0x00, 0x00 };
-		const UL VideoLineMap_UL(VideoLineMap_UL_Data);
+		const ULConst VideoLineMap_UL = { VideoLineMap_UL_Data };
 
 		const UInt8 WaveAudioDescriptor_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00 };
-		const UL WaveAudioDescriptor_UL(WaveAudioDescriptor_UL_Data);
+		const ULConst WaveAudioDescriptor_UL = { WaveAudioDescriptor_UL_Data };
 
 		const UInt8 WeakRef_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL WeakRef_UL(WeakRef_UL_Data);
+		const ULConst WeakRef_UL = { WeakRef_UL_Data };
 
 		const UInt8 WeakReferenceArrayTypeDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL WeakReferenceArrayTypeDefinition_UL(WeakReferenceArrayTypeDefinition_UL_Data);
+		const ULConst WeakReferenceArrayTypeDefinition_UL = { WeakReferenceArrayTypeDefinition_UL_Data };
 
 		const UInt8 WeakReferenceParameterDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL WeakReferenceParameterDefinition_UL(WeakReferenceParameterDefinition_UL_Data);
+		const ULConst WeakReferenceParameterDefinition_UL = { WeakReferenceParameterDefinition_UL_Data };
 
 		const UInt8 WeakReferenceSetParameterDefinition_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x05, 0x03, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00 };
-		const UL WeakReferenceSetParameterDefinition_UL(WeakReferenceSetParameterDefinition_UL_Data);
+		const ULConst WeakReferenceSetParameterDefinition_UL = { WeakReferenceSetParameterDefinition_UL_Data };
 
 		const UInt8 WeakReferencedType_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x0a, 0x00, 0x00, 0x00 };
-		const UL WeakReferencedType_UL(WeakReferencedType_UL_Data);
+		const ULConst WeakReferencedType_UL = { WeakReferencedType_UL_Data };
 
 		const UInt8 WhiteReflevel_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x03, 0x04, 0x00, 0x00, 0x00 };
-		const UL WhiteReflevel_UL(WhiteReflevel_UL_Data);
+		const ULConst WhiteReflevel_UL = { WhiteReflevel_UL_Data };
 
 		const UInt8 XOsiz_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x04, 0x00, 0x00, 0x00 };
-		const UL XOsiz_UL(XOsiz_UL_Data);
+		const ULConst XOsiz_UL = { XOsiz_UL_Data };
 
 		const UInt8 XTOsiz_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x08, 0x00, 0x00, 0x00 };
-		const UL XTOsiz_UL(XTOsiz_UL_Data);
+		const ULConst XTOsiz_UL = { XTOsiz_UL_Data };
 
 		const UInt8 XTsiz_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x06, 0x00, 0x00, 0x00 };
-		const UL XTsiz_UL(XTsiz_UL_Data);
+		const ULConst XTsiz_UL = { XTsiz_UL_Data };
 
 		const UInt8 Xsiz_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x02, 0x00, 0x00, 0x00 };
-		const UL Xsiz_UL(Xsiz_UL_Data);
+		const ULConst Xsiz_UL = { Xsiz_UL_Data };
 
 		const UInt8 YOsiz_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x05, 0x00, 0x00, 0x00 };
-		const UL YOsiz_UL(YOsiz_UL_Data);
+		const ULConst YOsiz_UL = { YOsiz_UL_Data };
 
 		const UInt8 YTOsiz_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x09, 0x00, 0x00, 0x00 };
-		const UL YTOsiz_UL(YTOsiz_UL_Data);
+		const ULConst YTOsiz_UL = { YTOsiz_UL_Data };
 
 		const UInt8 YTsiz_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x07, 0x00, 0x00, 0x00 };
-		const UL YTsiz_UL(YTsiz_UL_Data);
+		const ULConst YTsiz_UL = { YTsiz_UL_Data };
 
 		const UInt8 Year_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00 };
-		const UL Year_UL(Year_UL_Data);
+		const ULConst Year_UL = { Year_UL_Data };
 
 		const UInt8 Ysiz_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x03, 0x00, 0x00, 0x00 };
-		const UL Ysiz_UL(Ysiz_UL_Data);
+		const ULConst Ysiz_UL = { Ysiz_UL_Data };
 
 		const UInt8 msBy4_UL_Data[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00 };
-		const UL msBy4_UL(msBy4_UL_Data);
+		const ULConst msBy4_UL = { msBy4_UL_Data };
 
 	} // namespace mxflib
@@ -124,6 +124,8 @@ static bool SplitParts = false;		// -p
 static bool FullIndex = false;		// -f dump full index
 static bool OPPercentage=false;
 static bool DumpExtraneous = false;		// -x dump extraneous body elements
+static bool ExtractTrack = false;		// -t extract a single track
+static UInt32 ExtractTrackNumber = 0;	// -t=n
 #ifndef _WIN32
 #define MAX_PATH 1024
 #endif
@@ -147,8 +149,10 @@ PartitionPtr FindLatestClosedPartitionHeaderMetadata( MXFFile* File );
 static void DumpHeader(PartitionPtr ThisPartition);
 static void DumpIndex(PartitionPtr ThisPartition);
 static void DumpBody(PartitionPtr ThisPartition, EssenceInfoPtr &EssenceLookup);
+static void ExtractTrackElements(MXFFilePtr &File, EssenceInfoPtr &EssenceLookup);
 
 Position  MXFFileLen; //used to estimate %age done
+Position  ReadPos = 0; //position of the last essence read, used to show %age done as reads are positional and do not move the file pointer
 Uint64    DoneSoFar=0;
 
 
@@ -309,8 +313,7 @@ namespace mxflib
 		virtual bool PutEssenceData(UInt8 const *Buffer, size_t BufferSize, bool EndOfItem = true)
 		{
 			static char msg[50];
-			Position Pos = SourceFile->Tell();
-			sprintf(msg,"%%%d\n",(int)((Pos*100)/FileSize));
+			sprintf(msg,"%%%d\n",(int)((ReadPos*100)/FileSize));
 			fputs(msg,stderr);
 
 			return Sink->PutEssenceData(Buffer, BufferSize, EndOfItem);
@@ -546,7 +549,8 @@ int main_process(int argc, char *argv[])
 {
 	printf("MXFlib File Splitter\n" );
 
-	// Load the dictionaries
+	// Load the dictionaries, only building the definitions that are used by the file
+	SetFeature(FeatureLazyDictionary);
 	LoadDictionary( DictData );
 
 	int num_options = 0;
@@ -626,6 +630,14 @@ int main_process(int argc, char *argv[])
 				PauseBeforeExit = true;
 			}
 			else if(Opt == 'x') DumpExtraneous = true;
+			else if(Opt == 't')
+			{
+				ExtractTrack = true;
+				if( argv[i][2]==':' || argv[i][2]=='=' )
+				{
+					ExtractTrackNumber = (UInt32)strtoul( argv[i]+3, NULL, 0 );
+				}
+			}
 		}
 	}
 
@@ -645,6 +657,8 @@ int main_process(int argc, char *argv[])
 		//fprintf( stderr,"                       [-s] Subdivide AESBWF Elements into stereo wave files \n" );
 		//fprintf( stderr,"                       [-p] Split Partitions \n");
 		fprintf( stderr,"                       [-x] Dump Extraneous Body Elements \n" );
+		fprintf( stderr,"                     [-t=n] Extract only the essence elements with track number n\n" );
+		fprintf( stderr,"                                    (other elements are stepped over without being read)\n" );
 		fprintf( stderr,"                       [-r <first frame> <nframes> ] Output a region of the MXF file\n");
 		fprintf( stderr,"                       [-z] Pause for input before final exit\n");
 		fprintf( stderr,"             [-dd=filename] Use DM dictionary \n" );
@@ -675,8 +689,14 @@ int main_process(int argc, char *argv[])
 	// If we don't already have one, get a RIP (however possible)
 	if(TestFile->FileRIP.empty()) TestFile->GetRIP();
 
-	// Iterate over Partitions
+	// Iterate over Partitions, unless extracting a single track
 	RIP::iterator it = TestFile->FileRIP.begin();
+	if(ExtractTrack)
+	{
+		ExtractTrackElements(TestFile, EssenceLookup);
+		it = TestFile->FileRIP.end();
+	}
+
 	UInt32 iPart = 0;
 	while(it != TestFile->FileRIP.end())
 	{
@@ -687,6 +707,21 @@ int main_process(int argc, char *argv[])
 		                       Int64toHexString((*it).second->ByteOffset,8).c_str(),
 													 (*it).second->BodySID );
 
+		// Ask for the start of the next partition to be read in the background while this one is processed
+		RIP::iterator next_it = it;
+		next_it++;
+		if(next_it != TestFile->FileRIP.end())
+		{
+			const Length MaxReadAhead = 64 * 1024 * 1024;
+
+			RIP::iterator after_it = next_it;
+			after_it++;
+
+			Position NextStart = (*next_it).second->ByteOffset;
+			Position NextEnd = (after_it != TestFile->FileRIP.end()) ? (*after_it).second->ByteOffset : MXFFileLen;
+			TestFile->ReadAhead(NextStart, (NextEnd - NextStart) > MaxReadAhead ? MaxReadAhead : (NextEnd - NextStart));
+		}
+
 		TestFile->Seek((*it).second->ByteOffset);
 		PartitionPtr ThisPartition = TestFile->ReadPartition();
 		if(ThisPartition)
@@ -1270,6 +1305,274 @@ EssenceInfoPtr BuildEssenceInfo(MXFFilePtr &File)
 
 
 
+//! Get the sink that writes a GC essence element to its stream file
+/*! The stream file is named from the BodySID and element kind. For the first element of each stream the file is opened
+ *  and a WaveFileSink or RawFileSink built for it, wrapped in a PartialSink and ShowPercentSink if the options ask for them.
+ *  When dividing into multiple files a new file and sink are made for every element.
+ *  \note The "GC Element:" progress line is printed without its trailing newline
+ *  \return NULL if the file could not be opened
+ */
+static EssenceSinkPtr GetStreamSink(KLVObjectPtr &Element, UInt32 BodySID, EssenceInfoPtr &EssenceLookup, MXFFile *SourceFile)
+{
+	GCElementKind kind = Element->GetGCElementKind();
+
+	char filename[SZ_OP_DIR+40];
+	snprintf(	filename, sizeof(filename), "%s_%04x_%02x%02x%02x%02x.stream", 
+						OPdir,
+						BodySID,
+						kind.Item,
+						kind.Count,
+						kind.ElementType,
+						kind.Number );
+	if( !Quiet )
+	{
+		printf( "GC Element: L=0x%s", Int64toHexString( Element->GetLength(), 8 ).c_str());
+		if(!DivideFiles) printf(" File=%s",	filename );
+	}
+
+	if(!DivideFiles)
+	{
+		FileMap::iterator itFile = theStreams.find( filename );
+		if(itFile != theStreams.end()) return (*itFile).second.Sink;
+
+		if( !Quiet ) printf( " NEW" );
+	}
+
+	// Open the file
+	FileHandle ThisFile;
+	if(DivideFiles)
+	{
+		ListMan->GetNextFile();
+		if(!Quiet) printf(" File=%s", ListMan->FileName().c_str());
+		ThisFile = ListMan->GetCurrentFile();
+	}
+	else ThisFile = FileOpenNew(filename);
+
+	if( !FileValid(ThisFile) )
+	{
+		if( !Quiet ) printf( " ERROR");
+		return NULL;
+	}
+
+	EssenceSinkPtr ThisSink;
+
+	TrackPtr Track;					//!< Pointer to the top-level source package for this stream
+	MDObjectPtr Descriptor;			//!< Pointer to the file descriptor for this stream
+
+	EssenceStreamInfoMap::iterator it = EssenceLookup->Lookup.find(BodySID);
+	if(it == EssenceLookup->Lookup.end())
+	{
+		warning("BodySID %d not listed in header metadata\n", BodySID);
+
+		// Add a dummy entry so we don't keep getting the same error
+		EssenceStreamInfo Dummy;
+		EssenceLookup->Lookup[BodySID] = Dummy;
+	}
+	else
+	{
+		if((*it).second.Package)
+		{
+			UInt32 TrackNumber = Element->GetGCTrackNumber();
+			int TrackPos = 0;			//!< The entry number in the tracks array, and possibly the descriptor list, of this track
+			
+			TrackList::iterator Track_it = (*it).second.Package->Tracks.begin();
+			while(Track_it != (*it).second.Package->Tracks.end())
+			{
+				if((*Track_it)->GetUInt(TrackNumber_UL) == TrackNumber)
+				{
+					Track = (*Track_it);
+					break;
+				}
+
+				// DRAGONS: We don't count timecode tracks as we assume that these don't have descriptors
+				if(!(*Track_it)->IsTimecodeTrack()) TrackPos++;
+				Track_it++;
+			}
+
+			if(!Track)
+			{
+				warning("Track Number 0x%08x for BodySID %d, not listed in header metadata\n", TrackNumber, BodySID);
+				// TODO: Should we add something to stop a repeat of this error?
+			}
+			else
+			{
+				bool HasTrackID = false;
+				UInt32 TrackID = 0;
+
+				MDObjectPtr TrackIDObject = Track[TrackID_UL];
+				if(TrackIDObject)
+				{
+					HasTrackID = true;
+					TrackID = TrackIDObject->GetUInt();
+				}
+
+				if((*it).second.Descriptor)
+				{
+					// DRAGONS: If we don't have a multi-descriptor then this descriptor must describe anything we have
+					Descriptor = (*it).second.Descriptor;
+
+					if(Descriptor->IsA(MultipleDescriptor_UL))
+					{
+						MDObjectPtr DescriptorList = Descriptor[FileDescriptors_UL];
+						if(DescriptorList)
+						{
+							int DescriptorPos = 0;
+
+							MDObject::iterator it = DescriptorList->begin();
+							while(it != DescriptorList->end())
+							{
+								MDObjectPtr SubDescriptor = (*it).second->GetLink();
+								if(SubDescriptor)
+								{
+									if(!HasTrackID)
+									{
+										// Track has no TrackID parameter, fall-back to position linking
+										if(DescriptorPos == TrackPos)
+										{
+											Descriptor = SubDescriptor;
+											break;
+										}
+									}
+									else
+									{
+										MDObjectPtr LinkedTrackIDObject = SubDescriptor->Child(LinkedTrackID_UL);
+										if(LinkedTrackIDObject)
+										{
+											UInt32 LinkedTrackID = LinkedTrackIDObject->GetUInt();
+
+											if(LinkedTrackID == TrackID)
+											{
+												Descriptor = SubDescriptor;
+												break;
+											}
+										}
+										else
+										{
+											// Descriptor has no LinkedTrackID parameter, fall-back to position linking
+											if(DescriptorPos == TrackPos)
+											{
+												Descriptor = SubDescriptor;
+												break;
+											}
+										}
+									}
+								}
+
+								DescriptorPos++;
+								it++;
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	if(!Descriptor)
+	{
+		// If we couldn't find a descriptor we can't get fancy with unwrapping the essence
+		ThisSink = new RawFileSink(ThisFile);
+	}
+	else
+	{
+		if(SplitWave && Track && (Track->GetTrackType() == Track::TrackTypeSoundEssence) && (Descriptor->IsA(GenericSoundEssenceDescriptor_UL)))
+		{
+			UInt32 ChannelCount = Descriptor->GetUInt(ChannelCount_UL);
+			UInt32 QuantizationBits = Descriptor->GetUInt(QuantizationBits_UL);
+			
+			// Assume 48k if we have problems!
+			Int32 AudioSamplingRate = 48000;
+
+			MDObjectPtr SamplingRate = Descriptor[AudioSamplingRate_UL];
+			if(SamplingRate)
+			{
+				AudioSamplingRate = SamplingRate->GetInt("Numerator");
+				Int32 Denom = SamplingRate->GetInt("Denominator");
+				if(Denom != 0) AudioSamplingRate /= Denom;
+			}
+
+			ThisSink = new WaveFileSink(ThisFile, (int)ChannelCount, AudioSamplingRate, (int)QuantizationBits);
+
+			if( !Quiet ) printf( " Wave" );
+		}
+		else
+		{
+			ThisSink = new RawFileSink(ThisFile);
+		}
+	}
+
+	/* Add partial filter if required */
+	if(nFrames != -1)
+	{
+		ThisSink = new PartialSink(ThisSink, firstFrame, nFrames);
+	}
+
+	/* Add percentage filter if required */
+	if(OPPercentage)
+	{
+		ThisSink = new ShowPercentSink(ThisSink, SourceFile , MXFFileLen);
+	}
+
+	if(!DivideFiles)
+	{
+		StreamFile sf;
+		sf.file = ThisFile; 
+		sf.kind = kind;
+		sf.Sink = ThisSink;
+		theStreams.insert( FileMap::value_type(filename, sf) );
+	}
+
+	return ThisSink;
+}
+
+
+//! Copy the value of a GC essence element to its sink in manageable chunks
+/*! When dividing into multiple files the element's file is closed once it has been written
+ *  \return false if the value could not be read or written
+ */
+static bool WriteStreamElement(KLVObjectPtr &Element, EssenceSinkPtr &ThisSink)
+{
+	bool Ret = true;
+
+	// Limit chunk size to 32Mb
+	const Length MaxSize = 32 * 1024 * 1024;
+
+	Position Offset = 0;
+	for(;;)
+	{
+		// Work out the chunk-size
+		Length CurrentSize = Element->GetLength() - (Length)Offset;
+		if(CurrentSize <= 0) break;
+		if(CurrentSize > MaxSize) CurrentSize = MaxSize;
+
+		size_t Bytes = Element->ReadDataFrom(Offset, static_cast<size_t>(CurrentSize));
+		if(!Bytes)
+		{
+			Ret = false;
+			break;
+		}
+		Offset += Bytes;
+		ReadPos = Element->GetLocation() + Element->GetKLSize() + Offset;
+
+		// FIXME: Need to add end-of-element
+		if(!ThisSink->PutEssenceData(Element->GetData()))
+		{
+			Ret = false;
+			break;
+		}
+	}
+
+	// If we are dividing into multiple files then we are done with this one
+	if(DivideFiles)
+	{
+		ThisSink->EndOfData();
+		ListMan->CloseFile();
+	}
+
+	return Ret;
+}
+
+
 void DumpBody(PartitionPtr ThisPartition, EssenceInfoPtr &EssenceLookup)
 {
 
@@ -1283,10 +1586,6 @@ void DumpBody(PartitionPtr ThisPartition, EssenceInfoPtr &EssenceLookup)
 	{
 		if( !Quiet ) printf( "Elements for BodySID 0x%04x\n", BodySID );
 
-		char filename[MAX_PATH+40] = "_12345678_iiccttnn-Mcc-Ppppp.Stream";
-
-		FileMap::iterator itFile;
-
 		int limit=0;
 
 		KLVObjectPtr anElement;
@@ -1338,271 +1637,123 @@ void DumpBody(PartitionPtr ThisPartition, EssenceInfoPtr &EssenceLookup)
 			}
 			else
 			{
-				// The current file
-				FileHandle ThisFile;
-				
-				sprintf(	filename, "%s_%04x_%02x%02x%02x%02x.stream", 
-									OPdir,
-									BodySID,
-									kind.Item,
-									kind.Count,
-									kind.ElementType,
-									kind.Number );
-				if( !Quiet )
-				{
-					printf( "GC Element: L=0x%s", Int64toHexString( anElement->GetLength(), 8 ).c_str());
-					if(!DivideFiles) printf(" File=%s",	filename );
-				}
+				ThisSink = GetStreamSink(anElement, BodySID, EssenceLookup, ThisPartition->GetParentFile());
 
-				bool StreamFound = false;
-				if(!DivideFiles)
-				{
-					itFile = theStreams.find( filename );
-					if(itFile != theStreams.end()) 
-					{
-						ThisFile = (*itFile).second.file;
-						ThisSink = (*itFile).second.Sink;
-						StreamFound = true;
-					}
-				}
-
-				if( !StreamFound )
-				{
-					if( (!Quiet) && (!DivideFiles) ) printf( " NEW" );
-
-					// Open the file
-					if(DivideFiles)
-					{
-						ListMan->GetNextFile();
-						if(!Quiet) printf(" File=%s", ListMan->FileName().c_str());
-						ThisFile = ListMan->GetCurrentFile();
-					}
-					else ThisFile = FileOpenNew(filename);
+				if( !Quiet ) printf( "\n" );
 
-					if( !FileValid(ThisFile) ) if( !Quiet ) printf( " ERROR");
+				if(ThisSink) WriteStreamElement(anElement, ThisSink);
+			}
 
-					if( FileValid(ThisFile) )
-					{
-						TrackPtr Track;					//!< Pointer to the top-level source package for this stream
-						MDObjectPtr Descriptor;			//!< Pointer to the file descriptor for this stream
+			// Stop processing at the end of the partial clip (if we are doing partial)
+			if((nFrames != -1) && (ThisSink)) 
+			{
+				IPartial *Partial = dynamic_cast<IPartial *>(ThisSink.GetPtr());
+				if((Partial) && (Partial->EndOfPartial())) break;
+			}
+		}
+	} // if( 0==BodySID )
+	return;
+}
 
-						EssenceStreamInfoMap::iterator it = EssenceLookup->Lookup.find(BodySID);
-						if(it == EssenceLookup->Lookup.end())
-						{
-							warning("BodySID %d not listed in header metadata\n", BodySID);
 
-							// Add a dummy entry so we don't keep getting the same error
-							EssenceStreamInfo Dummy;
-							EssenceLookup->Lookup[BodySID] = Dummy;
-						}
-						else
-						{
-							if((*it).second.Package)
-							{
-								UInt32 TrackNumber = anElement->GetGCTrackNumber();
-								int TrackPos = 0;			//!< The entry number in the tracks array, and possibly the descriptor list, of this track
-								
-								TrackList::iterator Track_it = (*it).second.Package->Tracks.begin();
-								while(Track_it != (*it).second.Package->Tracks.end())
-								{
-									if((*Track_it)->GetUInt(TrackNumber_UL) == TrackNumber)
-									{
-										Track = (*Track_it);
-										break;
-									}
+namespace
+{
+	//! Read handler that writes each essence element it receives to the stream file for that element
+	class TrackExtractHandler : public GCReadHandler_Base
+	{
+	protected:
+		UInt32 BodySID;							//!< The BodySID of the stream being read
+		EssenceInfoPtr EssenceLookup;			//!< Header metadata info used to choose the sink for each stream
+		MXFFile *SourceFile;					//!< The file being read, for showing the percentage done
 
-									// DRAGONS: We don't count timecode tracks as we assume that these don't have descriptors
-									if(!(*Track_it)->IsTimecodeTrack()) TrackPos++;
-									Track_it++;
-								}
+	public:
+		TrackExtractHandler(UInt32 BodySID, EssenceInfoPtr &EssenceLookup, MXFFile *SourceFile) 
+			: BodySID(BodySID), EssenceLookup(EssenceLookup), SourceFile(SourceFile) {}
 
-								if(!Track)
-								{
-									warning("Track Number 0x%08x for BodySID %d, not listed in header metadata\n", TrackNumber, BodySID);
-									// TODO: Should we add something to stop a repeat of this error?
-								}
-								else
-								{
-									bool HasTrackID = false;
-									UInt32 TrackID = 0;
+		//! Handle a "chunk" of data that has been read from the file
+		/*! \return true if all OK, false on error 
+		 */
+		virtual bool HandleData(GCReaderPtr Caller, KLVObjectPtr Object)
+		{
+			if(!Object->GetGCElementKind().IsValid) return true;
 
-									MDObjectPtr TrackIDObject = Track[TrackID_UL];
-									if(TrackIDObject)
-									{
-										HasTrackID = true;
-										TrackID = TrackIDObject->GetUInt();
-									}
+			EssenceSinkPtr ThisSink = GetStreamSink(Object, BodySID, EssenceLookup, SourceFile);
 
-									if((*it).second.Descriptor)
-									{
-										// DRAGONS: If we don't have a multi-descriptor then this descriptor must describe anything we have
-										Descriptor = (*it).second.Descriptor;
+			if( !Quiet ) printf( "\n" );
 
-										if(Descriptor->IsA(MultipleDescriptor_UL))
-										{
-											MDObjectPtr DescriptorList = Descriptor[FileDescriptors_UL];
-											if(DescriptorList)
-											{
-												int DescriptorPos = 0;
-
-												MDObject::iterator it = DescriptorList->begin();
-												while(it != DescriptorList->end())
-												{
-													MDObjectPtr SubDescriptor = (*it).second->GetLink();
-													if(SubDescriptor)
-													{
-														if(!HasTrackID)
-														{
-															// Track has no TrackID parameter, fall-back to position linking
-															if(DescriptorPos == TrackPos)
-															{
-																Descriptor = SubDescriptor;
-																break;
-															}
-														}
-														else
-														{
-															MDObjectPtr LinkedTrackIDObject = SubDescriptor->Child(LinkedTrackID_UL);
-															if(LinkedTrackIDObject)
-															{
-																UInt32 LinkedTrackID = LinkedTrackIDObject->GetUInt();
-
-																if(LinkedTrackID == TrackID)
-																{
-																	Descriptor = SubDescriptor;
-																	break;
-																}
-															}
-															else
-															{
-																// Descriptor has no LinkedTrackID parameter, fall-back to position linking
-																if(DescriptorPos == TrackPos)
-																{
-																	Descriptor = SubDescriptor;
-																	break;
-																}
-															}
-														}
-													}
-
-													DescriptorPos++;
-													it++;
-												}
-											}
-										}
-									}
-								}
-							}
-						}
+			if(!ThisSink) return false;
+			if(!WriteStreamElement(Object, ThisSink)) return false;
 
-						if(!Descriptor)
-						{
-							// If we couldn't find a descriptor we can't get fancy with unwrapping the essence
-							ThisSink = new RawFileSink(ThisFile);
-						}
-						else
-						{
-							if(SplitWave && Track && (Track->GetTrackType() == Track::TrackTypeSoundEssence) && (Descriptor->IsA(GenericSoundEssenceDescriptor_UL)))
-							{
-								UInt32 ChannelCount = Descriptor->GetUInt(ChannelCount_UL);
-								UInt32 QuantizationBits = Descriptor->GetUInt(QuantizationBits_UL);
-								
-								// Assume 48k if we have problems!
-								Int32 AudioSamplingRate = 48000;
-
-								MDObjectPtr SamplingRate = Descriptor[AudioSamplingRate_UL];
-								if(SamplingRate)
-								{
-									AudioSamplingRate = SamplingRate->GetInt("Numerator");
-									Int32 Denom = SamplingRate->GetInt("Denominator");
-									if(Denom != 0) AudioSamplingRate /= Denom;
-								}
+			// Stop reading at the end of the partial clip (if we are doing partial)
+			if(nFrames != (unsigned int)-1)
+			{
+				IPartial *Partial = dynamic_cast<IPartial *>(ThisSink.GetPtr());
+				if((Partial) && (Partial->EndOfPartial())) Caller->StopReading();
+			}
 
-									ThisSink = new WaveFileSink(ThisFile, (int)ChannelCount, AudioSamplingRate, (int)QuantizationBits);
+			return true;
+		}
+	};
+}
 
-								if( !Quiet ) printf( " Wave" );
-							}
-							else
-							{
-								ThisSink = new RawFileSink(ThisFile);
-							}
-						}
 
-						/* Add partial filter if required */
-						if(nFrames != -1)
-						{
-							ThisSink = new PartialSink(ThisSink, firstFrame, nFrames);
-						}
+//! Extract the essence elements of a single track from all body streams
+/*! The body is read with a BodyReader that only has a handler for the requested track number,
+ *  so the elements of all other tracks are stepped over without their values being read.
+ *  Any index tables in the file are used to read ahead the edit units about to be extracted
+ */
+void ExtractTrackElements(MXFFilePtr &File, EssenceInfoPtr &EssenceLookup)
+{
+	if( !Quiet ) printf( "\nExtracting track number 0x%08x\n\n", ExtractTrackNumber );
 
-						/* Add percentage filter if required */
-						if(OPPercentage)
-						{
-							ThisSink = new ShowPercentSink(ThisSink, ThisPartition->GetParentFile() , MXFFileLen);
-						}
+	BodyReaderPtr BodyParser = new BodyReader(File);
 
-						if(!DivideFiles)
-						{
-							StreamFile sf;
-							sf.file = ThisFile; 
-							sf.kind = kind;
-							sf.Sink = ThisSink;
-							theStreams.insert( FileMap::value_type(filename, sf) );
-						}
-					}
+	// Index tables built from the segments in all partitions, indexed by IndexSID
+	std::map<UInt32, IndexTablePtr> Indexes;
 
-/*					// if( -w && GCSound item) add an empty waveheader
-					// DRAGONS: if a user says -w, we assume S382M
-					if( FileValid(ThisFile) && SplitWave && 0x16==kind.Item )
-					{
-						if( !Quiet ) printf( " Wave" );
-						// assume 48000, 24 bit at this stage
-						WriteWaveHeader(ThisFile, SplitWaveChannels, 48000, 24);
-					}
-*/
-				}
+	// Build a GCReader for each body stream with a handler for only the requested track, and gather the index tables
+	RIP::iterator it = File->FileRIP.begin();
+	while(it != File->FileRIP.end())
+	{
+		UInt32 BodySID = (*it).second->BodySID;
+		if(BodySID && !BodyParser->GetGCReader(BodySID))
+		{
+			BodyParser->MakeGCReader(BodySID);
+			BodyParser->GetGCReader(BodySID)->SetDataHandler(ExtractTrackNumber, new TrackExtractHandler(BodySID, EssenceLookup, File));
+		}
 
-				if( !Quiet ) printf( "\n" );
+		PartitionPtr ThisPartition = File->ReadPartitionAt((*it).second->ByteOffset);
+		if(ThisPartition)
+		{
+			UInt32 IndexSID = ThisPartition->GetUInt(IndexSID_UL);
+			DataChunkPtr IndexChunk;
+			if(IndexSID) IndexChunk = ThisPartition->ReadIndexChunk();
+			if(IndexChunk)
+			{
+				IndexTablePtr &Index = Indexes[IndexSID];
+				if(!Index) Index = new IndexTable;
+				Index->AddSegments(IndexChunk);
+			}
+		}
 
-				/* Copy the essence KLV to the output file in manageable chunks */
-	
-				// Limit chunk size to 32Mb
-				const Length MaxSize = 32 * 1024 * 1024;
+		it++;
+	}
 
-				Position Offset = 0;
-				for(;;)
-				{
-					// Work out the chunk-size
-					Length CurrentSize = anElement->GetLength() - (Length)Offset;
-					if(CurrentSize <= 0) break;
-					if(CurrentSize > MaxSize) CurrentSize = MaxSize;
-
-					size_t Bytes = anElement->ReadDataFrom(Offset, static_cast<size_t>(CurrentSize));
-					if(!Bytes) break;
-					Offset += Bytes;
-
-					//if(FileValid(ThisFile)) FileWrite(ThisFile, anElement->GetData().Data, anElement->GetData().Size);
-					// FIXME: Need to add end-of-element
-					if(ThisSink) ThisSink->PutEssenceData(anElement->GetData());
-				}
+	// Read ahead the edit units of each indexed stream as it is extracted
+	std::map<UInt32, IndexTablePtr>::iterator Index_it = Indexes.begin();
+	while(Index_it != Indexes.end())
+	{
+		BodyParser->SetReadAhead((*Index_it).second->BodySID, (*Index_it).second);
+		Index_it++;
+	}
 
-				// If we are dividing into multiple files then we are done with this one
-				if(DivideFiles)
-				{
-					//if( SplitWave && 0x16==(*itFile).second.kind.Item ) UpdateWaveLengths(ThisFile);
-					if(ThisSink) ThisSink->EndOfData();
-					ListMan->CloseFile();
-				}
-			}
+	// Don't read the values of any elements that are not being extracted
+	BodyParser->SetSkipUnhandled();
 
-			// Stop processing at the end of the partial clip (if we are doing partial)
-			if((nFrames != -1) && (ThisSink)) 
-			{
-				IPartial *Partial = dynamic_cast<IPartial *>(ThisSink.GetPtr());
-				if((Partial) && (Partial->EndOfPartial())) break;
-			}
-		}
-	} // if( 0==BodySID )
-	return;
+	// Read the whole body, which stops at each partition pack
+	BodyParser->Seek(0);
+	while(BodyParser->ReadFromFile())
+		;
 }
 
 
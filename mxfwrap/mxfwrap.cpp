@@ -249,6 +249,9 @@ int main_process(int argc, char *argv[])
 		// Set the wrapping options
 		FParser->Use(WCP->Stream, WCP->WrapOpt);
 		
+		// Open the following files of a list in the background if requested
+		if((Opt.OpenAhead > 0) && FParser->IsFileList()) FParser->SetLookAhead(Opt.OpenAhead);
+
 		// Install the descriptor in the source
 		FParser->SetDescriptor(WCP->EssenceDescriptor);
 
@@ -442,6 +445,13 @@ int main_process(int argc, char *argv[])
 			// Record the essence source for this source file or files
 			InFileSource[OutNum].first = iFilePackage;
 			InFileSource[OutNum].second = FParser->GetEssenceSource(WCP->Stream);
+
+			// Read ahead on a worker thread if requested
+			// DRAGONS: Not possible if any sub-streams are slaved to this source, as they read the same parser
+			if((Opt.PrefetchDepth > 0) && !(Opt.IncludeSubstreams && !WCP->SubStreams.empty()))
+			{
+				InFileSource[OutNum].second = new PrefetchEssenceSource(InFileSource[OutNum].second, Opt.PrefetchDepth);
+			}
 			OutNum++;
 
 			// Inform the user of the chosen wrapping
@@ -113,7 +113,8 @@ void HelpText()
 		printf("         a,b = file a followed by file b\n");
 		printf("         a+b = file a ganged with file b\n");
 		printf("     a+b,c+d = file a ganged with file b\n");
-		printf("               followed by file c ganged with file d\n\n");
+		printf("               followed by file c ganged with file d\n");
+		printf("           - = the standard input (seeks limited to a %u MByte window)\n\n", (unsigned int)(DefaultFileWindowSize / (1024 * 1024)));
 
 		printf("Note: There must be the same number of ganged files in each sequential set\n");
 		printf("      Also all files in each set must be the same duration\n\n");
@@ -158,7 +159,9 @@ void HelpText()
 		printf("    -ii        = Isolated index tables (don't share partition with essence)\n");
 		printf("    -ii2       = Isolated index tables (don't share with essence or metadata)\n");
 		printf("    -ka=<size> = Set KAG size (default=1) (-k deprecated)\n");
+		printf("    -la=<num>  = Open up to <num> files ahead when wrapping a list of files\n");
 		printf("    -pd=<dur>  = Body partition every <dur> frames\n");
+		printf("    -pf=<num>  = Read each input up to <num> edit units ahead on a worker thread\n");
 		printf("    -ps=<size> = Body partition roughly every <size> bytes\n");
 		printf("                 (early rather than late)\n");
 		printf("    -fr=<n>/<d>= Force edit rate (if possible) (-r deprecated, but allowed for legacy\n");
@@ -185,7 +188,8 @@ int ParseOptions(int &argc, char **argv, ProcessOptions *pOpt)
 	int i;
 	for(i=1; i<argc;)
 	{
-		if (IsCommandLineSwitchPrefix(argv[i][0]))
+		// DRAGONS: A lone "-" is not a switch, it is an input filename for the standard input
+		if (IsCommandLineSwitchPrefix(argv[i][0]) && (argv[i][1] != '\0'))
 		{
 			// use command-line style of decoding options
 			char *p = &argv[i][1];					// The option less the '-'
@@ -248,6 +252,12 @@ int ParseOptions(int &argc, char **argv, ProcessOptions *pOpt)
 					pOpt->BodyMode = Body_Size;
 					pOpt->BodyRate = strtoul(Val, &temp, 0);
 				}
+				else if(tolower(p[1]) == 'f')
+				{
+					// -pf for prefetch depth
+					char *temp;
+					pOpt->PrefetchDepth = strtoul(Val, &temp, 0);
+				}
 				else error("Unknown body partition mode '%c'\n", p[1]);
 			}
 			else if(Opt == 'e') pOpt->EditAlign = true;
@@ -322,6 +332,17 @@ int ParseOptions(int &argc, char **argv, ProcessOptions *pOpt)
 				else // -k legacy
 					pOpt->KAGSize = strtoul(Val, &temp, 0);
 			}
+			else if(Opt == 'l') 
+			{
+				if(tolower(p[1]) == 'a')
+				{
+					// -la for file list look-ahead
+					char *temp;
+					Val++;
+					pOpt->OpenAhead = strtoul(Val, &temp, 0);
+				}
+				else error("Unknown command-line option %s\n", argv[i]);
+			}
 			else if(Opt == 'u') 
 			{
 				pOpt->UpdateHeader = true;
@@ -0,0 +1,189 @@
+/*! \file	primerbench.cpp
+ *	\brief	Benchmark of Primer lookup and writing speed
+ *
+ *			Not run by the testsuite, run by hand to measure the effect of changes to the Primer class
+ */
+/*
+ *	Copyright (c) 2003, Matt Beard
+ *
+ *	This software is provided 'as-is', without any express or implied warranty.
+ *	In no event will the authors be held liable for any damages arising from
+ *	the use of this software.
+ *
+ *	Permission is granted to anyone to use this software for any purpose,
+ *	including commercial applications, and to alter it and redistribute it
+ *	freely, subject to the following restrictions:
+ *
+ *	  1. The origin of this software must not be misrepresented; you must
+ *	     not claim that you wrote the original software. If you use this
+ *	     software in a product, an acknowledgment in the product
+ *	     documentation would be appreciated but is not required.
+ *	
+ *	  2. Altered source versions must be plainly marked as such, and must
+ *	     not be misrepresented as being the original software.
+ *	
+ *	  3. This notice may not be removed or altered from any source
+ *	     distribution.
+ */
+
+#include <mxflib/mxflib.h>
+
+using namespace mxflib;
+
+// Include the compiled dictionary, which gives the static primer
+#include "mxflib/dict.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+//! Report the time per operation of a benchmark pass
+static void BenchmarkReport(const char *Name, double Operations, clock_t Start)
+{
+	double Seconds = static_cast<double>(clock() - Start) / CLOCKS_PER_SEC;
+
+	if(Seconds <= 0) printf("  %-32s too fast to measure\n", Name);
+	else printf("  %-32s %9.1f ns\n", Name, Seconds * 1.0e9 / Operations);
+}
+
+
+//! Measure primer lookup and writing speed with a given number of dark properties
+/*! A copy of the static primer has some scattered dynamic tags used, as a primer read from a file would,
+ *  and then has Count properties not in the dictionary added to it, as when writing a file with many
+ *  dark properties.
+ *  \return 0 if all OK, else 1
+ */
+static int RunPrimerBenchmark(int Count)
+{
+	const int Passes = 20;
+	const int UsedDynamic = 200;
+
+	PrimerPtr StaticPrimer = MDOType::GetStaticPrimer();
+	PrimerPtr ThisPrimer = new Primer;
+
+	Primer::iterator Static_it = StaticPrimer->begin();
+	while(Static_it != StaticPrimer->end())
+	{
+		ThisPrimer->insert(*Static_it);
+		Static_it++;
+	}
+
+	// Private ULs that are not in any dictionary, the last 4 bytes give each a different value
+	UInt8 Key[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00 };
+
+	int i;
+	for(i=0; i<UsedDynamic; i++)
+	{
+		PutU32(0x80000000 + i, &Key[12]);
+		ThisPrimer->insert(Primer::value_type(static_cast<Tag>(0xffff - (i * 97)), UL(Key)));
+	}
+
+	std::vector<ULPtr> Dark;
+	Dark.reserve(Count);
+	for(i=0; i<Count; i++)
+	{
+		PutU32(i, &Key[12]);
+		Dark.push_back(new UL(Key));
+	}
+
+	printf("\nPrimer with %d static entries, %d used dynamic tags and %d dark properties:\n",
+		   static_cast<int>(StaticPrimer->size()), UsedDynamic, Count);
+
+	clock_t Start = clock();
+	for(i=0; i<Count; i++)
+	{
+		if(ThisPrimer->Lookup(Dark[i]) == 0)
+		{
+			error("Unable to allocate a dynamic tag for dark property %d\n", i);
+			return 1;
+		}
+	}
+	BenchmarkReport("Allocate a dynamic tag", Count, Start);
+
+	int Pass;
+	Tag Total = 0;
+	Start = clock();
+	for(Pass=0; Pass<Passes; Pass++)
+	{
+		for(i=0; i<Count; i++) Total += ThisPrimer->Lookup(Dark[i]);
+	}
+	BenchmarkReport("Look up an existing UL", static_cast<double>(Count) * Passes, Start);
+
+	size_t Found = 0;
+	Start = clock();
+	for(Pass=0; Pass<Passes; Pass++)
+	{
+		UInt32 ThisTag;
+		for(ThisTag=0; ThisTag<0x10000; ThisTag++)
+		{
+			if(ThisPrimer->find(static_cast<Tag>(ThisTag)) != ThisPrimer->end()) Found++;
+		}
+	}
+	BenchmarkReport("Find an entry by tag", 65536.0 * Passes, Start);
+
+	Start = clock();
+	for(Pass=0; Pass<Passes; Pass++)
+	{
+		DataChunkPtr Buffer = new DataChunk;
+		ThisPrimer->WritePrimer(Buffer);
+	}
+	BenchmarkReport("Write the primer", Passes, Start);
+
+	// DRAGONS: Use the results so the loops are not optimized away
+	if((Total == 0) || (Found != ThisPrimer->size() * Passes)) printf("Unexpected primer contents\n");
+
+	return 0;
+}
+
+
+//! Run the benchmark with the number of dark properties given on the command line (default 10000)
+int main(int argc, char *argv[])
+{
+	int Count = 10000;
+	if(argc > 1) Count = atoi(argv[1]);
+
+	if(Count <= 0)
+	{
+		printf("\nUsage:   %s [<num>]\n\n", argv[0]);
+		printf("Benchmark a primer holding <num> dark properties (default 10000)\n");
+		return 1;
+	}
+
+	LoadDictionary(DictData);
+
+	return RunPrimerBenchmark(Count);
+}
+
+
+// Debug and error messages
+#include <stdarg.h>
+
+#ifdef MXFLIB_DEBUG
+//! Display a general debug message
+void mxflib::debug(const char *Fmt, ...)
+{
+}
+#endif // MXFLIB_DEBUG
+
+//! Display a warning message
+void mxflib::warning(const char *Fmt, ...)
+{
+	va_list args;
+
+	va_start(args, Fmt);
+	printf("Warning: ");
+	vprintf(Fmt, args);
+	va_end(args);
+}
+
+//! Display an error message
+void mxflib::error(const char *Fmt, ...)
+{
+	va_list args;
+
+	va_start(args, Fmt);
+	printf("ERROR: ");
+	vprintf(Fmt, args);
+	va_end(args);
+}